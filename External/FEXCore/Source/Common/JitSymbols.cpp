@@ -1,85 +1,357 @@
 #include "Common/JitSymbols.h"
 
+#include <FEXCore/HLE/SourcecodeResolver.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXHeaderUtils/Syscalls.h>
+#include <FEXHeaderUtils/TypeDefines.h>
+
+#include <cstring>
+#include <elf.h>
 #include <fcntl.h>
+#include <filesystem>
+#include <mutex>
 #include <string>
+#include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <fmt/format.h>
 
 namespace FEXCore {
+  namespace {
+    // Linux perf jitdump format, see tools/perf/Documentation/jitdump-specification.txt
+    constexpr uint32_t JITDUMP_MAGIC = 0x4A695444;
+    constexpr uint32_t JITDUMP_VERSION = 1;
+
+    enum JITDumpRecordType : uint32_t {
+      JIT_CODE_LOAD = 0,
+      JIT_CODE_CLOSE = 3,
+    };
+
+    struct JITDumpHeader {
+      uint32_t Magic;
+      uint32_t Version;
+      uint32_t TotalSize;
+      uint32_t ElfMach;
+      uint32_t Pad1;
+      uint32_t Pid;
+      uint64_t Timestamp;
+      uint64_t Flags;
+    };
+    static_assert(sizeof(JITDumpHeader) == 40);
+
+    struct JITDumpRecordHeader {
+      uint32_t Id;
+      uint32_t TotalSize;
+      uint64_t Timestamp;
+    };
+
+    struct JITDumpCodeLoad {
+      JITDumpRecordHeader Header;
+      uint32_t Pid;
+      uint32_t Tid;
+      uint64_t VMA;
+      uint64_t CodeAddr;
+      uint64_t CodeSize;
+      uint64_t CodeIndex;
+      // Followed by the null terminated name and the code
+    };
+    static_assert(sizeof(JITDumpCodeLoad) == 56);
+
+    // Needs to match the clock perf is recording with, `perf record -k mono`
+    uint64_t JITDumpTimestamp() {
+      struct timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      return ts.tv_sec * 1'000'000'000ULL + ts.tv_nsec;
+    }
+
+    bool WriteAll(int fd, const void *Data, size_t Size) {
+      // The guest can close our fd from under us, stop writing if it does
+      auto Result = write(fd, Data, Size);
+      return !(Result == -1 && errno == EBADF);
+    }
+  }
+
+  JITSymbolBuffer::JITSymbolBuffer(JITSymbols *_Symbols)
+    : Symbols {_Symbols}
+    , Pid {::getpid()}
+    , LastFlush {std::chrono::steady_clock::now()} {
+    PerfMap.reserve(MAX_BUFFER_SIZE);
+  }
+
+  JITSymbolBuffer::~JITSymbolBuffer() {
+    Symbols->Flush(this);
+  }
+
   JITSymbols::JITSymbols() {
   }
 
   JITSymbols::~JITSymbols() {
-    if (fd != -1) {
-      close(fd);
+    if (fd.load() != -1) {
+      close(fd.load());
     }
+    CloseJITDump();
   }
 
-  void JITSymbols::InitFile() {
-    // We can't use FILE here since we must be robust against forking processes closing our FD from under us.
-    const auto PerfMap = fmt::format("/tmp/perf-{}.map", getpid());
+  void JITSymbols::InitFile(bool PerfMap, bool JITDump) {
+    PerfMapEnabled = PerfMap;
+    JITDumpEnabled = JITDump;
+
+    if (PerfMapEnabled) {
+      // We can't use FILE here since we must be robust against forking processes closing our FD from under us.
+      // Buffers are written with a single append so lines from different threads never interleave.
+      const auto PerfMap = fmt::format("/tmp/perf-{}.map", getpid());
+
+      fd.store(open(PerfMap.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_APPEND | O_CLOEXEC, 0644));
+    }
 
-    fd = open(PerfMap.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_DIRECT, 0644);
+    if (JITDumpEnabled) {
+      OpenJITDump();
+    }
+  }
+
+  void JITSymbols::CleanupAfterFork() {
+    // The files belong to the parent
+    if (auto PerfMapFD = fd.exchange(-1); PerfMapFD != -1) {
+      close(PerfMapFD);
+    }
+
+    if (auto DumpFD = JITDumpFD.exchange(-1); DumpFD != -1) {
+      close(DumpFD);
+    }
+
+    if (JITDumpMarker) {
+      FEXCore::Allocator::munmap(JITDumpMarker, FHU::FEX_PAGE_SIZE);
+      JITDumpMarker = nullptr;
+    }
+
+    InitFile(PerfMapEnabled, JITDumpEnabled);
+  }
+
+  void JITSymbols::OpenJITDump() {
+    const auto JITDump = fmt::format("/tmp/jit-{}.dump", getpid());
+
+    const int DumpFD = open(JITDump.c_str(), O_CREAT | O_TRUNC | O_RDWR | O_APPEND | O_CLOEXEC, 0644);
+    if (DumpFD == -1) {
+      return;
+    }
+
+    const JITDumpHeader Header {
+      .Magic = JITDUMP_MAGIC,
+      .Version = JITDUMP_VERSION,
+      .TotalSize = sizeof(JITDumpHeader),
+#ifdef _M_ARM_64
+      .ElfMach = EM_AARCH64,
+#else
+      .ElfMach = EM_X86_64,
+#endif
+      .Pad1 = 0,
+      .Pid = static_cast<uint32_t>(getpid()),
+      .Timestamp = JITDumpTimestamp(),
+      .Flags = 0,
+    };
+
+    if (write(DumpFD, &Header, sizeof(Header)) != sizeof(Header)) {
+      close(DumpFD);
+      return;
+    }
+
+    // perf finds the dump through an executable mapping of the file showing up in the recording
+    JITDumpMarker = FEXCore::Allocator::mmap(nullptr, FHU::FEX_PAGE_SIZE, PROT_READ | PROT_EXEC, MAP_PRIVATE, DumpFD, 0);
+    if (JITDumpMarker == MAP_FAILED) {
+      JITDumpMarker = nullptr;
+    }
+
+    // Only published once the header is written
+    JITDumpFD.store(DumpFD);
+  }
+
+  void JITSymbols::CloseJITDump() {
+    if (auto DumpFD = JITDumpFD.exchange(-1); DumpFD != -1) {
+      const JITDumpRecordHeader Close {
+        .Id = JIT_CODE_CLOSE,
+        .TotalSize = sizeof(JITDumpRecordHeader),
+        .Timestamp = JITDumpTimestamp(),
+      };
+      write(DumpFD, &Close, sizeof(Close));
+      close(DumpFD);
+    }
+
+    if (JITDumpMarker) {
+      FEXCore::Allocator::munmap(JITDumpMarker, FHU::FEX_PAGE_SIZE);
+      JITDumpMarker = nullptr;
+    }
+  }
+
+  void JITSymbols::WriteDirect(std::string_view Line) {
+    const int PerfMapFD = fd.load(std::memory_order_relaxed);
+    if (PerfMapFD == -1) return;
+
+    if (!WriteAll(PerfMapFD, Line.data(), Line.size())) {
+      fd.store(-1, std::memory_order_relaxed);
+    }
   }
 
   void JITSymbols::Register(const void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize) {
-    if (fd == -1) return;
+    if (fd.load(std::memory_order_relaxed) == -1) return;
 
     // Linux perf format is very straightforward
     // `<HostPtr> <Size> <Name>\n`
-    const auto Buffer = fmt::format("{} {:x} JIT_0x{:x}_{}\n", HostAddr, CodeSize, GuestAddr, HostAddr);
-    auto Result = write(fd, Buffer.c_str(), Buffer.size());
-    if (Result == -1 && errno == EBADF) {
-      fd = -1;
-    }
+    WriteDirect(fmt::format("{} {:x} JIT_0x{:x}_{}\n", HostAddr, CodeSize, GuestAddr, HostAddr));
   }
 
   void JITSymbols::Register(const void *HostAddr, uint32_t CodeSize, std::string_view Name) {
-    if (fd == -1) return;
+    if (fd.load(std::memory_order_relaxed) == -1) return;
 
-    // Linux perf format is very straightforward
-    // `<HostPtr> <Size> <Name>\n`
-    const auto Buffer = fmt::format("{} {:x} {}_{}\n", HostAddr, CodeSize, Name, HostAddr);
-    auto Result = write(fd, Buffer.c_str(), Buffer.size());
-    if (Result == -1 && errno == EBADF) {
-      fd = -1;
-    }
+    WriteDirect(fmt::format("{} {:x} {}_{}\n", HostAddr, CodeSize, Name, HostAddr));
   }
 
   void JITSymbols::Register(const void *HostAddr, uint32_t CodeSize, std::string_view Name, uintptr_t Offset) {
-    if (fd == -1) return;
+    if (fd.load(std::memory_order_relaxed) == -1) return;
 
-    // Linux perf format is very straightforward
-    // `<HostPtr> <Size> <Name>\n`
-    const auto Buffer = fmt::format("{} {:x} {}+0x{:x} ({})\n", HostAddr, CodeSize, Name, Offset, HostAddr);
-    auto Result = write(fd, Buffer.c_str(), Buffer.size());
-    if (Result == -1 && errno == EBADF) {
-      fd = -1;
-    }
+    WriteDirect(fmt::format("{} {:x} {}+0x{:x} ({})\n", HostAddr, CodeSize, Name, Offset, HostAddr));
   }
 
   void JITSymbols::RegisterNamedRegion(const void *HostAddr, uint32_t CodeSize, std::string_view Name) {
-    if (fd == -1) return;
+    if (fd.load(std::memory_order_relaxed) == -1) return;
 
-    // Linux perf format is very straightforward
-    // `<HostPtr> <Size> <Name>\n`
-    const auto Buffer = fmt::format("{} {:x} {}\n", HostAddr, CodeSize, Name);
-    auto Result = write(fd, Buffer.c_str(), Buffer.size());
-    if (Result == -1 && errno == EBADF) {
-      fd = -1;
-    }
+    WriteDirect(fmt::format("{} {:x} {}\n", HostAddr, CodeSize, Name));
   }
 
   void JITSymbols::RegisterJITSpace(const void *HostAddr, uint32_t CodeSize) {
-    if (fd == -1) return;
+    if (fd.load(std::memory_order_relaxed) == -1) return;
 
-    // Linux perf format is very straightforward
-    // `<HostPtr> <Size> <Name>\n`
-    const auto Buffer = fmt::format("{} {:x} FEXJIT\n", HostAddr, CodeSize);
-    auto Result = write(fd, Buffer.c_str(), Buffer.size());
-    if (Result == -1 && errno == EBADF) {
-      fd = -1;
+    WriteDirect(fmt::format("{} {:x} FEXJIT\n", HostAddr, CodeSize));
+  }
+
+  FEXCore::HLE::SourcecodeMap const *JITSymbols::GetSymbolMap(std::string_view Filename, std::string_view FileId) {
+    if (!SourcecodeResolver) {
+      return nullptr;
+    }
+
+    const std::string Key {FileId};
+    {
+      std::shared_lock lk(SymbolMapMutex);
+      auto it = SymbolMaps.find(Key);
+      if (it != SymbolMaps.end()) {
+        return it->second.get();
+      }
+    }
+
+    // Parse outside of the lock, only happens once per guest file.
+    // Failures are stored as well so they aren't retried for every block.
+    auto Map = SourcecodeResolver->GenerateSymbolMap(Filename);
+
+    std::unique_lock lk(SymbolMapMutex);
+    auto [it, Inserted] = SymbolMaps.try_emplace(Key, std::move(Map));
+    return it->second.get();
+  }
+
+  void JITSymbols::RegisterBlock(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, uint64_t GuestAddr,
+                                 std::string_view Filename, std::string_view FileId, uintptr_t FileOffset) {
+    if (!IsEnabled()) return;
+
+    std::string Name;
+    if (Filename.empty()) {
+      Name = fmt::format("JIT_0x{:x}", GuestAddr);
+    }
+    else {
+      const auto Basename = std::filesystem::path(Filename).filename().string();
+      auto Map = GetSymbolMap(Filename, FileId);
+      auto Sym = Map ? Map->FindSymbolMapping(FileOffset) : nullptr;
+
+      if (Sym) {
+        Name = fmt::format("{}!{}+0x{:x}", Basename, Sym->Name, FileOffset - Sym->FileGuestBegin);
+      }
+      else {
+        Name = fmt::format("{}+0x{:x}", Basename, FileOffset);
+      }
+    }
+
+    AppendBuffered(Buffer, HostAddr, CodeSize, Name);
+  }
+
+  void JITSymbols::RegisterNamedRegion(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, std::string_view Name) {
+    if (!IsEnabled()) return;
+
+    AppendBuffered(Buffer, HostAddr, CodeSize, Name);
+  }
+
+  void JITSymbols::AppendBuffered(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, std::string_view Name) {
+    if (Buffer->Pid != ::getpid()) {
+      // Inherited over fork, the parent is responsible for these
+      Buffer->PerfMap.clear();
+      Buffer->JITDump.clear();
+      Buffer->Pid = ::getpid();
+    }
+
+    if (fd.load(std::memory_order_relaxed) != -1) {
+      // `<HostPtr> <Size> <Name>\n`
+      fmt::format_to(std::back_inserter(Buffer->PerfMap), "{} {:x} {}\n", HostAddr, CodeSize, Name);
+    }
+
+    if (JITDumpFD.load(std::memory_order_relaxed) != -1) {
+      const JITDumpCodeLoad Record {
+        .Header = {
+          .Id = JIT_CODE_LOAD,
+          .TotalSize = static_cast<uint32_t>(sizeof(JITDumpCodeLoad) + Name.size() + 1 + CodeSize),
+          .Timestamp = JITDumpTimestamp(),
+        },
+        .Pid = static_cast<uint32_t>(Buffer->Pid),
+        .Tid = static_cast<uint32_t>(FHU::Syscalls::gettid()),
+        .VMA = reinterpret_cast<uint64_t>(HostAddr),
+        .CodeAddr = reinterpret_cast<uint64_t>(HostAddr),
+        .CodeSize = CodeSize,
+        .CodeIndex = JITDumpCodeIndex.fetch_add(1),
+      };
+
+      auto &Dump = Buffer->JITDump;
+      const auto Offset = Dump.size();
+      Dump.resize(Offset + Record.Header.TotalSize);
+      auto Data = &Dump[Offset];
+      memcpy(Data, &Record, sizeof(Record));
+      Data += sizeof(Record);
+      memcpy(Data, Name.data(), Name.size());
+      Data[Name.size()] = 0;
+      Data += Name.size() + 1;
+      // The code needs to be copied now, the code buffer might be reused by the time this is flushed
+      memcpy(Data, HostAddr, CodeSize);
+    }
+
+    if (Buffer->PerfMap.size() >= JITSymbolBuffer::MAX_BUFFER_SIZE ||
+        Buffer->JITDump.size() >= JITSymbolBuffer::MAX_BUFFER_SIZE ||
+        (std::chrono::steady_clock::now() - Buffer->LastFlush) >= JITSymbolBuffer::MAX_BUFFER_AGE) {
+      Flush(Buffer);
+    }
+  }
+
+  void JITSymbols::Flush(JITSymbolBuffer *Buffer) {
+    if (Buffer->Pid == ::getpid()) {
+      const int PerfMapFD = fd.load(std::memory_order_relaxed);
+      if (PerfMapFD != -1 && !Buffer->PerfMap.empty() &&
+          !WriteAll(PerfMapFD, Buffer->PerfMap.data(), Buffer->PerfMap.size())) {
+        fd.store(-1, std::memory_order_relaxed);
+      }
+
+      const int DumpFD = JITDumpFD.load(std::memory_order_relaxed);
+      if (DumpFD != -1 && !Buffer->JITDump.empty() &&
+          !WriteAll(DumpFD, Buffer->JITDump.data(), Buffer->JITDump.size())) {
+        JITDumpFD.store(-1, std::memory_order_relaxed);
+      }
+    }
+
+    Buffer->PerfMap.clear();
+    Buffer->JITDump.clear();
+    Buffer->LastFlush = std::chrono::steady_clock::now();
+  }
+
+  void JITSymbols::FlushIfStale(JITSymbolBuffer *Buffer) {
+    if (Buffer->PerfMap.empty() && Buffer->JITDump.empty()) {
+      return;
+    }
+
+    if ((std::chrono::steady_clock::now() - Buffer->LastFlush) >= JITSymbolBuffer::MAX_BUFFER_AGE) {
+      Flush(Buffer);
     }
   }
 
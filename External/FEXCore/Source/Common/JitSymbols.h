@@ -1,24 +1,130 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <memory>
+#include <shared_mutex>
+#include <string>
 #include <string_view>
+#include <sys/types.h>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore::HLE {
+  class SourcecodeResolver;
+  struct SourcecodeMap;
+}
 
 namespace FEXCore {
+class JITSymbols;
+
+/**
+ * @brief Per-thread staging area for symbol output
+ *
+ * Block symbols are appended here and handed to the files in batches, instead of one write syscall per block.
+ * The owning thread flushes stale data on its next syscall, see JITSymbols::FlushIfStale.
+ * Anything left over is flushed when the buffer is destroyed with the thread, the Context deletes all threads at shutdown.
+ */
+class JITSymbolBuffer final {
+public:
+  explicit JITSymbolBuffer(JITSymbols *_Symbols);
+  ~JITSymbolBuffer();
+
+  JITSymbolBuffer(JITSymbolBuffer const&) = delete;
+  JITSymbolBuffer& operator=(JITSymbolBuffer const&) = delete;
+
+private:
+  friend class JITSymbols;
+
+  // Flush once either buffer gets this large or once the oldest data is this old
+  constexpr static size_t MAX_BUFFER_SIZE = 64 * 1024;
+  constexpr static auto MAX_BUFFER_AGE = std::chrono::milliseconds(100);
+
+  JITSymbols *Symbols;
+  // Process that filled the buffer. A forked child discards what it inherited, the parent writes it out.
+  pid_t Pid;
+  std::chrono::steady_clock::time_point LastFlush;
+  std::string PerfMap;
+  std::vector<uint8_t> JITDump;
+};
+
 class JITSymbols final {
 public:
   JITSymbols();
   ~JITSymbols();
 
-  void InitFile();
+  /**
+   * @brief Opens the output files
+   *
+   * @param PerfMap Write `/tmp/perf-<pid>.map`
+   * @param JITDump Write `/tmp/jit-<pid>.dump` for `perf inject --jit`, records include the host code
+   */
+  void InitFile(bool PerfMap, bool JITDump);
+
+  // Reopens the files for the new pid
+  void CleanupAfterFork();
+
+  void SetSourcecodeResolver(FEXCore::HLE::SourcecodeResolver *Resolver) {
+    SourcecodeResolver = Resolver;
+  }
+
+  bool IsEnabled() const {
+    return fd.load(std::memory_order_relaxed) != -1 || JITDumpFD.load(std::memory_order_relaxed) != -1;
+  }
+
   void Register(const void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize);
   void Register(const void *HostAddr, uint32_t CodeSize, std::string_view Name);
   void Register(const void *HostAddr, uint32_t CodeSize, std::string_view Name, uintptr_t Offset);
   void RegisterNamedRegion(const void *HostAddr, uint32_t CodeSize, std::string_view Name);
   void RegisterJITSpace(const void *HostAddr, uint32_t CodeSize);
 
+  /**
+   * @brief Buffered registration of a compiled guest block
+   *
+   * Names the block `<file>!<symbol>+0x<offset>` when the guest file has a symbol covering it,
+   * `<file>+0x<offset>` when it doesn't and `JIT_0x<GuestAddr>` if the code doesn't belong to a file.
+   *
+   * @param Filename Guest file the block was compiled from, empty if none
+   * @param FileId AOTIR file id of Filename, used to cache its symbols
+   * @param FileOffset Offset of the block inside of the guest file
+   */
+  void RegisterBlock(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, uint64_t GuestAddr,
+                     std::string_view Filename, std::string_view FileId, uintptr_t FileOffset);
+
+  // Buffered version of RegisterNamedRegion
+  void RegisterNamedRegion(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, std::string_view Name);
+
+  void Flush(JITSymbolBuffer *Buffer);
+
+  // Flushes the buffer if its oldest data is older than MAX_BUFFER_AGE, called from the owning thread
+  void FlushIfStale(JITSymbolBuffer *Buffer);
+
+  /**
+   * @brief Symbols of a guest file, parsed once per FileId and kept around
+   *
+   * @return nullptr if there is no resolver or the file has no symbols
+   */
+  FEXCore::HLE::SourcecodeMap const *GetSymbolMap(std::string_view Filename, std::string_view FileId);
+
 private:
-  int fd{-1};
+  void WriteDirect(std::string_view Line);
+  void AppendBuffered(JITSymbolBuffer *Buffer, const void *HostAddr, uint32_t CodeSize, std::string_view Name);
+
+  void OpenJITDump();
+  void CloseJITDump();
+
+  // Only opened and closed while a single thread is running, writers drop them to -1 once the guest closed them
+  std::atomic<int> fd{-1};
+  std::atomic<int> JITDumpFD{-1};
+  void *JITDumpMarker{};
+  bool PerfMapEnabled{};
+  bool JITDumpEnabled{};
+  std::atomic<uint64_t> JITDumpCodeIndex{};
+
+  FEXCore::HLE::SourcecodeResolver *SourcecodeResolver{};
+  std::shared_mutex SymbolMapMutex;
+  std::unordered_map<std::string, std::unique_ptr<FEXCore::HLE::SourcecodeMap>> SymbolMaps;
 };
 }
@@ -2,7 +2,6 @@
 #include "Interface/Context/Context.h"
 #include "Interface/Core/Core.h"
 #include "Interface/Core/OpcodeDispatcher.h"
-#include "Interface/Core/X86Tables/X86Tables.h"
 
 #include <FEXCore/Core/CoreState.h>
 #include <FEXCore/Core/Context.h>
@@ -19,9 +18,8 @@ namespace FEXCore::HLE {
 
 namespace FEXCore::Context {
   void InitializeStaticTables(OperatingMode Mode) {
+    // The x86 decode and dispatch tables are generated at compile time for both modes.
     FEXCore::Paths::InitializePaths();
-    X86Tables::InitializeInfoTables(Mode);
-    IR::InstallOpcodeHandlers(Mode);
   }
 
   void ShutdownStaticTables() {
@@ -161,6 +159,7 @@ namespace FEXCore::Context {
   void SetSyscallHandler(FEXCore::Context::Context *CTX, FEXCore::HLE::SyscallHandler *Handler) {
     CTX->SyscallHandler = Handler;
     CTX->SourcecodeResolver = Handler->GetSourcecodeResolver();
+    CTX->Symbols.SetSourcecodeResolver(CTX->SourcecodeResolver);
   }
 
   FEXCore::CPUID::FunctionResults RunCPUIDFunction(FEXCore::Context::Context *CTX, uint32_t Function, uint32_t Leaf) {
@@ -191,13 +190,20 @@ namespace FEXCore::Context {
     CTX->WriteFilesWithCode(Writer);
   }
 
-  IR::AOTIRCacheEntry *LoadAOTIRCacheEntry(FEXCore::Context::Context *CTX, const std::string &Name) {
-    return CTX->LoadAOTIRCacheEntry(Name);
+  IR::AOTIRCacheEntry *LoadAOTIRCacheEntry(FEXCore::Context::Context *CTX, const std::string &Name, const std::string &FileIdentity) {
+    return CTX->LoadAOTIRCacheEntry(Name, FileIdentity);
   }
   void UnloadAOTIRCacheEntry(FEXCore::Context::Context *CTX, IR::AOTIRCacheEntry *Entry) {
     return CTX->UnloadAOTIRCacheEntry(Entry);
   }
 
+  void AddNamedRegion(FEXCore::Context::Context *CTX, uintptr_t Base, uintptr_t Size, uintptr_t Offset, const std::string &filename) {
+    CTX->AddNamedRegion(Base, Size, Offset, filename);
+  }
+  void RemoveNamedRegion(FEXCore::Context::Context *CTX, uintptr_t Base, uintptr_t Size) {
+    CTX->RemoveNamedRegion(Base, Size);
+  }
+
   CustomIRResult AddCustomIREntrypoint(FEXCore::Context::Context *CTX, uintptr_t Entrypoint, std::function<void(uintptr_t Entrypoint, FEXCore::IR::IREmitter *)> Handler, void *Creator, void *Data) {
     return CTX->AddCustomIREntrypoint(Entrypoint, Handler, Creator, Data);
   }
@@ -210,6 +216,17 @@ namespace Debug {
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP) {
     CTX->CompileRIP(CTX->ParentThread, RIP);
   }
+
+  bool CompileRIPWithStats(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::Core::CompileStageStats *Stats) {
+    const bool Compiled = CTX->CompileRIP(CTX->ParentThread, RIP);
+    *Stats = CTX->ParentThread->LastCompile;
+    return Compiled;
+  }
+
+  void DecodeRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length, DecodeRangeStats *Stats) {
+    CTX->DecodeRange(CTX->ParentThread, Start, Length, Stats);
+  }
+
   uint64_t GetThreadCount(FEXCore::Context::Context *CTX) {
     return CTX->GetThreadCount();
   }
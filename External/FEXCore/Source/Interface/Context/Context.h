@@ -3,6 +3,7 @@
 #include "Common/JitSymbols.h"
 #include "FEXHeaderUtils/ScopedSignalMask.h"
 #include "Interface/Core/CPUID.h"
+#include "Interface/Core/GuestProfiler.h"
 #include "Interface/Core/X86HelperGen.h"
 #include "Interface/Core/ObjectCache/ObjectCacheService.h"
 #include "Interface/Core/Dispatcher/Dispatcher.h"
@@ -65,6 +66,10 @@ namespace Validation {
 }
 
 namespace FEXCore::Context {
+namespace Debug {
+  struct DecodeRangeStats;
+}
+
   enum CoreRunningMode {
     MODE_RUN        = 0,
     MODE_SINGLESTEP = 1,
@@ -100,6 +105,7 @@ namespace FEXCore::Context {
       FEX_CONFIG_OPT(AOTIRCapture, AOTIRCAPTURE);
       FEX_CONFIG_OPT(AOTIRGenerate, AOTIRGENERATE);
       FEX_CONFIG_OPT(AOTIRLoad, AOTIRLOAD);
+      FEX_CONFIG_OPT(AOTIRIncremental, AOTIRINCREMENTAL);
       FEX_CONFIG_OPT(SMCChecks, SMCCHECKS);
       FEX_CONFIG_OPT(Core, CORE);
       FEX_CONFIG_OPT(MaxInstPerBlock, MAXINST);
@@ -112,12 +118,23 @@ namespace FEXCore::Context {
       FEX_CONFIG_OPT(GlobalJITNaming, GLOBALJITNAMING);
       FEX_CONFIG_OPT(LibraryJITNaming, LIBRARYJITNAMING);
       FEX_CONFIG_OPT(BlockJITNaming, BLOCKJITNAMING);
+      FEX_CONFIG_OPT(PerfJITDump, PERFJITDUMP);
+      FEX_CONFIG_OPT(GuestProfile, GUESTPROFILE);
+      FEX_CONFIG_OPT(GuestProfileFrequency, GUESTPROFILEFREQUENCY);
+      FEX_CONFIG_OPT(HotTraceCapture, HOTTRACECAPTURE);
+      FEX_CONFIG_OPT(HotTraceBlocks, HOTTRACEBLOCKS);
+      FEX_CONFIG_OPT(CompileStats, COMPILESTATS);
       FEX_CONFIG_OPT(GDBSymbols, GDBSYMBOLS);
       FEX_CONFIG_OPT(ParanoidTSO, PARANOIDTSO);
+      FEX_CONFIG_OPT(StackTSOElision, STACKTSOELISION);
+      FEX_CONFIG_OPT(FramePointerTSOElision, FRAMEPOINTERTSOELISION);
       FEX_CONFIG_OPT(CacheObjectCodeCompilation, CACHEOBJECTCODECOMPILATION);
       FEX_CONFIG_OPT(x87ReducedPrecision, X87REDUCEDPRECISION);
       FEX_CONFIG_OPT(x86dec_SynchronizeRIPOnAllBlocks, X86DEC_SYNCHRONIZERIPONALLBLOCKS);
       FEX_CONFIG_OPT(EnableAVX, ENABLEAVX);
+      FEX_CONFIG_OPT(AVXRegisterPairing, AVXREGISTERPAIRING);
+      FEX_CONFIG_OPT(ThreadStatePool, THREADSTATEPOOL);
+      FEX_CONFIG_OPT(DecodeCacheSize, DECODECACHESIZE);
     } Config;
 
     FEXCore::HostFeatures HostFeatures;
@@ -125,6 +142,10 @@ namespace FEXCore::Context {
     std::mutex ThreadCreationMutex;
     FEXCore::Core::InternalThreadState* ParentThread{};
     std::vector<FEXCore::Core::InternalThreadState*> Threads;
+    // States of exited threads, ready to be handed to new threads by CreateThread. Guarded by ThreadCreationMutex
+    std::vector<FEXCore::Core::InternalThreadState*> ThreadStatePool;
+    // Stats of threads that exited, DumpCompileStats adds the live threads on top. Guarded by ThreadCreationMutex
+    FEXCore::Core::RuntimeStats ExitedThreadStats{};
     std::atomic_bool CoreShuttingDown{false};
     bool NeedToCheckXID{true};
 
@@ -204,7 +225,8 @@ namespace FEXCore::Context {
     void RemoveCustomIREntrypoint(uintptr_t Entrypoint);
 
     // Debugger interface
-    void CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    bool CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    void DecodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length, FEXCore::Context::Debug::DecodeRangeStats *Stats);
     uint64_t GetThreadCount() const;
     FEXCore::Core::RuntimeStats *GetRuntimeStatsForThread(uint64_t Thread);
     bool GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data);
@@ -218,7 +240,7 @@ namespace FEXCore::Context {
       uint64_t StartAddr;
       uint64_t Length;
     };
-    [[nodiscard]] GenerateIRResult GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool ExtendedDebugInfo);
+    [[nodiscard]] GenerateIRResult GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
 
     struct CompileCodeResult {
       void* CompiledCode;
@@ -296,10 +318,14 @@ namespace FEXCore::Context {
 
     uint8_t GetGPRSize() const { return Config.Is64BitMode ? 8 : 4; }
 
-    IR::AOTIRCacheEntry *LoadAOTIRCacheEntry(const std::string &filename);
+    IR::AOTIRCacheEntry *LoadAOTIRCacheEntry(const std::string &filename, const std::string &FileIdentity);
     void UnloadAOTIRCacheEntry(IR::AOTIRCacheEntry *Entry);
 
+    void AddNamedRegion(uintptr_t Base, uintptr_t Size, uintptr_t Offset, const std::string &filename);
+    void RemoveNamedRegion(uintptr_t Base, uintptr_t Size);
+
     FEXCore::JITSymbols Symbols;
+    std::unique_ptr<FEXCore::GuestProfiler> Profiler;
 
     // Public for threading
     void ExecutionThread(FEXCore::Core::InternalThreadState *Thread);
@@ -355,12 +381,32 @@ namespace FEXCore::Context {
      */
     void InitializeCompiler(FEXCore::Core::InternalThreadState* Thread);
 
+    /**
+     * @brief Takes a thread state from ThreadStatePool
+     *
+     * @return The recycled thread state or nullptr if the pool is empty
+     */
+    FEXCore::Core::InternalThreadState* AcquireThreadState();
+
+    /**
+     * @brief Returns the state of an exited thread to its initial state and parks it in ThreadStatePool
+     *
+     * Compiled code, caches and stats are dropped and their pages returned to the kernel,
+     * the mappings and compiler objects are kept for the next thread.
+     *
+     * @return false if the pool is full or disabled and the state needs to be deleted instead
+     */
+    bool ReleaseThreadState(FEXCore::Core::InternalThreadState* Thread);
+
     void WaitForIdleWithTimeout();
 
     void NotifyPause();
 
     void AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
 
+    // Logs the compile stage and pass totals of every thread
+    void DumpCompileStats();
+
     // Entry Cache
     std::mutex ExitMutex;
     std::unique_ptr<GdbServer> DebugServer;
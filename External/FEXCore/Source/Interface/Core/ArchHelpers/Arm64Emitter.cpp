@@ -210,7 +210,7 @@ void Arm64Emitter::SpillStaticRegs(bool FPRs, uint32_t GPRSpillMask, uint32_t FP
   }
 
   if (FPRs) {
-    if (EmitterCTX->HostFeatures.SupportsAVX) {
+    if (EmitterCTX->HostFeatures.SupportsSVE256) {
       for (size_t i = 0; i < SRAFPR.size(); i++) {
         const auto Reg = SRAFPR[i];
 
@@ -219,6 +219,15 @@ void Arm64Emitter::SpillStaticRegs(bool FPRs, uint32_t GPRSpillMask, uint32_t FP
           st1b<ARMEmitter::SubRegSize::i8Bit>(Reg, PRED_TMP_32B, STATE.R(), TMP4.R());
         }
       }
+    } else if (EmitterCTX->HostFeatures.SupportsAVX) {
+      // Static registers only hold the lower halves of the AVX registers, the upper halves always live in the context.
+      for (size_t i = 0; i < SRAFPR.size(); i++) {
+        const auto Reg = SRAFPR[i];
+
+        if (((1U << Reg.Idx()) & FPRSpillMask) != 0) {
+          str(Reg.Q(), STATE.R(), offsetof(FEXCore::Core::CpuStateFrame, State.xmm.avx.data[i][0]));
+        }
+      }
     } else {
       if (GPRSpillMask && FPRSpillMask == ~0U) {
         // Optimize the common case where we can spill four registers per instruction
@@ -261,7 +270,7 @@ void Arm64Emitter::FillStaticRegs(bool FPRs, uint32_t GPRFillMask, uint32_t FPRF
   }
 
   if (FPRs) {
-    if (EmitterCTX->HostFeatures.SupportsAVX) {
+    if (EmitterCTX->HostFeatures.SupportsSVE256) {
       // Set up predicate registers.
       // We don't bother spilling these in SpillStaticRegs,
       // since all that matters is we restore them on a fill.
@@ -276,6 +285,14 @@ void Arm64Emitter::FillStaticRegs(bool FPRs, uint32_t GPRFillMask, uint32_t FPRF
           ld1b<ARMEmitter::SubRegSize::i8Bit>(Reg, PRED_TMP_32B, STATE.R(), TMP4.R());
         }
       }
+    } else if (EmitterCTX->HostFeatures.SupportsAVX) {
+      for (size_t i = 0; i < SRAFPR.size(); i++) {
+        const auto Reg = SRAFPR[i];
+
+        if (((1U << Reg.Idx()) & FPRFillMask) != 0) {
+          ldr(Reg.Q(), STATE.R(), offsetof(FEXCore::Core::CpuStateFrame, State.xmm.avx.data[i][0]));
+        }
+      }
     } else {
       if (GPRFillMask && FPRFillMask == ~0U) {
         // Optimize the common case where we can fill four registers per instruction.
@@ -329,7 +346,7 @@ void Arm64Emitter::FillStaticRegs(bool FPRs, uint32_t GPRFillMask, uint32_t FPRF
 }
 
 void Arm64Emitter::PushDynamicRegsAndLR(FEXCore::ARMEmitter::Register TmpReg) {
-  const auto CanUseSVE = EmitterCTX->HostFeatures.SupportsAVX;
+  const auto CanUseSVE = EmitterCTX->HostFeatures.SupportsSVE256;
   const auto GPRSize = 1 * Core::CPUState::GPR_REG_SIZE;
   const auto FPRRegSize = CanUseSVE ? Core::CPUState::XMM_AVX_REG_SIZE
                                     : Core::CPUState::XMM_SSE_REG_SIZE;
@@ -365,7 +382,7 @@ void Arm64Emitter::PushDynamicRegsAndLR(FEXCore::ARMEmitter::Register TmpReg) {
 }
 
 void Arm64Emitter::PopDynamicRegsAndLR() {
-  const auto CanUseSVE = EmitterCTX->HostFeatures.SupportsAVX;
+  const auto CanUseSVE = EmitterCTX->HostFeatures.SupportsSVE256;
 
   if (CanUseSVE) {
     for (size_t i = 0; i < RAFPR.size(); i += 4) {
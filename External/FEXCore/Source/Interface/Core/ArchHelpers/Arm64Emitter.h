@@ -59,6 +59,16 @@ constexpr std::array<FEXCore::ARMEmitter::VRegister, 12> RAFPR = {
   FEXCore::ARMEmitter::VReg::v8,  FEXCore::ARMEmitter::VReg::v9,  FEXCore::ARMEmitter::VReg::v10, FEXCore::ARMEmitter::VReg::v11, FEXCore::ARMEmitter::VReg::v12, FEXCore::ARMEmitter::VReg::v13, FEXCore::ARMEmitter::VReg::v14, FEXCore::ARMEmitter::VReg::v15
 };
 
+// 256-bit vectors when the host can't hold them in one register, both halves in consecutive RAFPR registers
+constexpr std::array<std::pair<FEXCore::ARMEmitter::VRegister, FEXCore::ARMEmitter::VRegister>, 6> RAFPRPair = {{
+  {FEXCore::ARMEmitter::VReg::v4,  FEXCore::ARMEmitter::VReg::v5},
+  {FEXCore::ARMEmitter::VReg::v6,  FEXCore::ARMEmitter::VReg::v7},
+  {FEXCore::ARMEmitter::VReg::v8,  FEXCore::ARMEmitter::VReg::v9},
+  {FEXCore::ARMEmitter::VReg::v10, FEXCore::ARMEmitter::VReg::v11},
+  {FEXCore::ARMEmitter::VReg::v12, FEXCore::ARMEmitter::VReg::v13},
+  {FEXCore::ARMEmitter::VReg::v14, FEXCore::ARMEmitter::VReg::v15},
+}};
+
 // Contains the address to the currently available CPU state
 constexpr auto STATE = FEXCore::ARMEmitter::XReg::x28;
 
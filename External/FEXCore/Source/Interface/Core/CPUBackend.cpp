@@ -2,9 +2,96 @@
 #include "Interface/Core/Dispatcher/Dispatcher.h"
 #include <FEXCore/Core/CPUBackend.h>
 
+#include <atomic>
+#include <cstring>
+#include <sys/mman.h>
+
 namespace FEXCore {
 namespace CPU {
 
+namespace {
+  /**
+   * Every compiled block is followed by a tail in the code buffer:
+   * | JITCodeTail | PC map |
+   *
+   * The PC map is a list of {ULEB128 host offset delta, SLEB128 guest offset delta} pairs, one per guest instruction,
+   * relative to the previous pair. The first pair is relative to the block entry and the block's guest RIP.
+   */
+  struct JITCodeTail {
+    uint64_t RIP;
+    uint32_t HostCodeSize;
+    uint32_t PCMapSize;
+  };
+
+  /**
+   * Index of the blocks in a code buffer, growing down from the end of the buffer while code grows up.
+   * Blocks are appended in address order, so the index stays sorted by HostOffset.
+   */
+  struct BlockIndexEntry {
+    uint32_t HostOffset;
+    uint32_t TailOffset;
+  };
+
+  // A 32-bit value needs at most 5 bytes in either encoding
+  constexpr size_t MaxLEB128Size = 5;
+
+  uint8_t *WriteULEB128(uint8_t *Cursor, uint32_t Value) {
+    do {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      *Cursor++ = Byte | (Value ? 0x80 : 0);
+    } while (Value);
+    return Cursor;
+  }
+
+  uint8_t *WriteSLEB128(uint8_t *Cursor, int32_t Value) {
+    while (true) {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      const bool Done = (Value == 0 && !(Byte & 0x40)) || (Value == -1 && (Byte & 0x40));
+      *Cursor++ = Byte | (Done ? 0 : 0x80);
+      if (Done) {
+        return Cursor;
+      }
+    }
+  }
+
+  uint32_t ReadULEB128(uint8_t const *&Cursor) {
+    uint32_t Value{};
+    uint32_t Shift{};
+    uint8_t Byte;
+    do {
+      Byte = *Cursor++;
+      Value |= static_cast<uint32_t>(Byte & 0x7F) << Shift;
+      Shift += 7;
+    } while (Byte & 0x80);
+    return Value;
+  }
+
+  int32_t ReadSLEB128(uint8_t const *&Cursor) {
+    uint32_t Value{};
+    uint32_t Shift{};
+    uint8_t Byte;
+    do {
+      Byte = *Cursor++;
+      Value |= static_cast<uint32_t>(Byte & 0x7F) << Shift;
+      Shift += 7;
+    } while (Byte & 0x80);
+
+    if (Shift < 32 && (Byte & 0x40)) {
+      // Sign extend
+      Value |= ~0U << Shift;
+    }
+    return static_cast<int32_t>(Value);
+  }
+
+  BlockIndexEntry GetBlockIndexEntry(CPUBackend::CodeBuffer const &Buffer, uint32_t Index) {
+    BlockIndexEntry Entry;
+    memcpy(&Entry, Buffer.Ptr + Buffer.Size - (Index + 1) * sizeof(BlockIndexEntry), sizeof(Entry));
+    return Entry;
+  }
+}
+
 CPUBackend::CPUBackend(FEXCore::Core::InternalThreadState *ThreadState, size_t InitialCodeSize, size_t MaxCodeSize)
     : ThreadState(ThreadState), InitialCodeSize(InitialCodeSize), MaxCodeSize(MaxCodeSize) {}
 
@@ -32,7 +119,11 @@ auto CPUBackend::GetEmptyCodeBuffer() -> CodeBuffer * {
       // Set the current code buffer to the initial
       CurrentCodeBuffer = &CodeBuffers[0];
 
-      if (CurrentCodeBuffer->Size != MaxCodeSize) {
+      if (CodeBuffersReleased) {
+        // Already emptied when it was released
+        CodeBuffersReleased = false;
+      }
+      else if (CurrentCodeBuffer->Size != MaxCodeSize) {
         FreeCodeBuffer(*CurrentCodeBuffer);
 
         // Resize the code buffer and reallocate our code size
@@ -41,6 +132,10 @@ auto CPUBackend::GetEmptyCodeBuffer() -> CodeBuffer * {
 
         *CurrentCodeBuffer = AllocateNewCodeBuffer(CurrentCodeBuffer->Size);
       }
+      else {
+        // Reusing the buffer, drop its blocks from the index
+        CurrentCodeBuffer->NumBlocks = 0;
+      }
     }
   } else {
     // We have signal handlers that have generated code
@@ -53,9 +148,28 @@ auto CPUBackend::GetEmptyCodeBuffer() -> CodeBuffer * {
   return CurrentCodeBuffer;
 }
 
+void CPUBackend::ReleaseCodeBuffers() {
+  if (CodeBuffers.empty()) {
+    return;
+  }
+
+  for (size_t i = 1; i < CodeBuffers.size(); i++) {
+    FreeCodeBuffer(CodeBuffers[i]);
+  }
+  CodeBuffers.resize(1);
+
+  CurrentCodeBuffer = &CodeBuffers[0];
+  CurrentCodeBuffer->NumBlocks = 0;
+
+  // Keep the mapping but let the kernel reclaim the pages until the buffer is written again
+  ::madvise(CurrentCodeBuffer->Ptr, CurrentCodeBuffer->Size, MADV_DONTNEED);
+  CodeBuffersReleased = true;
+}
+
 auto CPUBackend::AllocateNewCodeBuffer(size_t Size) -> CodeBuffer {
   CodeBuffer Buffer;
   Buffer.Size = Size;
+  Buffer.NumBlocks = 0;
   Buffer.Ptr = static_cast<uint8_t *>(
       FEXCore::Allocator::mmap(nullptr, Buffer.Size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
   LOGMAN_THROW_AA_FMT(!!Buffer.Ptr, "Couldn't allocate code buffer");
@@ -83,5 +197,110 @@ bool CPUBackend::IsAddressInCodeBuffer(uintptr_t Address) const {
   return false;
 }
 
+size_t CPUBackend::GetCodeBufferLimit() const {
+  // Leave room for the index entry of the next block
+  return CurrentCodeBuffer->Size - (CurrentCodeBuffer->NumBlocks + 1) * sizeof(BlockIndexEntry);
+}
+
+size_t CPUBackend::MaxBlockTailSize(uint32_t SSACount) {
+  // Each guest instruction is at least one IR node
+  return sizeof(JITCodeTail) + SSACount * MaxLEB128Size * 2;
+}
+
+size_t CPUBackend::EmitBlockTail(uint64_t Entry, uint8_t const *HostEntry, uint32_t HostCodeSize, uint8_t *Tail) {
+  uint8_t *Cursor = Tail + sizeof(JITCodeTail);
+
+  uint32_t PreviousHostOffset{};
+  int32_t PreviousGuestOffset{};
+  for (auto [HostOffset, GuestOffset] : PendingPCMap) {
+    Cursor = WriteULEB128(Cursor, HostOffset - PreviousHostOffset);
+    // Wrapping subtraction, the decoder wraps the same way
+    Cursor = WriteSLEB128(Cursor, static_cast<int32_t>(static_cast<uint32_t>(GuestOffset) - static_cast<uint32_t>(PreviousGuestOffset)));
+    PreviousHostOffset = HostOffset;
+    PreviousGuestOffset = GuestOffset;
+  }
+  PendingPCMap.clear();
+
+  const JITCodeTail CodeTail {
+    .RIP = Entry,
+    .HostCodeSize = HostCodeSize,
+    .PCMapSize = static_cast<uint32_t>(Cursor - Tail - sizeof(JITCodeTail)),
+  };
+  memcpy(Tail, &CodeTail, sizeof(CodeTail));
+
+  auto Buffer = CurrentCodeBuffer;
+  const BlockIndexEntry IndexEntry {
+    .HostOffset = static_cast<uint32_t>(HostEntry - Buffer->Ptr),
+    .TailOffset = static_cast<uint32_t>(Tail - Buffer->Ptr),
+  };
+  memcpy(Buffer->Ptr + Buffer->Size - (Buffer->NumBlocks + 1) * sizeof(BlockIndexEntry), &IndexEntry, sizeof(IndexEntry));
+
+  // Lookups only happen from signal handlers on this thread, the entry must be visible before the count is
+  std::atomic_signal_fence(std::memory_order_release);
+  ++Buffer->NumBlocks;
+
+  return Cursor - Tail;
+}
+
+std::optional<uint64_t> CPUBackend::GetGuestRIPForHostPC(uintptr_t HostPC, uint64_t *BlockRIP) const {
+  for (auto &Buffer: CodeBuffers) {
+    const auto Start = reinterpret_cast<uintptr_t>(Buffer.Ptr);
+    if (HostPC < Start || HostPC >= (Start + Buffer.Size)) {
+      continue;
+    }
+
+    const uint32_t Offset = HostPC - Start;
+    const uint32_t NumBlocks = Buffer.NumBlocks;
+    std::atomic_signal_fence(std::memory_order_acquire);
+
+    // Find the last block starting at or before the PC
+    uint32_t Low = 0, High = NumBlocks;
+    while (Low < High) {
+      const uint32_t Middle = Low + (High - Low) / 2;
+      if (GetBlockIndexEntry(Buffer, Middle).HostOffset <= Offset) {
+        Low = Middle + 1;
+      }
+      else {
+        High = Middle;
+      }
+    }
+
+    if (Low == 0) {
+      return std::nullopt;
+    }
+
+    const auto IndexEntry = GetBlockIndexEntry(Buffer, Low - 1);
+    JITCodeTail CodeTail;
+    memcpy(&CodeTail, Buffer.Ptr + IndexEntry.TailOffset, sizeof(CodeTail));
+
+    const uint32_t PCOffset = Offset - IndexEntry.HostOffset;
+    if (PCOffset >= CodeTail.HostCodeSize) {
+      // In a tail or padding between blocks
+      return std::nullopt;
+    }
+
+    uint8_t const *Map = Buffer.Ptr + IndexEntry.TailOffset + sizeof(JITCodeTail);
+    uint8_t const *MapEnd = Map + CodeTail.PCMapSize;
+    uint32_t HostOffset{};
+    uint32_t GuestOffset{};
+    while (Map < MapEnd) {
+      HostOffset += ReadULEB128(Map);
+      const auto GuestDelta = ReadSLEB128(Map);
+      if (HostOffset > PCOffset) {
+        break;
+      }
+      GuestOffset += static_cast<uint32_t>(GuestDelta);
+    }
+
+    if (BlockRIP) {
+      *BlockRIP = CodeTail.RIP;
+    }
+
+    return CodeTail.RIP + static_cast<int32_t>(GuestOffset);
+  }
+
+  return std::nullopt;
+}
+
 }
 }
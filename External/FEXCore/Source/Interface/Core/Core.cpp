@@ -23,6 +23,7 @@ $end_info$
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/Passes.h"
 #include "Interface/IR/PassManager.h"
+#include "Utils/ScratchArena.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CodeLoader.h>
@@ -31,6 +32,7 @@ $end_info$
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/Core/SignalDelegator.h>
 #include <FEXCore/Core/X86Enums.h>
+#include <FEXCore/Debug/ContextDebug.h>
 #include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Debug/X86Tables.h>
 #include <FEXCore/HLE/SyscallHandler.h>
@@ -155,15 +157,22 @@ namespace FEXCore::Context {
     if (Config.CacheObjectCodeCompilation() != FEXCore::Config::ConfigObjectCodeHandler::CONFIG_NONE) {
       CodeObjectCacheService = std::make_unique<FEXCore::CodeSerialize::CodeObjectSerializeService>(this);
     }
+    if (Config.AVXRegisterPairing()) {
+      // Emulate AVX registers with pairs of 128-bit host registers, even on 128-bit hosts.
+      HostFeatures.SupportsAVX = true;
+      HostFeatures.SupportsSVE256 = false;
+    }
     if (!Config.EnableAVX) {
       HostFeatures.SupportsAVX = false;
     }
+    if (!HostFeatures.SupportsAVX) {
+      HostFeatures.SupportsSVE256 = false;
+    }
 
-    if (Config.BlockJITNaming() ||
-        Config.GlobalJITNaming() ||
-        Config.LibraryJITNaming()) {
+    const bool PerfMap = Config.BlockJITNaming() || Config.GlobalJITNaming() || Config.LibraryJITNaming();
+    if (PerfMap || Config.PerfJITDump()) {
       // Only initialize symbols file if enabled. Ensures we don't pollute /tmp with empty files.
-      Symbols.InitFile();
+      Symbols.InitFile(PerfMap, Config.PerfJITDump());
     }
   }
 
@@ -179,10 +188,18 @@ namespace FEXCore::Context {
         }
       }
 
+      // Stop the profiler thread before the thread data it is draining goes away
+      Profiler.reset();
+
       for (auto &Thread : Threads) {
         delete Thread;
       }
       Threads.clear();
+
+      for (auto &Thread : ThreadStatePool) {
+        delete Thread;
+      }
+      ThreadStatePool.clear();
     }
   }
 
@@ -255,6 +272,12 @@ namespace FEXCore::Context {
 
     SignalDelegation->RegisterHostSignalHandler(SignalDelegator::SIGNAL_FOR_PAUSE, PauseHandler, true);
 
+    if (!Config.GuestProfile().empty() || !Config.HotTraceCapture().empty()) {
+      Profiler = std::make_unique<FEXCore::GuestProfiler>(this);
+      // Not required, the guest can still mask SIGPROF and use it for its own timers
+      SignalDelegation->RegisterHostSignalHandler(SIGPROF, FEXCore::GuestProfiler::HandleSignal, false);
+    }
+
     auto GuestSignalHandler = [](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack) -> bool {
       return Thread->CTX->Dispatcher->HandleGuestSignal(Thread, Signal, info, ucontext, GuestAction, GuestStack);
     };
@@ -478,6 +501,14 @@ namespace FEXCore::Context {
 
       // Don't return if a custom exit handling the exit
       if (!CustomExitHandler || reason == ExitReason::EXIT_SHUTDOWN) {
+        if (Profiler) {
+          // Needs to happen while the syscall handler is still around to resolve guest files
+          Profiler->WriteProfile();
+        }
+
+        if (Config.CompileStats()) {
+          DumpCompileStats();
+        }
         return reason;
       }
     }
@@ -542,8 +573,10 @@ namespace FEXCore::Context {
     Thread->OpDispatcher = std::make_unique<FEXCore::IR::OpDispatchBuilder>(this);
     Thread->OpDispatcher->SetMultiblock(Config.Multiblock);
     Thread->LookupCache = std::make_unique<FEXCore::LookupCache>(this);
-    Thread->FrontendDecoder = std::make_unique<FEXCore::Frontend::Decoder>(this);
+    Thread->CompileScratch = std::make_unique<FEXCore::Utils::ScratchArena>();
+    Thread->FrontendDecoder = std::make_unique<FEXCore::Frontend::Decoder>(this, Thread->CompileScratch.get());
     Thread->PassManager = std::make_unique<FEXCore::IR::PassManager>();
+    Thread->PassManager->RegisterScratchArena(Thread->CompileScratch.get());
     Thread->PassManager->RegisterExitHandler([this]() {
         Stop(false /* Ignore current thread */);
     });
@@ -570,7 +603,8 @@ namespace FEXCore::Context {
       break;
 #endif
     case FEXCore::Config::CONFIG_IRJIT:
-      Thread->PassManager->InsertRegisterAllocationPass(DoSRA, HostFeatures.SupportsAVX);
+      Thread->PassManager->InsertRegisterAllocationPass(DoSRA, HostFeatures.SupportsAVX,
+        BackendFeatures.SupportsFPRPairs && HostFeatures.SupportsAVX && !HostFeatures.SupportsSVE256);
 
 #if (_M_X86_64 && JIT_X86_64)
       Thread->CPUBackend = FEXCore::CPU::CreateX86JITCore(this, Thread);
@@ -588,10 +622,159 @@ namespace FEXCore::Context {
       ERROR_AND_DIE_FMT("Unknown core configuration");
       break;
     }
+
+    Thread->PassManager->RegisterRuntimeStats(&Thread->Stats);
+  }
+
+  static void ResetRuntimeStats(FEXCore::Core::RuntimeStats *Stats) {
+    Stats->InstructionsExecuted = 0;
+    Stats->BlocksCompiled = 0;
+    Stats->DecodeNS = 0;
+    Stats->DispatchNS = 0;
+    Stats->PassesNS = 0;
+    Stats->BackendNS = 0;
+    Stats->RelocationNS = 0;
+    Stats->GuestInstructionsCompiled = 0;
+    Stats->HostCodeSize = 0;
+    Stats->BlocksRelocated = 0;
+    Stats->DecodeCacheHits = 0;
+    Stats->DecodeCacheNSSaved = 0;
+
+    // The pass list stays the same, the PassManager still points at these
+    for (auto &Pass : Stats->Passes) {
+      Pass.TimeNS = 0;
+      Pass.NodesIn = 0;
+      Pass.NodesOut = 0;
+    }
+  }
+
+  static void AddRuntimeStats(FEXCore::Core::RuntimeStats *Totals, FEXCore::Core::RuntimeStats const &Stats) {
+    Totals->InstructionsExecuted += Stats.InstructionsExecuted;
+    Totals->BlocksCompiled += Stats.BlocksCompiled;
+    Totals->DecodeNS += Stats.DecodeNS;
+    Totals->DispatchNS += Stats.DispatchNS;
+    Totals->PassesNS += Stats.PassesNS;
+    Totals->BackendNS += Stats.BackendNS;
+    Totals->RelocationNS += Stats.RelocationNS;
+    Totals->GuestInstructionsCompiled += Stats.GuestInstructionsCompiled;
+    Totals->HostCodeSize += Stats.HostCodeSize;
+    Totals->BlocksRelocated += Stats.BlocksRelocated;
+    Totals->DecodeCacheHits += Stats.DecodeCacheHits;
+    Totals->DecodeCacheNSSaved += Stats.DecodeCacheNSSaved;
+
+    // Every thread runs the same passes
+    if (Totals->Passes.size() < Stats.Passes.size()) {
+      std::vector<FEXCore::Core::PassRuntimeStats> Passes(Stats.Passes.size());
+      for (size_t i = 0; i < Totals->Passes.size(); ++i) {
+        Passes[i].TimeNS = Totals->Passes[i].TimeNS.load();
+        Passes[i].NodesIn = Totals->Passes[i].NodesIn.load();
+        Passes[i].NodesOut = Totals->Passes[i].NodesOut.load();
+      }
+      Totals->Passes = std::move(Passes);
+    }
+
+    for (size_t i = 0; i < Stats.Passes.size(); ++i) {
+      auto &Pass = Totals->Passes[i];
+      Pass.Name = Stats.Passes[i].Name;
+      Pass.TimeNS += Stats.Passes[i].TimeNS;
+      Pass.NodesIn += Stats.Passes[i].NodesIn;
+      Pass.NodesOut += Stats.Passes[i].NodesOut;
+    }
+  }
+
+  FEXCore::Core::InternalThreadState* Context::AcquireThreadState() {
+    std::lock_guard lk(ThreadCreationMutex);
+    if (ThreadStatePool.empty()) {
+      return nullptr;
+    }
+
+    auto Thread = ThreadStatePool.back();
+    ThreadStatePool.pop_back();
+    return Thread;
+  }
+
+  bool Context::ReleaseThreadState(FEXCore::Core::InternalThreadState *Thread) {
+    const size_t MaxPoolSize = Config.ThreadStatePool;
+
+    {
+      std::lock_guard lk(ThreadCreationMutex);
+      if (ThreadStatePool.size() >= MaxPoolSize) {
+        return false;
+      }
+    }
+
+    // Threads that never got a compiler can't be reused cheaply
+    if (!Thread->CPUBackend || !Thread->LookupCache) {
+      return false;
+    }
+
+    {
+      // Parked states don't see invalidations, so all code goes now instead of on reuse
+      std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
+
+      Thread->LookupCache->ClearCache();
+      Thread->CPUBackend->ReleaseCodeBuffers();
+      Thread->DebugStore.clear();
+      Thread->FrontendDecoder->ClearDecodeCache();
+    }
+
+    Thread->CompileScratch->Reset();
+    // Flushes any pending symbols, the next thread gets a new buffer
+    Thread->SymbolBuffer.reset();
+
+    Thread->RunningEvents.Running = false;
+    Thread->RunningEvents.WaitingToStart = true;
+    Thread->RunningEvents.EarlyExit = false;
+    Thread->RunningEvents.ThreadSleeping = false;
+    Thread->SignalReason = FEXCore::Core::SignalEvent::Nothing;
+
+    // The host thread has exited or is past its last use of these
+    Thread->ExecutionThread.reset();
+    Thread->StartPaused = false;
+    Thread->StartRunning.Reset();
+    Thread->ThreadWaiting.Reset();
+
+    // ThreadManagement isn't assignable because of the atomic TID
+    Thread->ThreadManager.UID = 1000;
+    Thread->ThreadManager.GID = 1000;
+    Thread->ThreadManager.EUID = 1000;
+    Thread->ThreadManager.EGID = 1000;
+    Thread->ThreadManager.TID = 1;
+    Thread->ThreadManager.PID = 1;
+    Thread->ThreadManager.set_child_tid = nullptr;
+    Thread->ThreadManager.clear_child_tid = nullptr;
+    Thread->ThreadManager.parent_tid = 0;
+    Thread->ThreadManager.robust_list_head = 0;
+
+    ResetRuntimeStats(&Thread->Stats);
+    Thread->LastCompile = {};
+
+    Thread->StatusCode = 0;
+    Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_WAITING;
+    Thread->CompileService.reset();
+    Thread->DestroyedByParent = false;
+
+    // Pointers stay valid, the lookup cache and dispatcher keep their mappings
+    Thread->CurrentFrame->ReturningStackLocation = 0;
+    Thread->CurrentFrame->InSyscallInfo = 0;
+    Thread->CurrentFrame->SignalHandlerRefCounter = 0;
+    Thread->CurrentFrame->SynchronousFaultData = {};
+
+    std::lock_guard lk(ThreadCreationMutex);
+    if (ThreadStatePool.size() >= MaxPoolSize) {
+      // Another thread filled the pool in the meantime
+      return false;
+    }
+    ThreadStatePool.push_back(Thread);
+    return true;
   }
 
   FEXCore::Core::InternalThreadState* Context::CreateThread(FEXCore::Core::CPUState *NewThreadState, uint64_t ParentTID) {
-    FEXCore::Core::InternalThreadState *Thread = new FEXCore::Core::InternalThreadState{};
+    FEXCore::Core::InternalThreadState *Thread = AcquireThreadState();
+    const bool Recycled = Thread != nullptr;
+    if (!Recycled) {
+      Thread = new FEXCore::Core::InternalThreadState{};
+    }
 
     // Copy over the new thread state to the new object
     memcpy(Thread->CurrentFrame, NewThreadState, sizeof(FEXCore::Core::CPUState));
@@ -600,8 +783,18 @@ namespace FEXCore::Context {
     // Set up the thread manager state
     Thread->ThreadManager.parent_tid = ParentTID;
 
-    InitializeCompiler(Thread);
-    InitializeThreadData(Thread);
+    if (Recycled) {
+      // Picks the released code buffer back up
+      Thread->CPUBackend->ClearCache();
+    }
+    else {
+      InitializeCompiler(Thread);
+      InitializeThreadData(Thread);
+    }
+
+    if (Symbols.IsEnabled()) {
+      Thread->SymbolBuffer = std::make_unique<FEXCore::JITSymbolBuffer>(&Symbols);
+    }
 
     // Insert after the Thread object has been fully initialized
     {
@@ -613,6 +806,12 @@ namespace FEXCore::Context {
   }
 
   void Context::DestroyThread(FEXCore::Core::InternalThreadState *Thread) {
+    if (Thread->CompileScratch) {
+      auto ScratchStats = Thread->CompileScratch->GetStats();
+      LogMan::Msg::DFmt("Thread compiled {} blocks with {} scratch allocations, {} of which went to the heap",
+        Thread->Stats.BlocksCompiled.load(), ScratchStats.Allocations, ScratchStats.HeapAllocations);
+    }
+
     // remove new thread object
     {
       std::lock_guard lk(ThreadCreationMutex);
@@ -621,6 +820,9 @@ namespace FEXCore::Context {
       LOGMAN_THROW_A_FMT(It != Threads.end(), "Thread wasn't in Threads");
 
       Threads.erase(It);
+
+      // Pooled states get their stats reset on reuse, keep what this thread did
+      AddRuntimeStats(&ExitedThreadStats, Thread->Stats);
     }
 
     if (Thread->ExecutionThread &&
@@ -628,6 +830,10 @@ namespace FEXCore::Context {
       // To be able to delete a thread from itself, we need to detached the std::thread object
       Thread->ExecutionThread->detach();
     }
+
+    if (ReleaseThreadState(Thread)) {
+      return;
+    }
     delete Thread;
   }
 
@@ -668,6 +874,64 @@ namespace FEXCore::Context {
 
     // Clean up dead stacks
     FEXCore::Threads::Thread::CleanupAfterFork();
+
+    // Symbol files are per process
+    Symbols.CleanupAfterFork();
+
+    IRCaptureCache.CleanupAfterFork();
+
+    if (Profiler) {
+      // The profiler thread didn't survive the fork and might have been holding its locks, leave the old one be.
+      // Timers aren't inherited either, so restart sampling for the live thread in a fresh profiler.
+      Profiler.release();
+      Profiler = std::make_unique<FEXCore::GuestProfiler>(this);
+      Profiler->StartThread(LiveThread);
+    }
+  }
+
+  void Context::DumpCompileStats() {
+    FEXCore::Core::RuntimeStats Totals{};
+    {
+      std::lock_guard lk(ThreadCreationMutex);
+      AddRuntimeStats(&Totals, ExitedThreadStats);
+      for (auto Thread : Threads) {
+        AddRuntimeStats(&Totals, Thread->Stats);
+      }
+    }
+
+    const uint64_t Blocks = Totals.BlocksCompiled;
+    const uint64_t Relocated = Totals.BlocksRelocated;
+    const uint64_t GuestInstructions = Totals.GuestInstructionsCompiled;
+    const uint64_t HostCodeSize = Totals.HostCodeSize;
+    const uint64_t DecodeCacheHits = Totals.DecodeCacheHits;
+    const uint64_t DecodeCacheNSSaved = Totals.DecodeCacheNSSaved;
+    const uint64_t DecodeNS = Totals.DecodeNS;
+    const uint64_t DispatchNS = Totals.DispatchNS;
+    const uint64_t PassesNS = Totals.PassesNS;
+    const uint64_t BackendNS = Totals.BackendNS;
+    const uint64_t RelocationNS = Totals.RelocationNS;
+
+    const uint64_t TotalNS = DecodeNS + DispatchNS + PassesNS + BackendNS + RelocationNS;
+    auto Line = [TotalNS](std::string_view Name, uint64_t NS) {
+      return fmt::format("  {:<24} {:>10.3f} ms {:>6.2f}%\n", Name, NS / 1'000'000.0, TotalNS ? NS * 100.0 / TotalNS : 0.0);
+    };
+
+    std::string Output = fmt::format("Compiled {} blocks, {} guest instructions to {} bytes of host code, {} blocks from the code cache\n",
+      Blocks, GuestInstructions, HostCodeSize, Relocated);
+    Output += Line("Decode", DecodeNS);
+    Output += fmt::format("    {:<22} {:>10.3f} ms saved, {} instructions from the decode cache\n", "Decode cache",
+      DecodeCacheNSSaved / 1'000'000.0, DecodeCacheHits);
+    Output += Line("Dispatch", DispatchNS);
+    Output += Line("Passes", PassesNS);
+    for (auto const &Pass : Totals.Passes) {
+      const uint64_t PassNS = Pass.TimeNS;
+      Output += fmt::format("    {:<22} {:>10.3f} ms {:>6.2f}%  {} -> {} nodes\n", Pass.Name, PassNS / 1'000'000.0,
+        TotalNS ? PassNS * 100.0 / TotalNS : 0.0, Pass.NodesIn.load(), Pass.NodesOut.load());
+    }
+    Output += Line("Backend", BackendNS);
+    Output += Line("Relocation", RelocationNS);
+
+    LogMan::Msg::IFmt("{}", Output);
   }
 
   void Context::AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr) {
@@ -684,9 +948,18 @@ namespace FEXCore::Context {
     }
     std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
 
+    if (Profiler) {
+      Profiler->BeginCodeBufferChange(Thread);
+    }
+
+    // The decode cache stays, the guest code didn't change and recompiling it can reuse the decoded instructions
     Thread->LookupCache->ClearCache();
     Thread->CPUBackend->ClearCache();
     Thread->DebugStore.clear();
+
+    if (Profiler) {
+      Profiler->EndCodeBufferChange(Thread);
+    }
   }
 
   static void IRDumper(FEXCore::Core::InternalThreadState *Thread, IR::IREmitter *IREmitter, uint64_t GuestRIP, IR::RegisterAllocationData* RA) {
@@ -743,8 +1016,38 @@ namespace FEXCore::Context {
     }
   }
 
-  Context::GenerateIRResult Context::GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool ExtendedDebugInfo) {
+  static uint64_t ElapsedNS(std::chrono::steady_clock::time_point Begin, std::chrono::steady_clock::time_point End) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count();
+  }
+
+  static void AccumulateCompileStats(FEXCore::Core::InternalThreadState *Thread) {
+    // Only ever written by the owning thread, relaxed is enough for readers wanting a rough total
+    auto const &Last = Thread->LastCompile;
+    auto &Stats = Thread->Stats;
+
+    if (Last.DecodeCacheHits && Stats.GuestInstructionsCompiled > Stats.DecodeCacheHits) {
+      // Hits cost next to nothing, so each one saved what an instruction took to decode on average so far
+      const uint64_t Decoded = Stats.GuestInstructionsCompiled - Stats.DecodeCacheHits;
+      Stats.DecodeCacheNSSaved.fetch_add(Last.DecodeCacheHits * Stats.DecodeNS / Decoded, std::memory_order_relaxed);
+    }
+    Stats.DecodeCacheHits.fetch_add(Last.DecodeCacheHits, std::memory_order_relaxed);
+
+    Stats.DecodeNS.fetch_add(Last.DecodeNS, std::memory_order_relaxed);
+    Stats.DispatchNS.fetch_add(Last.DispatchNS, std::memory_order_relaxed);
+    Stats.PassesNS.fetch_add(Last.PassesNS, std::memory_order_relaxed);
+    Stats.BackendNS.fetch_add(Last.BackendNS, std::memory_order_relaxed);
+    Stats.RelocationNS.fetch_add(Last.RelocationNS, std::memory_order_relaxed);
+    Stats.GuestInstructionsCompiled.fetch_add(Last.GuestInstructions, std::memory_order_relaxed);
+    Stats.HostCodeSize.fetch_add(Last.HostCodeSize, std::memory_order_relaxed);
+  }
+
+  Context::GenerateIRResult Context::GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
     FEXCORE_PROFILE_SCOPED("GenerateIR");
+    auto &Stats = Thread->LastCompile;
+    auto DispatchBegin = std::chrono::steady_clock::now();
+
+    // Everything from the previous compilation has released its scratch memory by now
+    Thread->CompileScratch->Reset();
 
     Thread->OpDispatcher->ReownOrClaimBuffer();
     Thread->OpDispatcher->ResetWorkingList();
@@ -774,8 +1077,38 @@ namespace FEXCore::Context {
         }
       });
 
+      const auto DecodeEnd = std::chrono::steady_clock::now();
+      Stats.DecodeNS = ElapsedNS(DispatchBegin, DecodeEnd);
+      Stats.DecodeCacheHits = Thread->FrontendDecoder->DecodeCacheHits;
+      DispatchBegin = DecodeEnd;
+
       auto CodeBlocks = Thread->FrontendDecoder->GetDecodedBlocks();
 
+      if (Config.AOTIRGenerate() && Config.AOTIRIncremental()) {
+        // The decoder already collected the branch targets, only the IR of unchanged code can be skipped
+        const uint64_t StartAddr = Thread->FrontendDecoder->DecodedMinAddress;
+        const uint64_t Length = Thread->FrontendDecoder->DecodedMaxAddress - StartAddr;
+        IR::IRListView *IRList{};
+        IR::RegisterAllocationData::UniquePtr RAData{};
+        if (StartAddr == GuestRIP && IRCaptureCache.FetchByGuestHash(GuestRIP, Length, &IRList, &RAData)) {
+          for (auto &Block : *CodeBlocks) {
+            TotalInstructions += Block.NumInstructions;
+          }
+
+          Thread->FrontendDecoder->DelayedDisownBuffer();
+          Thread->OpDispatcher->DelayedDisownBuffer();
+
+          return {
+            .IRList = IRList,
+            .RAData = std::move(RAData),
+            .TotalInstructions = TotalInstructions,
+            .TotalInstructionsLength = Length,
+            .StartAddr = StartAddr,
+            .Length = Length,
+          };
+        }
+      }
+
       Thread->OpDispatcher->BeginFunction(GuestRIP, CodeBlocks);
 
       const uint8_t GPRSize = GetGPRSize();
@@ -807,9 +1140,8 @@ namespace FEXCore::Context {
           DecodedInfo = &Block.DecodedInstructions[i];
           bool IsLocked = DecodedInfo->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK;
 
-          if (ExtendedDebugInfo) {
-            Thread->OpDispatcher->_GuestOpcode(Block.Entry + BlockInstructionsLength - GuestRIP);
-          }
+          // Instruction boundary for the block's PC map
+          Thread->OpDispatcher->_GuestOpcode(Block.Entry + BlockInstructionsLength - GuestRIP);
 
           if (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
             auto ExistingCodePtr = reinterpret_cast<uint64_t*>(Block.Entry + BlockInstructionsLength);
@@ -832,8 +1164,8 @@ namespace FEXCore::Context {
             Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
           }
 
-          if (TableInfo && TableInfo->OpcodeDispatcher) {
-            auto Fn = TableInfo->OpcodeDispatcher;
+          auto Fn = TableInfo ? Thread->OpDispatcher->GetDispatcher(TableInfo) : nullptr;
+          if (Fn) {
             Thread->OpDispatcher->HandledLock = false;
             Thread->OpDispatcher->ResetDecodeFailure();
             std::invoke(Fn, Thread->OpDispatcher, DecodedInfo);
@@ -843,7 +1175,7 @@ namespace FEXCore::Context {
             else {
               if (Thread->OpDispatcher->HandledLock != IsLocked) {
                 HadDispatchError = true;
-                LogMan::Msg::EFmt("Missing LOCK HANDLER at 0x{:x}{{'{}'}}", Block.Entry + BlockInstructionsLength, TableInfo->Name ?: "UND");
+                LogMan::Msg::EFmt("Missing LOCK HANDLER at 0x{:x}{{'{}'}}", Block.Entry + BlockInstructionsLength, TableInfo->Name[0] ? TableInfo->Name : "UND");
               }
               BlockInstructionsLength += DecodedInfo->InstSize;
               TotalInstructionsLength += DecodedInfo->InstSize;
@@ -901,8 +1233,14 @@ namespace FEXCore::Context {
     }
 
     // Run the passmanager over the IR from the dispatcher
+    const auto PassesBegin = std::chrono::steady_clock::now();
+    Stats.DispatchNS = ElapsedNS(DispatchBegin, PassesBegin);
+    Stats.GuestInstructions = TotalInstructions;
+
     Thread->PassManager->Run(IREmitter);
 
+    Stats.PassesNS = ElapsedNS(PassesBegin, std::chrono::steady_clock::now());
+
     // Debug
     {
       if (ShouldDump) {
@@ -933,12 +1271,29 @@ namespace FEXCore::Context {
     uint64_t StartAddr {};
     uint64_t Length {};
 
+    Thread->LastCompile = {};
+
     // JIT Code object cache lookup
-    if (CodeObjectCacheService) {
+    // Cached code doesn't contain the gdb pause check
+    if (CodeObjectCacheService && !GetGdbServerStatus()) {
       auto CodeCacheEntry = CodeObjectCacheService->FetchCodeObjectFromCache(GuestRIP);
       if (CodeCacheEntry) {
+        const auto RelocationBegin = std::chrono::steady_clock::now();
         auto CompiledCode = Thread->CPUBackend->RelocateJITObjectCode(GuestRIP, CodeCacheEntry);
+        // Failed relocations are accounted for with the compilation that follows
+        Thread->LastCompile.RelocationNS = ElapsedNS(RelocationBegin, std::chrono::steady_clock::now());
+
         if (CompiledCode) {
+          Thread->Stats.BlocksRelocated.fetch_add(1, std::memory_order_relaxed);
+          AccumulateCompileStats(Thread);
+
+          // The frontend didn't run, so mark the guest code as executable here for SMC tracking
+          const uint64_t CodeStart = GuestRIP + CodeCacheEntry->Data->GuestCodeOffset;
+          const uint64_t CodeLength = CodeCacheEntry->Data->GuestCodeLength;
+          if (Thread->LookupCache->AddBlockExecutableRange(GuestRIP, CodeStart, CodeLength)) {
+            SyscallHandler->MarkGuestExecutableRange(CodeStart, CodeLength);
+          }
+
           return {
               .CompiledCode = CompiledCode,
               .IRData = nullptr,    // No IR data generated
@@ -976,7 +1331,7 @@ namespace FEXCore::Context {
 
     if (IRList == nullptr) {
       // Generate IR + Meta Info
-      auto [IRCopy, RACopy, TotalInstructions, TotalInstructionsLength, _StartAddr, _Length] = GenerateIR(Thread, GuestRIP, Config.GDBSymbols());
+      auto [IRCopy, RACopy, TotalInstructions, TotalInstructionsLength, _StartAddr, _Length] = GenerateIR(Thread, GuestRIP);
 
       // Setup pointers to internal structures
       IRList = IRCopy;
@@ -995,9 +1350,17 @@ namespace FEXCore::Context {
     if (IRList == nullptr) {
       return {};
     }
+
     // Attempt to get the CPU backend to compile this code
+    const auto BackendBegin = std::chrono::steady_clock::now();
+    auto CompiledCode = Thread->CPUBackend->CompileCode(GuestRIP, IRList, DebugData, RAData.get(), GetGdbServerStatus());
+    Thread->LastCompile.BackendNS = ElapsedNS(BackendBegin, std::chrono::steady_clock::now());
+    Thread->LastCompile.IRNodes = IRList->GetSSACount();
+    Thread->LastCompile.HostCodeSize = DebugData->HostCodeSize;
+    AccumulateCompileStats(Thread);
+
     return {
-      .CompiledCode = Thread->CPUBackend->CompileCode(GuestRIP, IRList, DebugData, RAData.get(), GetGdbServerStatus()),
+      .CompiledCode = CompiledCode,
       .IRData = IRList,
       .DebugData = DebugData,
       .RAData = std::move(RAData),
@@ -1038,6 +1401,9 @@ namespace FEXCore::Context {
     bool GeneratedIR {};
     uint64_t StartAddr {}, Length {};
 
+    // Memory only ever becomes shared, sampling before compiling errs on the side of the code lacking TSO
+    const bool TSOEnabled = IsTSOEnabled();
+
     auto [Code, IR, Data, RAData, Generated, _StartAddr, _Length] = CompileCode(Thread, GuestRIP);
     CodePtr = Code;
     IRList = IR;
@@ -1050,28 +1416,36 @@ namespace FEXCore::Context {
       return 0;
     }
 
+    if (Profiler && Profiler->CapturesHotTrace()) {
+      std::shared_lock CustomIRLock(CustomIRMutex);
+      // Custom IR has no guest code to replay
+      if (!CustomIRHandlers.contains(GuestRIP)) {
+        Profiler->RecordBlock(GuestRIP, StartAddr, Length);
+      }
+    }
+
     // The core managed to compile the code.
-    if (Config.BlockJITNaming()) {
+    if ((Config.BlockJITNaming() || Config.PerfJITDump()) && Thread->SymbolBuffer) {
       auto FragmentBasePtr = reinterpret_cast<uint8_t *>(CodePtr);
 
       if (DebugData) {
         auto GuestRIPLookup = SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
+        std::string_view Filename, FileId;
+        if (GuestRIPLookup.Entry) {
+          Filename = GuestRIPLookup.Entry->Filename;
+          FileId = GuestRIPLookup.Entry->FileId;
+        }
+
+        auto RegisterBlock = [&](const void *HostAddr, uint32_t HostSize) {
+          Symbols.RegisterBlock(Thread->SymbolBuffer.get(), HostAddr, HostSize, GuestRIP, Filename, FileId, GuestRIP - GuestRIPLookup.VAFileStart);
+        };
 
         if (DebugData->Subblocks.size()) {
           for (auto& Subblock: DebugData->Subblocks) {
-            auto BlockBasePtr = FragmentBasePtr + Subblock.HostCodeOffset;
-            if (GuestRIPLookup.Entry) {
-              Symbols.Register(BlockBasePtr, DebugData->HostCodeSize, GuestRIPLookup.Entry->Filename, GuestRIP - GuestRIPLookup.VAFileStart);
-            } else {
-              Symbols.Register(BlockBasePtr, GuestRIP, Subblock.HostCodeSize);
-            }
+            RegisterBlock(FragmentBasePtr + Subblock.HostCodeOffset, Subblock.HostCodeSize);
           }
         } else {
-          if (GuestRIPLookup.Entry) {
-            Symbols.Register(FragmentBasePtr, DebugData->HostCodeSize, GuestRIPLookup.Entry->Filename, GuestRIP - GuestRIPLookup.VAFileStart);
-        } else {
-          Symbols.Register(FragmentBasePtr, GuestRIP, DebugData->HostCodeSize);
-          }
+          RegisterBlock(FragmentBasePtr, DebugData->HostCodeSize);
         }
       }
     }
@@ -1079,15 +1453,17 @@ namespace FEXCore::Context {
     // Tell the object cache service to serialize the code if enabled
     if (CodeObjectCacheService &&
         Config.CacheObjectCodeCompilation == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_READWRITE &&
-        DebugData) {
+        DebugData && !GetGdbServerStatus()) {
       CodeObjectCacheService->AsyncAddSerializationJob(std::make_unique<CodeSerialize::AsyncJobHandler::SerializationJobData>(
         CodeSerialize::AsyncJobHandler::SerializationJobData {
           .GuestRIP = GuestRIP,
+          .GuestCodeStart = StartAddr,
           .GuestCodeLength = Length,
           .GuestCodeHash = 0,
           .HostCodeBegin = CodePtr,
           .HostCodeLength = DebugData->HostCodeSize,
           .HostCodeHash = 0,
+          .TSOEnabled = TSOEnabled,
           .ThreadJobRefCount = &Thread->ObjectCacheRefCounter,
           .Relocations = std::move(*DebugData->Relocations),
         }
@@ -1141,9 +1517,22 @@ namespace FEXCore::Context {
 
       Thread->RunningEvents.Running = true;
 
+      if (Profiler) {
+        Profiler->StartThread(Thread);
+      }
+
       Thread->CTX->Dispatcher->ExecuteDispatch(Thread->CurrentFrame);
 
+      if (Profiler) {
+        Profiler->StopThread(Thread);
+      }
+
       Thread->RunningEvents.Running = false;
+
+      // Don't leave symbols sitting in the buffer until the thread state is deleted
+      if (Thread->SymbolBuffer) {
+        Symbols.Flush(Thread->SymbolBuffer.get());
+      }
     }
 
     {
@@ -1178,6 +1567,9 @@ namespace FEXCore::Context {
   static void InvalidateGuestThreadCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length) {
     std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
 
+    // Compilation holds CodeInvalidationMutex shared, so the thread can't be decoding right now
+    Thread->FrontendDecoder->InvalidateDecodeCache(Start, Length);
+
     auto lower = Thread->LookupCache->CodePages.lower_bound(Start >> 12);
     auto upper = Thread->LookupCache->CodePages.upper_bound((Start + Length - 1) >> 12);
 
@@ -1276,17 +1668,46 @@ namespace FEXCore::Context {
   }
 
   // Debug interface
-  void Context::CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
+  bool Context::CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
     uint64_t RIPBackup = Thread->CurrentFrame->State.rip;
     Thread->CurrentFrame->State.rip = RIP;
 
     // Erase the RIP from all the storage backings if it exists
     ThreadRemoveCodeEntry(Thread, RIP);
 
-    // We don't care if compilation passes or not
-    CompileBlock(Thread->CurrentFrame, RIP);
+    const bool Compiled = CompileBlock(Thread->CurrentFrame, RIP) != 0;
 
     Thread->CurrentFrame->State.rip = RIPBackup;
+    return Compiled;
+  }
+
+  void Context::DecodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length, FEXCore::Context::Debug::DecodeRangeStats *Stats) {
+    auto Decoder = Thread->FrontendDecoder.get();
+    const uint64_t End = Start + Length;
+    *Stats = {};
+
+    // Keeps multiblock from following branches out of the range
+    Decoder->SetSectionMaxAddress(End);
+
+    for (uint64_t PC = Start; PC < End;) {
+      Thread->CompileScratch->Reset();
+      Decoder->DecodeInstructionsAtEntry(reinterpret_cast<uint8_t const*>(PC), PC, [](uint64_t, uint64_t, uint64_t) {});
+
+      for (auto const &Block : *Decoder->GetDecodedBlocks()) {
+        ++Stats->Blocks;
+        Stats->Instructions += Block.NumInstructions;
+        Stats->InvalidInstructions += Block.HasInvalidInstruction;
+        for (uint64_t i = 0; i < Block.NumInstructions; ++i) {
+          Stats->Bytes += Block.DecodedInstructions[i].InstSize;
+        }
+      }
+
+      // Invalid instructions don't have a size, resync on the next byte
+      PC = std::max(Decoder->DecodedMaxAddress, PC + 1);
+    }
+
+    Decoder->SetSectionMaxAddress(~0ULL);
+    Decoder->DelayedDisownBuffer();
   }
 
   uint64_t Context::GetThreadCount() const {
@@ -1319,13 +1740,19 @@ namespace FEXCore::Context {
   }
 
   uint64_t HandleSyscall(FEXCore::HLE::SyscallHandler *Handler, FEXCore::Core::CpuStateFrame *Frame, FEXCore::HLE::SyscallArguments *Args) {
+    auto Thread = Frame->Thread;
+    if (Thread->SymbolBuffer) {
+      // Syscalls are where the dispatcher leaves the JIT, write out symbols of blocks that stopped compiling in a while
+      Thread->CTX->Symbols.FlushIfStale(Thread->SymbolBuffer.get());
+    }
+
     uint64_t Result{};
     Result = Handler->HandleSyscall(Frame, Args);
     return Result;
   }
 
-  IR::AOTIRCacheEntry *Context::LoadAOTIRCacheEntry(const std::string &filename) {
-    auto rv = IRCaptureCache.LoadAOTIRCacheEntry(filename);
+  IR::AOTIRCacheEntry *Context::LoadAOTIRCacheEntry(const std::string &filename, const std::string &FileIdentity) {
+    auto rv = IRCaptureCache.LoadAOTIRCacheEntry(filename, FileIdentity);
     if (DebugServer) {
       DebugServer->AlertLibrariesChanged();
     }
@@ -1339,6 +1766,18 @@ namespace FEXCore::Context {
     }
   }
 
+  void Context::AddNamedRegion(uintptr_t Base, uintptr_t Size, uintptr_t Offset, const std::string &filename) {
+    if (CodeObjectCacheService) {
+      CodeObjectCacheService->AsyncAddNamedRegionJob(Base, Size, Offset, filename);
+    }
+  }
+
+  void Context::RemoveNamedRegion(uintptr_t Base, uintptr_t Size) {
+    if (CodeObjectCacheService) {
+      CodeObjectCacheService->AsyncRemoveNamedRegionJob(Base, Size);
+    }
+  }
+
 
   void Context::AppendThunkDefinitions(std::vector<FEXCore::IR::ThunkDefinition> const& Definitions) {
     ThunkHandler->AppendThunkDefinitions(Definitions);
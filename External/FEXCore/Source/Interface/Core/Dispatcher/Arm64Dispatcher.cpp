@@ -149,21 +149,58 @@ void Arm64Dispatcher::EmitDispatcher() {
     // If page pointer is zero then we have no block
     cbz(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, &NoBlock);
 
-    // Steal the page offset
-    and_(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r1, ARMEmitter::Reg::r3, 0x0FFF);
-
-    // Shift the offset by the size of the block cache entry
-    add(ARMEmitter::XReg::x0, ARMEmitter::XReg::x0, ARMEmitter::XReg::x1, ARMEmitter::ShiftType::LSL, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry)));
-
-    // Load the guest address first to ensure it maps to the address we are currently at
+    // Check the guest page of the table first to ensure it maps to the page we are currently at
     // This fixes aliasing problems
-    ldr(ARMEmitter::XReg::x1, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::LookupCacheEntry, GuestCode));
-    cmp(ARMEmitter::XReg::x1, RipReg);
+    ldr(ARMEmitter::XReg::x1, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::L2Page, GuestPage));
+    and_(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r3, RipReg.R(), ~0x0FFFULL);
+    cmp(ARMEmitter::XReg::x1, ARMEmitter::XReg::x3);
+    b(ARMEmitter::Condition::CC_NE, &NoBlock);
+
+    // Hash the page offset for the first slot to probe, matches LookupCache::L2Hash
+    and_(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r3, RipReg.R(), 0x0FFF);
+    eor(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, ARMEmitter::ShiftType::LSR, 4);
+    ldr(ARMEmitter::WReg::w1, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::L2Page, Mask));
+    and_(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, ARMEmitter::Reg::r1);
+
+    // Only x0, x1 and x3 are free here, so the key and mask get rematerialized on every probe
+    constexpr auto EntriesOffset = sizeof(FEXCore::LookupCache::L2Page);
+    ARMEmitter::BackwardLabel ProbeTop;
+    ARMEmitter::ForwardLabel FoundEntry;
+    Bind(&ProbeTop);
+    add(ARMEmitter::XReg::x1, ARMEmitter::XReg::x0, ARMEmitter::XReg::x3, ARMEmitter::ShiftType::LSL, (int)log2(sizeof(FEXCore::LookupCache::L2Entry)));
+    ldr(ARMEmitter::WReg::w1, ARMEmitter::Reg::r1, EntriesOffset + offsetof(FEXCore::LookupCache::L2Entry, Key));
+
+    // Hitting an empty slot means the block isn't in the table
+    cbz(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r1, &NoBlock);
+
+    // Key is the page offset plus one
+    sub(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r1, ARMEmitter::Reg::r1, 1);
+    eor(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r1, ARMEmitter::Reg::r1, RipReg.R());
+    ands(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::zr, ARMEmitter::Reg::r1, 0x0FFF);
+    b(ARMEmitter::Condition::CC_EQ, &FoundEntry);
+
+    // Linear probe to the next slot
+    add(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, 1);
+    ldr(ARMEmitter::WReg::w1, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::L2Page, Mask));
+    and_(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, ARMEmitter::Reg::r1);
+    b(&ProbeTop);
+
+    // Now load the actual host block to execute
+    // Key and offset are reloaded in one 64-bit load and the key checked again, the entry can be rewritten
+    // concurrently by a cross thread invalidation and the offset must belong to the key that matched
+    static_assert(offsetof(FEXCore::LookupCache::L2Entry, Key) == 0 && offsetof(FEXCore::LookupCache::L2Entry, HostCodeOffset) == 4);
+    Bind(&FoundEntry);
+    add(ARMEmitter::XReg::x1, ARMEmitter::XReg::x0, ARMEmitter::XReg::x3, ARMEmitter::ShiftType::LSL, (int)log2(sizeof(FEXCore::LookupCache::L2Entry)));
+    ldr(ARMEmitter::XReg::x3, ARMEmitter::Reg::r1, EntriesOffset);
+    cbz(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r3, &NoBlock);
+    sub(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r1, ARMEmitter::Reg::r3, 1);
+    eor(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r1, ARMEmitter::Reg::r1, RipReg.R());
+    ands(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::zr, ARMEmitter::Reg::r1, 0x0FFF);
     b(ARMEmitter::Condition::CC_NE, &NoBlock);
 
-    // Now load the actual host block to execute if we can
-    ldr(ARMEmitter::XReg::x3, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::LookupCacheEntry, HostCode));
-    cbz(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r3, &NoBlock);
+    asr(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r3, ARMEmitter::Reg::r3, 32);
+    ldr(ARMEmitter::XReg::x1, ARMEmitter::Reg::r0, offsetof(FEXCore::LookupCache::L2Page, CodeBase));
+    add(ARMEmitter::XReg::x3, ARMEmitter::XReg::x1, ARMEmitter::XReg::x3);
 
     // If we've made it here then we have a real compiled block
     {
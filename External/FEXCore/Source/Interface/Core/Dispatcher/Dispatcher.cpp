@@ -419,6 +419,11 @@ bool Dispatcher::HandleGuestSignal(FEXCore::Core::InternalThreadState *Thread, i
   // siginfo_t
   siginfo_t *HostSigInfo = reinterpret_cast<siginfo_t*>(info);
 
+  // The JIT only synchronizes the RIP to the context when it needs to, recover the exact one from the block's PC map
+  if (auto GuestRIP = Thread->CPUBackend->GetGuestRIPForHostPC(OldPC)) {
+    Frame->State.rip = *GuestRIP;
+  }
+
   // Backup where we think the RIP currently is
   ContextBackup->OriginalRIP = Frame->State.rip;
 
@@ -125,21 +125,48 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
     cmp(rdi, 0);
     je(NoBlock);
 
-    mov (rax, rdx);
-    and_(rax, 0x0FFF);
-
-    shl(rax, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry)));
-
     // check for aliasing
-    mov(rcx, qword [rdi + rax + 8]);
-    cmp(rcx, rdx);
+    mov(rcx, rdx);
+    and_(rcx, ~0x0FFF);
+    cmp(rcx, qword [rdi + offsetof(FEXCore::LookupCache::L2Page, GuestPage)]);
     jne(NoBlock);
 
-    // Load the block pointer
-    mov(rax, qword [rdi + rax]);
+    // Key is the page offset plus one
+    mov(rsi, rdx);
+    and_(rsi, 0x0FFF);
+    lea(r8d, dword [rsi + 1]);
+
+    // Hash for the first slot to probe, matches LookupCache::L2Hash
+    mov(eax, esi);
+    shr(eax, 4);
+    xor_(eax, esi);
+    mov(r9d, dword [rdi + offsetof(FEXCore::LookupCache::L2Page, Mask)]);
+    and_(eax, r9d);
+
+    constexpr auto EntriesOffset = sizeof(FEXCore::LookupCache::L2Page);
+    Label ProbeTop;
+    Label FoundEntry;
+    static_assert(offsetof(FEXCore::LookupCache::L2Entry, Key) == 0 && offsetof(FEXCore::LookupCache::L2Entry, HostCodeOffset) == 4);
+    L(ProbeTop);
+    // Key and offset in one load, the entry can be rewritten concurrently by a cross thread invalidation
+    mov(rcx, qword [rdi + rax * 8 + EntriesOffset]);
+    cmp(ecx, r8d);
+    je(FoundEntry);
+
+    // Hitting an empty slot means the block isn't in the table
+    test(ecx, ecx);
+    jz(NoBlock);
+
+    // Linear probe to the next slot
+    inc(eax);
+    and_(eax, r9d);
+    jmp(ProbeTop);
 
-    cmp(rax, 0);
-    je(NoBlock);
+    // Load the block pointer
+    L(FoundEntry);
+    sar(rcx, 32);
+    mov(rax, rcx);
+    add(rax, qword [rdi + offsetof(FEXCore::LookupCache::L2Page, CodeBase)]);
 
     // Update L1
     mov(r13, qword STATE_PTR(CpuStateFrame, Pointers.Common.L1Pointer));
@@ -21,9 +21,16 @@ $end_info$
 #include <FEXCore/Utils/Profiler.h>
 #include <FEXCore/Utils/Telemetry.h>
 #include <FEXHeaderUtils/TypeDefines.h>
+#include <bit>
 #include <set>
 #include <sys/mman.h>
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#elif defined(_M_X86_64) && defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace FEXCore::Frontend {
 #include "Interface/Core/VSyscall/VSyscall.inc"
 
@@ -177,10 +184,89 @@ static uint32_t MapVEXToReg(uint8_t vvvv, bool HasXMM) {
   }
 }
 
-Decoder::Decoder(FEXCore::Context::Context *ctx)
+consteval std::array<Decoder::PrefixInfo, 256> GeneratePrefixTable(bool Is64Bit) {
+  std::array<Decoder::PrefixInfo, 256> Table{};
+
+  auto Legacy = [&Table](uint8_t Op, uint32_t Flags, uint8_t OpAddr = 0, bool IsEscape = false) {
+    Table[Op] = {Flags, OpAddr, true, IsEscape};
+  };
+
+  Legacy(0x66, DecodeFlags::FLAG_OPERAND_SIZE, DecodeFlags::FLAG_OPERAND_SIZE_LAST, true);
+  Legacy(0x67, DecodeFlags::FLAG_ADDRESS_SIZE);
+  // Annoyingly GCC generates NOP ops with these prefixes, they are ignored in 64-bit mode
+  // eg. 66 2e 0f 1f 84 00 00 00 00 00 nop    WORD PTR cs:[rax+rax*1+0x0]
+  Legacy(0x26, Is64Bit ? 0 : DecodeFlags::FLAG_ES_PREFIX);
+  Legacy(0x2E, Is64Bit ? 0 : DecodeFlags::FLAG_CS_PREFIX);
+  Legacy(0x36, Is64Bit ? 0 : DecodeFlags::FLAG_SS_PREFIX);
+  Legacy(0x3E, Is64Bit ? 0 : DecodeFlags::FLAG_DS_PREFIX);
+  Legacy(0x64, DecodeFlags::FLAG_FS_PREFIX);
+  Legacy(0x65, DecodeFlags::FLAG_GS_PREFIX);
+  Legacy(0xF0, DecodeFlags::FLAG_LOCK);
+  Legacy(0xF2, DecodeFlags::FLAG_REPNE_PREFIX, 0, true);
+  Legacy(0xF3, DecodeFlags::FLAG_REP_PREFIX, 0, true);
+
+  if (Is64Bit) {
+    for (uint32_t Op = 0x40; Op < 0x50; ++Op) {
+      uint32_t Flags = DecodeFlags::FLAG_REX_PREFIX;
+      uint8_t OpAddr = 0;
+      // Widening displacement
+      if (Op & 0b1000) {
+        Flags |= DecodeFlags::FLAG_REX_WIDENING;
+        OpAddr = DecodeFlags::FLAG_WIDENING_SIZE_LAST;
+      }
+      if (Op & 0b0001) {
+        Flags |= DecodeFlags::FLAG_REX_XGPR_B;
+      }
+      if (Op & 0b0010) {
+        Flags |= DecodeFlags::FLAG_REX_XGPR_X;
+      }
+      if (Op & 0b0100) {
+        Flags |= DecodeFlags::FLAG_REX_XGPR_R;
+      }
+      Table[Op] = {Flags, OpAddr, true, false};
+    }
+  }
+
+  return Table;
+}
+
+static constexpr auto PrefixTable_64 = GeneratePrefixTable(true);
+static constexpr auto PrefixTable_32 = GeneratePrefixTable(false);
+
+// Prefix bytes are classified 16 at a time by looking up both nibbles of a byte, it is a prefix if the lookups share a bit.
+// Low nibble classes: bit 0 = x6/xE, bit 1 = any, bit 2 = x4-x7, bit 3 = x0/x2/x3
+static constexpr std::array<uint8_t, 16> PrefixLowNibbles = {
+  0b1010, 0b0010, 0b1010, 0b1010, 0b0110, 0b0110, 0b0111, 0b0110,
+  0b0010, 0b0010, 0b0010, 0b0010, 0b0010, 0b0010, 0b0011, 0b0010,
+};
+// 2x/3x segments, 4x REX, 6x FS/GS/operand/address size, Fx LOCK/REPNE/REP
+static constexpr std::array<uint8_t, 16> PrefixHighNibbles_64 = {
+  0, 0, 0b0001, 0b0001, 0b0010, 0, 0b0100, 0,
+  0, 0, 0, 0, 0, 0, 0, 0b1000,
+};
+static constexpr std::array<uint8_t, 16> PrefixHighNibbles_32 = {
+  0, 0, 0b0001, 0b0001, 0, 0, 0b0100, 0,
+  0, 0, 0, 0, 0, 0, 0, 0b1000,
+};
+
+Decoder::Decoder(FEXCore::Context::Context *ctx, std::pmr::memory_resource *Scratch)
   : CTX {ctx}
   , OSABI { ctx->SyscallHandler ? ctx->SyscallHandler->GetOSABI() : FEXCore::HLE::SyscallOSABI::OS_UNKNOWN }
-  , PoolObject {ctx->FrontendAllocator, sizeof(FEXCore::X86Tables::DecodedInst) * DefaultDecodedBufferSize} {
+  , BaseOps { ctx->Config.Is64BitMode ? BaseOps_64.data() : BaseOps_32.data() }
+  , SecondBaseOps { ctx->Config.Is64BitMode ? SecondBaseOps_64.data() : SecondBaseOps_32.data() }
+  , RepModOps { ctx->Config.Is64BitMode ? RepModOps_64.data() : RepModOps_32.data() }
+  , RepNEModOps { ctx->Config.Is64BitMode ? RepNEModOps_64.data() : RepNEModOps_32.data() }
+  , OpSizeModOps { ctx->Config.Is64BitMode ? OpSizeModOps_64.data() : OpSizeModOps_32.data() }
+  , PrimaryInstGroupOps { ctx->Config.Is64BitMode ? PrimaryInstGroupOps_64.data() : PrimaryInstGroupOps_32.data() }
+  , H0F3ATableOps { ctx->Config.Is64BitMode ? H0F3ATableOps_64.data() : H0F3ATableOps_32.data() }
+  , PrefixTable { ctx->Config.Is64BitMode ? &PrefixTable_64 : &PrefixTable_32 }
+  , PrefixHighNibbles { ctx->Config.Is64BitMode ? PrefixHighNibbles_64.data() : PrefixHighNibbles_32.data() }
+  , PoolObject {ctx->FrontendAllocator, sizeof(FEXCore::X86Tables::DecodedInst) * DefaultDecodedBufferSize}
+  , Scratch {Scratch}
+  , BlocksToDecode {Scratch}
+  , HasBlocks {Scratch}
+  // Full SMC checks only drop the block entries that noticed the change, which would leave stale decodes around
+  , DecodeCacheMaxEntries { ctx->Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL ? 0 : ctx->Config.DecodeCacheSize() } {
 }
 
 Decoder::~Decoder() {
@@ -299,18 +385,27 @@ void Decoder::DecodeModRM_16(X86Tables::DecodedOperand *Operand, X86Tables::ModR
   Operand->Data.SIB.Index = it.Index;
 }
 
+// Displacement bytes after a ModRM byte with 32-bit or 64-bit addressing, SIB with a base of 0b101 adds its own
+consteval std::array<uint8_t, 256> GenerateModRMDisplacementTable() {
+  std::array<uint8_t, 256> Table{};
+  for (uint32_t Byte = 0; Byte < 256; ++Byte) {
+    const uint32_t mod = Byte >> 6;
+    const uint32_t rm = Byte & 0b111;
+    if (mod == 0b01) {
+      Table[Byte] = 1;
+    }
+    else if (mod == 0b10 || (mod == 0 && rm == 0b101)) {
+      Table[Byte] = 4;
+    }
+  }
+  return Table;
+}
+
+static constexpr auto ModRMDisplacement_64 = GenerateModRMDisplacementTable();
+
 void Decoder::DecodeModRM_64(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM) {
-  uint8_t Displacement{};
   // Do we have an offset?
-  if (ModRM.mod == 0b01) {
-    Displacement = 1;
-  }
-  else if (ModRM.mod == 0b10) {
-    Displacement = 4;
-  }
-  else if (ModRM.mod == 0 && ModRM.rm == 0b101) {
-    Displacement = 4;
-  }
+  uint8_t Displacement = ModRMDisplacement_64[ModRM.Hex];
 
   // Calculate SIB
   bool HasSIB = ((ModRM.mod != 0b11) &&
@@ -391,12 +486,12 @@ bool Decoder::NormalOp(FEXCore::X86Tables::X86InstInfo const *Info, uint16_t Op,
   }
 
   if (Info->Type == FEXCore::X86Tables::TYPE_UNKNOWN) {
-    LogMan::Msg::DFmt("Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name ?: "UND", Op, DecodeInst->PC);
+    LogMan::Msg::DFmt("Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name[0] ? Info->Name : "UND", Op, DecodeInst->PC);
     return false;
   }
 
   if (Info->Type == FEXCore::X86Tables::TYPE_INVALID) {
-    LogMan::Msg::DFmt("Invalid or Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name ?: "UND", Op, DecodeInst->PC);
+    LogMan::Msg::DFmt("Invalid or Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name[0] ? Info->Name : "UND", Op, DecodeInst->PC);
     return false;
   }
 
@@ -675,7 +770,7 @@ bool Decoder::NormalOp(FEXCore::X86Tables::X86InstInfo const *Info, uint16_t Op,
   }
 
   LOGMAN_THROW_AA_FMT(Bytes == 0, "Inst at 0x{:x}: 0x{:04x} '{}' Had an instruction of size {} with {} remaining",
-                     DecodeInst->PC, DecodeInst->OP, DecodeInst->TableInfo->Name ?: "UND", InstructionSize, Bytes);
+                     DecodeInst->PC, DecodeInst->OP, DecodeInst->TableInfo->Name[0] ? DecodeInst->TableInfo->Name : "UND", InstructionSize, Bytes);
   DecodeInst->InstSize = InstructionSize;
   return true;
 }
@@ -691,12 +786,12 @@ bool Decoder::NormalOpHeader(FEXCore::X86Tables::X86InstInfo const *Info, uint16
   }
 
   if (Info->Type == FEXCore::X86Tables::TYPE_UNKNOWN) {
-    LogMan::Msg::DFmt("Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name ?: "UND", Op, DecodeInst->PC);
+    LogMan::Msg::DFmt("Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name[0] ? Info->Name : "UND", Op, DecodeInst->PC);
     return false;
   }
 
   if (Info->Type == FEXCore::X86Tables::TYPE_INVALID) {
-    LogMan::Msg::DFmt("Invalid or Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name ?: "UND", Op, DecodeInst->PC);
+    LogMan::Msg::DFmt("Invalid or Unknown instruction: {} 0x{:04x} 0x{:x}", Info->Name[0] ? Info->Name : "UND", Op, DecodeInst->PC);
     return false;
   }
 
@@ -742,7 +837,7 @@ bool Decoder::NormalOpHeader(FEXCore::X86Tables::X86InstInfo const *Info, uint16
     ModRM.Hex = DecodeInst->ModRM;
 
     uint16_t LocalOp = OPD(Info->Type, PrefixType, ModRM.reg);
-    FEXCore::X86Tables::X86InstInfo *LocalInfo = &SecondInstGroupOps[LocalOp];
+    FEXCore::X86Tables::X86InstInfo const *LocalInfo = &SecondInstGroupOps[LocalOp];
 #undef OPD
     if (LocalInfo->Type == FEXCore::X86Tables::TYPE_SECOND_GROUP_MODRM) {
       // Everything in this group is privileged instructions aside from XGETBV
@@ -820,7 +915,7 @@ bool Decoder::NormalOpHeader(FEXCore::X86Tables::X86InstInfo const *Info, uint16
     Op = OPD(map_select, pp, VEXOp);
 #undef OPD
 
-    FEXCore::X86Tables::X86InstInfo *LocalInfo = &VEXTableOps[Op];
+    FEXCore::X86Tables::X86InstInfo const *LocalInfo = &VEXTableOps[Op];
 
     if (LocalInfo->Type >= FEXCore::X86Tables::TYPE_VEX_GROUP_12 &&
         LocalInfo->Type <= FEXCore::X86Tables::TYPE_VEX_GROUP_17) {
@@ -854,6 +949,42 @@ bool Decoder::NormalOpHeader(FEXCore::X86Tables::X86InstInfo const *Info, uint16
   return NormalOp(Info, Op);
 }
 
+uint8_t Decoder::ScanPrefixes() const {
+  // The whole window needs to be in the page of the first byte, the next page might not be mapped
+  constexpr size_t WindowSize = 16;
+  const bool WindowInPage = (reinterpret_cast<uintptr_t>(InstStream) & (FHU::FEX_PAGE_SIZE - 1)) <= FHU::FEX_PAGE_SIZE - WindowSize;
+
+#ifdef _M_ARM_64
+  if (WindowInPage) {
+    const uint8x16_t Bytes = vld1q_u8(InstStream);
+    const uint8x16_t Low = vqtbl1q_u8(vld1q_u8(PrefixLowNibbles.data()), vandq_u8(Bytes, vdupq_n_u8(0xF)));
+    const uint8x16_t High = vqtbl1q_u8(vld1q_u8(PrefixHighNibbles), vshrq_n_u8(Bytes, 4));
+    const uint8x16_t IsPrefix = vtstq_u8(Low, High);
+
+    // No movemask on NEON, narrowing leaves four bits per byte
+    const uint64_t Mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(IsPrefix), 4)), 0);
+    return std::countr_one(Mask) / 4;
+  }
+#elif defined(_M_X86_64) && defined(__SSSE3__)
+  if (WindowInPage) {
+    const __m128i NibbleMask = _mm_set1_epi8(0xF);
+    const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(InstStream));
+    const __m128i Low = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(PrefixLowNibbles.data())), _mm_and_si128(Bytes, NibbleMask));
+    const __m128i High = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(PrefixHighNibbles)), _mm_and_si128(_mm_srli_epi16(Bytes, 4), NibbleMask));
+    const __m128i NotPrefix = _mm_cmpeq_epi8(_mm_and_si128(Low, High), _mm_setzero_si128());
+
+    return std::countr_zero(static_cast<uint32_t>(_mm_movemask_epi8(NotPrefix)) | (1U << WindowSize));
+  }
+#endif
+
+  // Only reads as far as the per byte decoding would
+  uint8_t Count = 0;
+  while (Count < MAX_INST_SIZE && (*PrefixTable)[InstStream[Count]].IsPrefix) {
+    ++Count;
+  }
+  return Count;
+}
+
 bool Decoder::DecodeInstruction(uint64_t PC) {
   InstructionSize = 0;
   Instruction.fill(0);
@@ -862,204 +993,210 @@ bool Decoder::DecodeInstruction(uint64_t PC) {
   memset(DecodeInst, 0, sizeof(DecodedInst));
   DecodeInst->PC = PC;
 
-  for(;;) {
-    if (InstructionSize >= MAX_INST_SIZE)
-      return false;
-    uint8_t Op = ReadByte();
-    switch (Op) {
-    case 0x0F: {// Escape Op
-      uint8_t EscapeOp = ReadByte();
-      switch (EscapeOp) {
-      case 0x0F: [[unlikely]] { // 3DNow!
-        // 3DNow! Instruction Encoding: 0F 0F [ModRM] [SIB] [Displacement] [Opcode]
-        // Decode ModRM
-        uint8_t ModRMByte = ReadByte();
-        DecodeInst->ModRM = ModRMByte;
-        DecodeInst->DecodedModRM = true;
-
-        FEXCore::X86Tables::ModRMDecoded ModRM;
-        ModRM.Hex = DecodeInst->ModRM;
-
-        const bool Has16BitAddressing = !CTX->Config.Is64BitMode &&
-          DecodeInst->Flags & DecodeFlags::FLAG_ADDRESS_SIZE;
-
-        // All 3DNow! instructions have the second argument as the rm handler
-        // We need to decode it upfront to get the displacement out of the way
-        if (ModRM.mod != 0b11) {
-          auto Disp = DecodeModRMs_Disp[Has16BitAddressing];
-          (this->*Disp)(&DecodeInst->Src[0], ModRM);
-        }
+  // Legacy and REX prefixes only set flags, the whole run is applied before looking at the opcode
+  const uint8_t NumPrefixes = ScanPrefixes();
+  if (NumPrefixes >= MAX_INST_SIZE) {
+    return false;
+  }
 
-        // Take a peek at the op just past the displacement
-        uint8_t LocalOp = ReadByte();
-        return NormalOpHeader(&FEXCore::X86Tables::DDDNowOps[LocalOp], LocalOp);
-      break;
-      }
-      case 0x38: { // F38 Table!
-        constexpr uint16_t PF_38_NONE = 0;
-        constexpr uint16_t PF_38_66   = (1U << 0);
-        constexpr uint16_t PF_38_F2   = (1U << 1);
-        constexpr uint16_t PF_38_F3   = (1U << 2);
-
-        uint16_t Prefix = PF_38_NONE;
-        if (DecodeInst->Flags & DecodeFlags::FLAG_OPERAND_SIZE) {
-          Prefix |= PF_38_66;
-        }
-        if (DecodeInst->Flags & DecodeFlags::FLAG_REPNE_PREFIX) {
-          Prefix |= PF_38_F2;
-        }
-        if (DecodeInst->Flags & DecodeFlags::FLAG_REP_PREFIX) {
-          Prefix |= PF_38_F3;
-        }
+  for (uint8_t i = 0; i < NumPrefixes; ++i) {
+    const uint8_t Prefix = ReadByte();
+    const auto &Info = (*PrefixTable)[Prefix];
+    DecodeInst->Flags |= Info.Flags;
+    if (Info.OpAddr) {
+      DecodeFlags::PushOpAddr(&DecodeInst->Flags, Info.OpAddr);
+    }
+    if (Info.IsEscape) {
+      DecodeInst->LastEscapePrefix = Prefix;
+    }
+  }
 
-        uint16_t LocalOp = (Prefix << 8) | ReadByte();
-        return NormalOpHeader(&FEXCore::X86Tables::H0F38TableOps[LocalOp], LocalOp);
-      break;
+  uint8_t Op = ReadByte();
+  switch (Op) {
+  case 0x0F: {// Escape Op
+    uint8_t EscapeOp = ReadByte();
+    switch (EscapeOp) {
+    case 0x0F: [[unlikely]] { // 3DNow!
+      // 3DNow! Instruction Encoding: 0F 0F [ModRM] [SIB] [Displacement] [Opcode]
+      // Decode ModRM
+      uint8_t ModRMByte = ReadByte();
+      DecodeInst->ModRM = ModRMByte;
+      DecodeInst->DecodedModRM = true;
+
+      FEXCore::X86Tables::ModRMDecoded ModRM;
+      ModRM.Hex = DecodeInst->ModRM;
+
+      const bool Has16BitAddressing = !CTX->Config.Is64BitMode &&
+        DecodeInst->Flags & DecodeFlags::FLAG_ADDRESS_SIZE;
+
+      // All 3DNow! instructions have the second argument as the rm handler
+      // We need to decode it upfront to get the displacement out of the way
+      if (ModRM.mod != 0b11) {
+        auto Disp = DecodeModRMs_Disp[Has16BitAddressing];
+        (this->*Disp)(&DecodeInst->Src[0], ModRM);
       }
-      case 0x3A: { // F3A Table!
-        constexpr uint16_t PF_3A_NONE = 0;
-        constexpr uint16_t PF_3A_66   = (1 << 0);
-        constexpr uint16_t PF_3A_REX  = (1 << 1);
 
-        uint16_t Prefix = PF_3A_NONE;
-        if (DecodeInst->LastEscapePrefix == 0x66) // Operand Size
-          Prefix = PF_3A_66;
-
-        if (DecodeInst->Flags & DecodeFlags::FLAG_REX_WIDENING)
-          Prefix |= PF_3A_REX;
-
-        uint16_t LocalOp = (Prefix << 8) | ReadByte();
-        return NormalOpHeader(&FEXCore::X86Tables::H0F3ATableOps[LocalOp], LocalOp);
-      break;
+      // Take a peek at the op just past the displacement
+      uint8_t LocalOp = ReadByte();
+      return NormalOpHeader(&FEXCore::X86Tables::DDDNowOps[LocalOp], LocalOp);
+    break;
+    }
+    case 0x38: { // F38 Table!
+      constexpr uint16_t PF_38_NONE = 0;
+      constexpr uint16_t PF_38_66   = (1U << 0);
+      constexpr uint16_t PF_38_F2   = (1U << 1);
+      constexpr uint16_t PF_38_F3   = (1U << 2);
+
+      uint16_t Prefix = PF_38_NONE;
+      if (DecodeInst->Flags & DecodeFlags::FLAG_OPERAND_SIZE) {
+        Prefix |= PF_38_66;
       }
-      default: // Two byte table!
-        // x86-64 abuses three legacy prefixes to extend the table encodings
-        // 0x66 - Operand Size prefix
-        // 0xF2 - REPNE prefix
-        // 0xF3 - REP prefix
-        // If any of these three prefixes are used then it falls down the subtable
-        // Additionally: If you hit repeat of differnt prefixes then only the LAST one before this one works for subtable selection
-
-        bool NoOverlay = (FEXCore::X86Tables::SecondBaseOps[EscapeOp].Flags & InstFlags::FLAGS_NO_OVERLAY) != 0;
-        bool NoOverlay66 = (FEXCore::X86Tables::SecondBaseOps[EscapeOp].Flags & InstFlags::FLAGS_NO_OVERLAY66) != 0;
-
-        if (NoOverlay) { // This section of the table ignores prefix extention
-          return NormalOpHeader(&FEXCore::X86Tables::SecondBaseOps[EscapeOp], EscapeOp);
-        }
-        else if (DecodeInst->LastEscapePrefix == 0xF3) { // REP
-          // Remove prefix so it doesn't effect calculations.
-          // This is only an escape prefix rather tan modifier now
-          DecodeInst->Flags &= ~DecodeFlags::FLAG_REP_PREFIX;
-          return NormalOpHeader(&FEXCore::X86Tables::RepModOps[EscapeOp], EscapeOp);
-        }
-        else if (DecodeInst->LastEscapePrefix == 0xF2) { // REPNE
-          // Remove prefix so it doesn't effect calculations.
-          // This is only an escape prefix rather tan modifier now
-          DecodeInst->Flags &= ~DecodeFlags::FLAG_REPNE_PREFIX;
-          return NormalOpHeader(&FEXCore::X86Tables::RepNEModOps[EscapeOp], EscapeOp);
-        }
-        else if (DecodeInst->LastEscapePrefix == 0x66 && !NoOverlay66) { // Operand Size
-          // Remove prefix so it doesn't effect calculations.
-          // This is only an escape prefix rather tan modifier now
-          DecodeInst->Flags &= ~DecodeFlags::FLAG_OPERAND_SIZE;
-          DecodeFlags::PopOpAddrIf(&DecodeInst->Flags, DecodeFlags::FLAG_OPERAND_SIZE_LAST);
-          return NormalOpHeader(&FEXCore::X86Tables::OpSizeModOps[EscapeOp], EscapeOp);
-        }
-        else {
-          return NormalOpHeader(&FEXCore::X86Tables::SecondBaseOps[EscapeOp], EscapeOp);
-        }
-      break;
+      if (DecodeInst->Flags & DecodeFlags::FLAG_REPNE_PREFIX) {
+        Prefix |= PF_38_F2;
+      }
+      if (DecodeInst->Flags & DecodeFlags::FLAG_REP_PREFIX) {
+        Prefix |= PF_38_F3;
       }
+
+      uint16_t LocalOp = (Prefix << 8) | ReadByte();
+      return NormalOpHeader(&FEXCore::X86Tables::H0F38TableOps[LocalOp], LocalOp);
     break;
     }
-    case 0x66: // Operand Size prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_OPERAND_SIZE;
-      DecodeInst->LastEscapePrefix = Op;
-      DecodeFlags::PushOpAddr(&DecodeInst->Flags, DecodeFlags::FLAG_OPERAND_SIZE_LAST);
-    break;
-    case 0x67: // Address Size override prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_ADDRESS_SIZE;
+    case 0x3A: { // F3A Table!
+      constexpr uint16_t PF_3A_NONE = 0;
+      constexpr uint16_t PF_3A_66   = (1 << 0);
+      constexpr uint16_t PF_3A_REX  = (1 << 1);
+
+      uint16_t Prefix = PF_3A_NONE;
+      if (DecodeInst->LastEscapePrefix == 0x66) // Operand Size
+        Prefix = PF_3A_66;
+
+      if (DecodeInst->Flags & DecodeFlags::FLAG_REX_WIDENING)
+        Prefix |= PF_3A_REX;
+
+      uint16_t LocalOp = (Prefix << 8) | ReadByte();
+      return NormalOpHeader(&H0F3ATableOps[LocalOp], LocalOp);
     break;
-    case 0x26: // ES legacy prefix
-      if (!CTX->Config.Is64BitMode) {
-        DecodeInst->Flags |= DecodeFlags::FLAG_ES_PREFIX;
+    }
+    default: // Two byte table!
+      // x86-64 abuses three legacy prefixes to extend the table encodings
+      // 0x66 - Operand Size prefix
+      // 0xF2 - REPNE prefix
+      // 0xF3 - REP prefix
+      // If any of these three prefixes are used then it falls down the subtable
+      // Additionally: If you hit repeat of differnt prefixes then only the LAST one before this one works for subtable selection
+
+      bool NoOverlay = (SecondBaseOps[EscapeOp].Flags & InstFlags::FLAGS_NO_OVERLAY) != 0;
+      bool NoOverlay66 = (SecondBaseOps[EscapeOp].Flags & InstFlags::FLAGS_NO_OVERLAY66) != 0;
+
+      if (NoOverlay) { // This section of the table ignores prefix extention
+        return NormalOpHeader(&SecondBaseOps[EscapeOp], EscapeOp);
       }
-      break;
-    case 0x2E: // CS legacy prefix
-      if (!CTX->Config.Is64BitMode) {
-        DecodeInst->Flags |= DecodeFlags::FLAG_CS_PREFIX;
+      else if (DecodeInst->LastEscapePrefix == 0xF3) { // REP
+        // Remove prefix so it doesn't effect calculations.
+        // This is only an escape prefix rather tan modifier now
+        DecodeInst->Flags &= ~DecodeFlags::FLAG_REP_PREFIX;
+        return NormalOpHeader(&RepModOps[EscapeOp], EscapeOp);
       }
-      break;
-    case 0x36: // SS legacy prefix
-      if (!CTX->Config.Is64BitMode) {
-        DecodeInst->Flags |= DecodeFlags::FLAG_SS_PREFIX;
+      else if (DecodeInst->LastEscapePrefix == 0xF2) { // REPNE
+        // Remove prefix so it doesn't effect calculations.
+        // This is only an escape prefix rather tan modifier now
+        DecodeInst->Flags &= ~DecodeFlags::FLAG_REPNE_PREFIX;
+        return NormalOpHeader(&RepNEModOps[EscapeOp], EscapeOp);
       }
-      break;
-    case 0x3E: // DS legacy prefix
-      // Annoyingly GCC generates NOP ops with these prefixes
-      // Just ignore them for now
-      // eg. 66 2e 0f 1f 84 00 00 00 00 00 nop    WORD PTR cs:[rax+rax*1+0x0]
-      if (!CTX->Config.Is64BitMode) {
-        DecodeInst->Flags |= DecodeFlags::FLAG_DS_PREFIX;
+      else if (DecodeInst->LastEscapePrefix == 0x66 && !NoOverlay66) { // Operand Size
+        // Remove prefix so it doesn't effect calculations.
+        // This is only an escape prefix rather tan modifier now
+        DecodeInst->Flags &= ~DecodeFlags::FLAG_OPERAND_SIZE;
+        DecodeFlags::PopOpAddrIf(&DecodeInst->Flags, DecodeFlags::FLAG_OPERAND_SIZE_LAST);
+        return NormalOpHeader(&OpSizeModOps[EscapeOp], EscapeOp);
+      }
+      else {
+        return NormalOpHeader(&SecondBaseOps[EscapeOp], EscapeOp);
       }
-      break;
-    break;
-    case 0xF0: // LOCK prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_LOCK;
-    break;
-    case 0xF2: // REPNE prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_REPNE_PREFIX;
-      DecodeInst->LastEscapePrefix = Op;
-    break;
-    case 0xF3: // REP prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_REP_PREFIX;
-      DecodeInst->LastEscapePrefix = Op;
-    break;
-    case 0x64: // FS prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_FS_PREFIX;
-    break;
-    case 0x65: // GS prefix
-      DecodeInst->Flags |= DecodeFlags::FLAG_GS_PREFIX;
     break;
-    default: { // Default base table
-      auto Info = &FEXCore::X86Tables::BaseOps[Op];
+    }
+  break;
+  }
+  default: // Default base table
+    return NormalOpHeader(&BaseOps[Op], Op);
+  }
 
-      if (Info->Type == FEXCore::X86Tables::TYPE_REX_PREFIX) {
-        LOGMAN_THROW_A_FMT(CTX->Config.Is64BitMode, "Got REX prefix in 32bit mode");
-        DecodeInst->Flags |= DecodeFlags::FLAG_REX_PREFIX;
+  if (DecodeInst->Dest.IsGPR()) {
+    assert(DecodeInst->Dest.Data.GPR.GPR != FEXCore::X86State::REG_INVALID);
+  }
 
-        // Widening displacement
-        if (Op & 0b1000) {
-          DecodeInst->Flags |= DecodeFlags::FLAG_REX_WIDENING;
-          DecodeFlags::PushOpAddr(&DecodeInst->Flags, DecodeFlags::FLAG_WIDENING_SIZE_LAST);
-        }
+  return true;
+}
+
+bool Decoder::DecodeCachedInstruction(uint64_t PC) {
+  auto Page = DecodeCache.find(PC & FHU::FEX_PAGE_MASK);
+  if (Page == DecodeCache.end()) {
+    return false;
+  }
+
+  auto Inst = Page->second.find(PC);
+  if (Inst == Page->second.end()) {
+    return false;
+  }
+
+  DecodeInst = &DecodedBuffer[DecodedSize];
+  *DecodeInst = Inst->second;
+  return true;
+}
+
+void Decoder::CacheDecodedInstruction() {
+  if (DecodeCacheMaxEntries == 0) {
+    return;
+  }
+
+  if (DecodeCacheEntries == DecodeCacheMaxEntries) {
+    // Start over like the code cache does, whatever is still hot gets decoded again
+    ClearDecodeCache();
+  }
 
-        // XGPR_B bit set
-        if (Op & 0b0001)
-          DecodeInst->Flags |= DecodeFlags::FLAG_REX_XGPR_B;
+  if (DecodeCache[DecodeInst->PC & FHU::FEX_PAGE_MASK].emplace(DecodeInst->PC, *DecodeInst).second) {
+    ++DecodeCacheEntries;
+  }
+}
 
-        // XGPR_X bit set
-        if (Op & 0b0010)
-          DecodeInst->Flags |= DecodeFlags::FLAG_REX_XGPR_X;
+void Decoder::InvalidateDecodeCache(uint64_t Start, uint64_t Length) {
+  if (DecodeCache.empty() || Length == 0) {
+    return;
+  }
+
+  // An instruction starting on the page before the range can cross in to it
+  const uint64_t FirstPage = (Start & FHU::FEX_PAGE_MASK) - std::min<uint64_t>(Start & FHU::FEX_PAGE_MASK, FHU::FEX_PAGE_SIZE);
+  const uint64_t LastPage = (Start + Length - 1) & FHU::FEX_PAGE_MASK;
+
+  auto Erase = [this](auto It) {
+    DecodeCacheEntries -= It->second.size();
+    return DecodeCache.erase(It);
+  };
 
-        // XGPR_R bit set
-        if (Op & 0b0100)
-          DecodeInst->Flags |= DecodeFlags::FLAG_REX_XGPR_R;
+  if ((LastPage - FirstPage) / FHU::FEX_PAGE_SIZE >= DecodeCache.size()) {
+    // Large ranges like munmap of a whole library, walking the cached pages is cheaper
+    for (auto It = DecodeCache.begin(); It != DecodeCache.end();) {
+      if (It->first >= FirstPage && It->first <= LastPage) {
+        It = Erase(It);
       } else {
-        return NormalOpHeader(Info, Op);
+        ++It;
       }
-
-      break;
-    }
     }
-
+    return;
   }
 
-  if (DecodeInst->Dest.IsGPR()) {
-    assert(DecodeInst->Dest.Data.GPR.GPR != FEXCore::X86State::REG_INVALID);
+  for (uint64_t Page = FirstPage; Page <= LastPage; Page += FHU::FEX_PAGE_SIZE) {
+    auto It = DecodeCache.find(Page);
+    if (It != DecodeCache.end()) {
+      Erase(It);
+    }
   }
+}
 
-  return true;
+void Decoder::ClearDecodeCache() {
+  DecodeCache.clear();
+  DecodeCacheEntries = 0;
 }
 
 void Decoder::BranchTargetInMultiblockRange() {
@@ -1186,6 +1323,7 @@ void Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC,
   HasBlocks.clear();
   // Reset internal state management
   DecodedSize = 0;
+  DecodeCacheHits = 0;
   MaxCondBranchForward = 0;
   MaxCondBranchBackwards = ~0ULL;
   DecodedBuffer = PoolObject.ReownOrClaimBuffer();
@@ -1212,7 +1350,7 @@ void Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC,
 
   uint64_t CurrentCodePage = PC & FHU::FEX_PAGE_MASK;
 
-  std::set<uint64_t> CodePages = { CurrentCodePage };
+  std::pmr::set<uint64_t> CodePages {{ CurrentCodePage }, Scratch};
 
   AddContainedCodePage(PC, CurrentCodePage, FHU::FEX_PAGE_SIZE);
 
@@ -1255,7 +1393,15 @@ void Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC,
         }
       }
 
-      bool ErrorDuringDecoding = !DecodeInstruction(RIPToDecode + PCOffset);
+      bool ErrorDuringDecoding = false;
+      if (DecodeCachedInstruction(RIPToDecode + PCOffset)) {
+        ++DecodeCacheHits;
+      } else {
+        ErrorDuringDecoding = !DecodeInstruction(RIPToDecode + PCOffset);
+        if (!ErrorDuringDecoding) {
+          CacheDecodedInstruction();
+        }
+      }
 
       if (ErrorDuringDecoding) {
         LogMan::Msg::DFmt("Couldn't Decode something at 0x{:x}, Started at 0x{:x}", RIPToDecode + PCOffset, PC);
@@ -1314,6 +1460,8 @@ void Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC,
     CurrentBlockDecoding.DecodedInstructions = &DecodedBuffer[BlockStartOffset];
   }
 
+  // Drop the scratch nodes before the arena gets reset
+  HasBlocks.clear();
 
   // sort for better branching
   std::sort(Blocks.begin(), Blocks.end(), [](const FEXCore::Frontend::Decoder::DecodedBlocks& a, const FEXCore::Frontend::Decoder::DecodedBlocks& b) {
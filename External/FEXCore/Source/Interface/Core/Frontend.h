@@ -4,8 +4,11 @@
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/Telemetry.h>
 
+#include <tsl/robin_map.h>
+
 #include <array>
 #include <cstdint>
+#include <memory_resource>
 #include <set>
 #include <stddef.h>
 #include <vector>
@@ -25,7 +28,15 @@ public:
     bool HasInvalidInstruction{};
   };
 
-  Decoder(FEXCore::Context::Context *ctx);
+  // What a legacy or REX prefix byte does to the instruction
+  struct PrefixInfo {
+    uint32_t Flags;
+    uint8_t OpAddr;   ///< DecodeFlags::FLAG_*_SIZE_LAST pushed on to the OpAddr stack, 0 if none
+    bool IsPrefix;
+    bool IsEscape;    ///< Selects the 0F overlay tables through LastEscapePrefix
+  };
+
+  Decoder(FEXCore::Context::Context *ctx, std::pmr::memory_resource *Scratch);
   ~Decoder();
   void DecodeInstructionsAtEntry(uint8_t const* InstStream, uint64_t PC, std::function<void(uint64_t BlockEntry, uint64_t Start, uint64_t Length)> AddContainedCodePage);
 
@@ -43,6 +54,17 @@ public:
     PoolObject.DelayedDisownBuffer();
   }
 
+  /**
+   * @brief Drops the cached decodes of every instruction that could overlap [Start, Start + Length)
+   *
+   * Needs to be called wherever compiled code of the range gets invalidated.
+   */
+  void InvalidateDecodeCache(uint64_t Start, uint64_t Length);
+  void ClearDecodeCache();
+
+  // Instructions of the last DecodeInstructionsAtEntry call that came from the decode cache
+  uint64_t DecodeCacheHits {};
+
 private:
   // To pass any information from instruction prefixes
   // down into the actual instruction handling machinery.
@@ -55,7 +77,24 @@ private:
   FEXCore::Context::Context *CTX;
   const FEXCore::HLE::SyscallOSABI OSABI{};
 
+  // Decode tables that differ between 32-bit and 64-bit guests
+  FEXCore::X86Tables::X86InstInfo const *BaseOps;
+  FEXCore::X86Tables::X86InstInfo const *SecondBaseOps;
+  FEXCore::X86Tables::X86InstInfo const *RepModOps;
+  FEXCore::X86Tables::X86InstInfo const *RepNEModOps;
+  FEXCore::X86Tables::X86InstInfo const *OpSizeModOps;
+  FEXCore::X86Tables::X86InstInfo const *PrimaryInstGroupOps;
+  FEXCore::X86Tables::X86InstInfo const *H0F3ATableOps;
+
+  // REX only exists in 64-bit mode, 0x40-0x4F are INC/DEC otherwise
+  std::array<PrefixInfo, 256> const *PrefixTable;
+  uint8_t const *PrefixHighNibbles;
+
+  uint8_t ScanPrefixes() const;
+
   bool DecodeInstruction(uint64_t PC);
+  bool DecodeCachedInstruction(uint64_t PC);
+  void CacheDecodedInstruction();
 
   void BranchTargetInMultiblockRange();
   bool BranchTargetCanContinue(bool FinalInstruction) const;
@@ -90,10 +129,19 @@ private:
   uint64_t SectionMaxAddress {~0ULL};
 
   std::vector<DecodedBlocks> Blocks;
-  std::set<uint64_t> BlocksToDecode;
-  std::set<uint64_t> HasBlocks;
+
+  // Only live while decoding, these are emptied before returning so their nodes are dropped before the scratch arena is reset.
+  std::pmr::memory_resource *Scratch;
+  std::pmr::set<uint64_t> BlocksToDecode;
+  std::pmr::set<uint64_t> HasBlocks;
   std::set<uint64_t> *ExternalBranches {nullptr};
 
+  // Decoding only depends on the guest bytes and the context's mode, so instructions are kept across compilations until their code changes.
+  // Bucketed by the page an instruction starts on, which invalidation uses to drop whole pages at once.
+  tsl::robin_map<uint64_t, tsl::robin_map<uint64_t, FEXCore::X86Tables::DecodedInst>> DecodeCache;
+  size_t DecodeCacheEntries {};
+  const size_t DecodeCacheMaxEntries;
+
   // ModRM rm decoding
   using DecodeModRMPtr = void (FEXCore::Frontend::Decoder::*)(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM);
   void DecodeModRM_16(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM);
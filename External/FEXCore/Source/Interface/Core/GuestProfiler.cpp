@@ -0,0 +1,389 @@
+#include "Interface/Context/Context.h"
+#include "Interface/Core/ArchHelpers/MContext.h"
+#include "Interface/Core/GuestProfiler.h"
+#include "Interface/IR/AOTIR.h"
+
+#include <FEXCore/Debug/HotTrace.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/HLE/SourcecodeResolver.h>
+#include <FEXCore/HLE/SyscallHandler.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXHeaderUtils/Syscalls.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <fmt/format.h>
+#include <iterator>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <string_view>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace FEXCore {
+  void GuestProfileThread::PushSample(uint64_t GuestRIP, uint64_t BlockRIP) {
+    const auto Write = SampleWrite.load(std::memory_order_relaxed);
+    if ((Write - SampleRead.load(std::memory_order_acquire)) >= RING_SIZE) {
+      Dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    Samples[Write % RING_SIZE] = {GuestRIP, BlockRIP};
+    SampleWrite.store(Write + 1, std::memory_order_release);
+  }
+
+  template<typename F>
+  void GuestProfileThread::DrainSamples(F Callback) {
+    auto Read = SampleRead.load(std::memory_order_relaxed);
+    const auto Write = SampleWrite.load(std::memory_order_acquire);
+    for (; Read != Write; ++Read) {
+      Callback(Samples[Read % RING_SIZE]);
+    }
+    SampleRead.store(Read, std::memory_order_release);
+  }
+
+  GuestProfiler::GuestProfiler(FEXCore::Context::Context *_CTX)
+    : CTX {_CTX}
+    , OutputPath {CTX->Config.GuestProfile()}
+    , HotTracePath {CTX->Config.HotTraceCapture()}
+    , HotTraceBlocks {CTX->Config.HotTraceBlocks()}
+    , IntervalNS {1'000'000'000ULL / std::max<uint32_t>(CTX->Config.GuestProfileFrequency(), 1U)} {
+    uint64_t OldMask = FEXCore::Threads::SetSignalMask(~0ULL);
+    WorkerThread = FEXCore::Threads::Thread::Create(ThreadHandler, this);
+    FEXCore::Threads::SetSignalMask(OldMask);
+  }
+
+  GuestProfiler::~GuestProfiler() {
+    {
+      std::lock_guard lk(WorkerMutex);
+      ShuttingDown = true;
+    }
+    WorkerCV.notify_all();
+
+    if (WorkerThread->joinable()) {
+      WorkerThread->join(nullptr);
+    }
+  }
+
+  void *GuestProfiler::ThreadHandler(void *Arg) {
+    reinterpret_cast<GuestProfiler*>(Arg)->ExecutionThread();
+    return nullptr;
+  }
+
+  void GuestProfiler::ExecutionThread() {
+    // Set our thread name so we can see its relation
+    char ThreadName[16] = "GuestProfiler\0";
+    pthread_setname_np(pthread_self(), ThreadName);
+
+    while (true) {
+      {
+        std::unique_lock lk(WorkerMutex);
+        if (WorkerCV.wait_for(lk, DRAIN_INTERVAL, [this] { return ShuttingDown; })) {
+          break;
+        }
+      }
+
+      std::lock_guard lk(ThreadsMutex);
+      for (auto Data : Threads) {
+        Drain(Data);
+      }
+    }
+  }
+
+  void GuestProfiler::Drain(GuestProfileThread *Data) {
+    Data->DrainSamples([this, Data](GuestProfileThread::Sample const &Sample) {
+      ++Counts[{Data->TID, Sample.GuestRIP}];
+      ++TotalSamples;
+      ResolveLocation(Sample.GuestRIP);
+
+      if (CapturesHotTrace() && Sample.BlockRIP != GuestProfileThread::SAMPLE_FEX) {
+        ++BlockCounts[Sample.BlockRIP];
+        ResolveLocation(Sample.BlockRIP);
+      }
+    });
+
+    DroppedSamples += Data->Dropped.exchange(0, std::memory_order_relaxed);
+  }
+
+  void GuestProfiler::ResolveLocation(uint64_t GuestRIP) {
+    if (GuestRIP == GuestProfileThread::SAMPLE_FEX || Locations.contains(GuestRIP)) {
+      return;
+    }
+
+    // Resolve the file now, it might be unmapped by the time the profile is written
+    SampleLocation Location{};
+    if (CTX->SyscallHandler) {
+      auto Lookup = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
+      if (Lookup.Entry) {
+        Location.Filename = Lookup.Entry->Filename;
+        Location.FileId = Lookup.Entry->FileId;
+        Location.FileOffset = GuestRIP - Lookup.VAFileStart;
+      }
+    }
+    Locations.emplace(GuestRIP, std::move(Location));
+  }
+
+  void GuestProfiler::StartThread(FEXCore::Core::InternalThreadState *Thread) {
+    if (!Thread->ProfileData) {
+      Thread->ProfileData = std::make_unique<GuestProfileThread>();
+    }
+
+    auto Data = Thread->ProfileData.get();
+    Data->TID = FHU::Syscalls::gettid();
+
+    {
+      std::lock_guard lk(ThreadsMutex);
+      // Drop anything left over from before a fork, those samples belong to the parent's profile
+      Data->SampleRead.store(Data->SampleWrite.load());
+      Data->Dropped.store(0);
+      Threads.emplace_back(Data);
+    }
+
+    sigevent Event{};
+    Event.sigev_notify = SIGEV_THREAD_ID;
+    Event.sigev_signo = SIGPROF;
+    Event.sigev_value.sival_ptr = Data;
+    Event._sigev_un._tid = Data->TID;
+
+    int TimerID{};
+    if (::syscall(SYS_timer_create, CLOCK_THREAD_CPUTIME_ID, &Event, &TimerID) == -1) {
+      LogMan::Msg::EFmt("Couldn't create guest profiler timer: {}", strerror(errno));
+      Data->Timer = -1;
+      return;
+    }
+    Data->Timer = TimerID;
+
+    itimerspec Interval{};
+    Interval.it_interval.tv_sec = IntervalNS / 1'000'000'000ULL;
+    Interval.it_interval.tv_nsec = IntervalNS % 1'000'000'000ULL;
+    Interval.it_value = Interval.it_interval;
+    ::syscall(SYS_timer_settime, Data->Timer, 0, &Interval, nullptr);
+  }
+
+  void GuestProfiler::StopThread(FEXCore::Core::InternalThreadState *Thread) {
+    auto Data = Thread->ProfileData.get();
+    if (!Data) {
+      return;
+    }
+
+    if (Data->Timer != -1) {
+      ::syscall(SYS_timer_delete, Data->Timer);
+      Data->Timer = -1;
+    }
+
+    std::lock_guard lk(ThreadsMutex);
+    auto it = std::find(Threads.begin(), Threads.end(), Data);
+    if (it != Threads.end()) {
+      Drain(Data);
+      Threads.erase(it);
+    }
+  }
+
+  void GuestProfiler::BeginCodeBufferChange(FEXCore::Core::InternalThreadState *Thread) {
+    if (auto Data = Thread->ProfileData.get()) {
+      // The signal handler only runs on this thread, a compiler barrier is enough
+      Data->Busy.store(true, std::memory_order_relaxed);
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+  }
+
+  void GuestProfiler::EndCodeBufferChange(FEXCore::Core::InternalThreadState *Thread) {
+    if (auto Data = Thread->ProfileData.get()) {
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      Data->Busy.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  void GuestProfiler::RecordBlock(uint64_t GuestRIP, uint64_t StartAddr, uint64_t Length) {
+    if (!CapturesHotTrace() || Length == 0) {
+      return;
+    }
+
+    std::lock_guard lk(BlockRangesMutex);
+    BlockRanges[GuestRIP] = {StartAddr, Length};
+  }
+
+  bool GuestProfiler::HandleSignal(FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) {
+    auto SigInfo = static_cast<siginfo_t*>(info);
+    auto Data = Thread ? Thread->ProfileData.get() : nullptr;
+
+    // Anything that isn't our timer belongs to the guest
+    if (!Data || SigInfo->si_code != SI_TIMER || SigInfo->si_value.sival_ptr != Data) {
+      return false;
+    }
+
+    uint64_t GuestRIP = GuestProfileThread::SAMPLE_FEX;
+    uint64_t BlockRIP = GuestProfileThread::SAMPLE_FEX;
+    if (!Data->Busy.load(std::memory_order_relaxed)) {
+      GuestRIP = Thread->CPUBackend->GetGuestRIPForHostPC(ArchHelpers::Context::GetPc(ucontext), &BlockRIP).value_or(GuestProfileThread::SAMPLE_FEX);
+    }
+
+    Data->PushSample(GuestRIP, BlockRIP);
+    return true;
+  }
+
+  void GuestProfiler::WriteProfile() {
+    std::lock_guard lk(ThreadsMutex);
+    if (Written) {
+      return;
+    }
+    Written = true;
+
+    for (auto Data : Threads) {
+      Drain(Data);
+    }
+
+    if (!OutputPath.empty()) {
+      WriteCollapsedStacks();
+    }
+
+    if (CapturesHotTrace()) {
+      WriteHotTrace();
+    }
+  }
+
+  void GuestProfiler::WriteCollapsedStacks() {
+    auto FrameName = [this](uint64_t GuestRIP) -> std::string {
+      if (GuestRIP == GuestProfileThread::SAMPLE_FEX) {
+        return "[FEX]";
+      }
+
+      auto &Location = Locations.at(GuestRIP);
+      if (Location.Filename.empty()) {
+        return fmt::format("[unknown];0x{:x}", GuestRIP);
+      }
+
+      const auto Module = std::filesystem::path(Location.Filename).filename().string();
+      auto Map = CTX->Symbols.GetSymbolMap(Location.Filename, Location.FileId);
+      auto Sym = Map ? Map->FindSymbolMapping(Location.FileOffset) : nullptr;
+      if (Sym) {
+        return fmt::format("{};{}", Module, Sym->Name);
+      }
+      return fmt::format("{};0x{:x}", Module, Location.FileOffset);
+    };
+
+    // Fold the individual instructions in to their guest functions
+    std::map<std::string, uint64_t> Stacks;
+    for (auto &[Key, Count] : Counts) {
+      Stacks[fmt::format("thread-{};{}", Key.first, FrameName(Key.second))] += Count;
+    }
+
+    std::string Output;
+    for (auto &[Stack, Count] : Stacks) {
+      fmt::format_to(std::back_inserter(Output), "{} {}\n", Stack, Count);
+    }
+
+    const auto Path = fmt::format("{}.{}", OutputPath, ::getpid());
+    int fd = open(Path.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+    if (fd == -1) {
+      LogMan::Msg::EFmt("Couldn't open guest profile '{}': {}", Path, strerror(errno));
+      return;
+    }
+
+    write(fd, Output.data(), Output.size());
+    close(fd);
+
+    LogMan::Msg::IFmt("Wrote {} guest profile samples to '{}', {} dropped", TotalSamples, Path, DroppedSamples);
+  }
+
+  void GuestProfiler::WriteHotTrace() {
+    std::vector<std::pair<uint64_t, uint64_t>> Hottest(BlockCounts.begin(), BlockCounts.end());
+    std::sort(Hottest.begin(), Hottest.end(), [](auto const &a, auto const &b) {
+      return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+
+    HotTrace::FileHeader Header {
+      .Cookie = HotTrace::COOKIE,
+      .Version = HotTrace::VERSION,
+      .NumBlocks = 0,
+      .TotalSamples = TotalSamples,
+      .State = {
+        .Is64BitMode = CTX->Config.Is64BitMode(),
+        .Multiblock = CTX->Config.Multiblock(),
+        .TSOEnabled = CTX->IsTSOEnabled(),
+        .ParanoidTSO = CTX->Config.ParanoidTSO(),
+        .ABILocalFlags = CTX->Config.ABILocalFlags(),
+        .ABINoPF = CTX->Config.ABINoPF(),
+        .x87ReducedPrecision = CTX->Config.x87ReducedPrecision(),
+        .SMCChecks = static_cast<uint8_t>(CTX->Config.SMCChecks()),
+        .MaxInstPerBlock = CTX->Config.MaxInstPerBlock(),
+        .StackTSOElision = CTX->Config.StackTSOElision(),
+        .FramePointerTSOElision = CTX->Config.FramePointerTSOElision(),
+        .Pad = {},
+      },
+    };
+
+    std::string Output(sizeof(Header), '\0');
+    std::vector<uint8_t> Code;
+    uint64_t Missing{};
+
+    std::lock_guard lk(BlockRangesMutex);
+    for (auto &[BlockRIP, Samples] : Hottest) {
+      if (Header.NumBlocks == HotTraceBlocks) {
+        break;
+      }
+
+      auto Range = BlockRanges.find(BlockRIP);
+      if (Range == BlockRanges.end()) {
+        // Came from the code cache or was compiled before a fork
+        ++Missing;
+        continue;
+      }
+
+      // The code might have been unmapped since it was compiled, read it without faulting.
+      // Partial reads only happen between iovecs, so the tail is its own.
+      const auto [Start, Length] = Range->second;
+      Code.resize(Length + HOT_TRACE_CODE_TAIL);
+      iovec Local[2] = {{Code.data(), Length}, {Code.data() + Length, HOT_TRACE_CODE_TAIL}};
+      iovec Remote[2] = {{reinterpret_cast<void*>(Start), Length}, {reinterpret_cast<void*>(Start + Length), HOT_TRACE_CODE_TAIL}};
+      const auto Read = ::process_vm_readv(::getpid(), Local, 2, Remote, 2, 0);
+      if (Read < static_cast<ssize_t>(Length)) {
+        ++Missing;
+        continue;
+      }
+
+      std::string_view Filename;
+      uint64_t FileOffset{};
+      if (auto Location = Locations.find(BlockRIP); Location != Locations.end()) {
+        Filename = Location->second.Filename;
+        FileOffset = Location->second.FileOffset;
+      }
+
+      HotTrace::BlockHeader Block {
+        .GuestRIP = BlockRIP,
+        .DecodedStart = Start,
+        .DecodedLength = Length,
+        .CodeStart = Start,
+        .CodeSize = static_cast<uint64_t>(Read),
+        .Samples = Samples,
+        .FileOffset = FileOffset,
+        .FilenameLength = static_cast<uint32_t>(Filename.size()),
+        .Pad = 0,
+      };
+
+      Output.append(reinterpret_cast<char const*>(&Block), sizeof(Block));
+      Output.append(Filename);
+      Output.append(reinterpret_cast<char const*>(Code.data()), Read);
+      ++Header.NumBlocks;
+    }
+
+    memcpy(Output.data(), &Header, sizeof(Header));
+
+    const auto Path = fmt::format("{}.{}", HotTracePath, ::getpid());
+    int fd = open(Path.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+    if (fd == -1) {
+      LogMan::Msg::EFmt("Couldn't open hot trace '{}': {}", Path, strerror(errno));
+      return;
+    }
+
+    write(fd, Output.data(), Output.size());
+    close(fd);
+
+    LogMan::Msg::IFmt("Wrote {} hot blocks to '{}', {} skipped without their code", Header.NumBlocks, Path, Missing);
+  }
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <FEXCore/Utils/Threads.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace FEXCore::Context {
+  struct Context;
+}
+
+namespace FEXCore::Core {
+  struct InternalThreadState;
+}
+
+namespace FEXCore {
+/**
+ * @brief Per-thread state of the guest profiler
+ *
+ * Samples are pushed from the SIGPROF handler of the owning thread and drained by the profiler thread.
+ * The signal handler leaves the code buffers alone while `Busy` is set.
+ *
+ * Lives as long as the thread, so a timer signal that was already queued when sampling stopped is still recognized.
+ */
+class GuestProfileThread final {
+public:
+  GuestProfileThread() = default;
+  GuestProfileThread(GuestProfileThread const&) = delete;
+  GuestProfileThread& operator=(GuestProfileThread const&) = delete;
+
+private:
+  friend class GuestProfiler;
+
+  constexpr static size_t RING_SIZE = 4096;
+  // Guest RIP of samples that didn't land in a known guest block: dispatcher, compiler, syscalls, ...
+  constexpr static uint64_t SAMPLE_FEX = 0;
+
+  struct Sample {
+    uint64_t GuestRIP;
+    // Entry of the block the sample landed in
+    uint64_t BlockRIP;
+  };
+
+  // Signal handler side, must not allocate or lock
+  void PushSample(uint64_t GuestRIP, uint64_t BlockRIP);
+
+  template<typename F>
+  void DrainSamples(F Callback);
+
+  uint32_t TID{};
+  int Timer{-1};
+
+  std::atomic_bool Busy{};
+
+  // Single producer, single consumer ring
+  std::array<Sample, RING_SIZE> Samples;
+  std::atomic<uint64_t> SampleWrite{};
+  std::atomic<uint64_t> SampleRead{};
+  std::atomic<uint64_t> Dropped{};
+};
+
+/**
+ * @brief Built-in sampling profiler for guest code
+ *
+ * Every guest thread gets a CPU time timer that delivers SIGPROF to itself.
+ * The handler maps the interrupted host PC back to the guest instruction with the PC map of the block it landed in.
+ *
+ * At exit the samples are attributed to guest functions and written in collapsed stack format:
+ * `thread-<tid>;<guest file>;<symbol> <count>`
+ *
+ * With HotTraceCapture the code of the blocks with the most samples is written as well, see FEXCore/Debug/HotTrace.h.
+ * Only blocks compiled by this process are known, a forked child doesn't see the ones it inherited.
+ */
+class GuestProfiler final {
+public:
+  explicit GuestProfiler(FEXCore::Context::Context *CTX);
+  ~GuestProfiler();
+
+  // Called from the guest thread itself around executing guest code
+  void StartThread(FEXCore::Core::InternalThreadState *Thread);
+  void StopThread(FEXCore::Core::InternalThreadState *Thread);
+
+  // Called from the guest thread around replacing its code buffers
+  void BeginCodeBufferChange(FEXCore::Core::InternalThreadState *Thread);
+  void EndCodeBufferChange(FEXCore::Core::InternalThreadState *Thread);
+
+  bool CapturesHotTrace() const {
+    return !HotTracePath.empty();
+  }
+
+  // Called after compiling a block, remembers which guest code it was decoded from
+  void RecordBlock(uint64_t GuestRIP, uint64_t StartAddr, uint64_t Length);
+
+  static bool HandleSignal(FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext);
+
+  /**
+   * @brief Symbolizes the samples and writes the profile and hot trace
+   *
+   * The syscall handler needs to still be alive for the guest file lookups.
+   * Only the first call writes anything.
+   */
+  void WriteProfile();
+
+private:
+  constexpr static auto DRAIN_INTERVAL = std::chrono::milliseconds(100);
+  // Captured past the end of a block, the frontend reads a full instruction's worth of bytes
+  constexpr static uint64_t HOT_TRACE_CODE_TAIL = 16;
+
+  struct SampleLocation {
+    std::string Filename;
+    std::string FileId;
+    uint64_t FileOffset;
+  };
+
+  struct BlockRange {
+    uint64_t Start;
+    uint64_t Length;
+  };
+
+  static void *ThreadHandler(void *Arg);
+  void ExecutionThread();
+
+  // ThreadsMutex must be held
+  void Drain(GuestProfileThread *Data);
+  void ResolveLocation(uint64_t GuestRIP);
+  void WriteCollapsedStacks();
+  void WriteHotTrace();
+
+  FEXCore::Context::Context *CTX;
+  std::string OutputPath;
+  std::string HotTracePath;
+  uint32_t HotTraceBlocks;
+  uint64_t IntervalNS;
+
+  std::mutex ThreadsMutex;
+  std::vector<GuestProfileThread*> Threads;
+  // Sample count for each {tid, guest RIP}
+  std::map<std::pair<uint32_t, uint64_t>, uint64_t> Counts;
+  // Resolved while the guest mapping is still around
+  std::unordered_map<uint64_t, SampleLocation> Locations;
+  // Sample count for each block entry, only with the hot trace enabled
+  std::unordered_map<uint64_t, uint64_t> BlockCounts;
+  uint64_t TotalSamples{};
+  uint64_t DroppedSamples{};
+  bool Written{};
+
+  std::mutex BlockRangesMutex;
+  std::unordered_map<uint64_t, BlockRange> BlockRanges;
+
+  std::mutex WorkerMutex;
+  bool ShuttingDown{};
+  std::condition_variable WorkerCV;
+  std::unique_ptr<FEXCore::Threads::Thread> WorkerThread;
+};
+}
@@ -71,11 +71,12 @@ HostFeatures::HostFeatures() {
   SupportsSSE4A = true;
 #ifdef VIXL_SIMULATOR
   // Hardcode enable SVE with 256-bit wide registers.
-  SupportsAVX = true;
+  SupportsSVE256 = true;
 #else
-  SupportsAVX = Features.Has(vixl::CPUFeatures::Feature::kSVE2) &&
-                vixl::aarch64::CPU::ReadSVEVectorLengthInBits() >= 256;
+  SupportsSVE256 = Features.Has(vixl::CPUFeatures::Feature::kSVE2) &&
+                   vixl::aarch64::CPU::ReadSVEVectorLengthInBits() >= 256;
 #endif
+  SupportsAVX = SupportsSVE256;
   SupportsSHA = true;
   SupportsBMI1 = true;
   SupportsBMI2 = true;
@@ -125,6 +126,7 @@ HostFeatures::HostFeatures() {
   Supports3DNow = Features.has(Xbyak::util::Cpu::t3DN) && Features.has(Xbyak::util::Cpu::tE3DN);
   SupportsSSE4A = Features.has(Xbyak::util::Cpu::tSSE4a);
   SupportsAVX = true;
+  SupportsSVE256 = false;
   SupportsSHA = Features.has(Xbyak::util::Cpu::tSHA);
   SupportsBMI1 = Features.has(Xbyak::util::Cpu::tBMI1);
   SupportsBMI2 = Features.has(Xbyak::util::Cpu::tBMI2);
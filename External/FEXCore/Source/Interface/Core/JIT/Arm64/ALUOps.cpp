@@ -49,7 +49,7 @@ DEF_OP(EntrypointOffset) {
     Mask = 0xFFFF'FFFFULL;
   }
 
-  LoadConstant(ARMEmitter::Size::i64Bit, Dst, Constant & Mask);
+  InsertGuestRIPMove(Dst, Constant & Mask);
 }
 
 DEF_OP(InlineConstant) {
@@ -1138,16 +1138,16 @@ DEF_OP(VExtractToGPR) {
   const auto PerformMove = [&](const ARMEmitter::VRegister reg, int index) {
     switch (OpSize) {
       case 1:
-        umov<ARMEmitter::SubRegSize::i8Bit>(Dst, Vector, index);
+        umov<ARMEmitter::SubRegSize::i8Bit>(Dst, reg, index);
         break;
       case 2:
-        umov<ARMEmitter::SubRegSize::i16Bit>(Dst, Vector, index);
+        umov<ARMEmitter::SubRegSize::i16Bit>(Dst, reg, index);
         break;
       case 4:
-        umov<ARMEmitter::SubRegSize::i32Bit>(Dst, Vector, index);
+        umov<ARMEmitter::SubRegSize::i32Bit>(Dst, reg, index);
         break;
       case 8:
-        umov<ARMEmitter::SubRegSize::i64Bit>(Dst, Vector, index);
+        umov<ARMEmitter::SubRegSize::i64Bit>(Dst, reg, index);
         break;
       default:
         LOGMAN_MSG_A_FMT("Unhandled ExtractElementSize: {}", OpSize);
@@ -1160,6 +1160,13 @@ DEF_OP(VExtractToGPR) {
     // can treat the operation as a 128-bit operation, even
     // when acting on larger register sizes.
     PerformMove(Vector, Op->Index);
+  } else if (PairedAVX) {
+    LOGMAN_THROW_AA_FMT(Offset < AVXRegBitSize,
+                        "Trying to extract element outside bounds of register. Offset={}, Index={}",
+                        Offset, Op->Index);
+
+    // The upper lane already lives in its own register.
+    PerformMove(GetVRegPair(Op->Vector.ID()).second, Op->Index - SSERegBitSize / ElementSizeBits);
   } else {
     LOGMAN_THROW_AA_FMT(HostSupportsSVE,
                         "Host doesn't support SVE. Cannot perform 256-bit operation.");
@@ -6,8 +6,11 @@ $end_info$
 */
 #include "Interface/Context/Context.h"
 #include "Interface/Core/JIT/Arm64/JITClass.h"
+#include "Interface/Core/ObjectCache/ObjectCacheService.h"
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include <cstring>
+
 namespace FEXCore::CPU {
 
 uint64_t Arm64JITCore::GetNamedSymbolLiteral(FEXCore::CPU::RelocNamedSymbolLiteral::NamedSymbol Op) {
@@ -78,6 +81,18 @@ void Arm64JITCore::InsertGuestRIPMove(ARMEmitter::Register Reg, uint64_t Constan
   Relocations.emplace_back(MoveABI);
 }
 
+void Arm64JITCore::InsertGuestRIPLiteral(const uint64_t GuestRIP) {
+  Relocation MoveABI{};
+  MoveABI.GuestRIPLiteral.Header.Type = FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_LITERAL;
+  // Offset is the offset from the entrypoint of the block
+  auto CurrentCursor = GetCursorAddress<uint8_t *>();
+  MoveABI.GuestRIPLiteral.Offset = CurrentCursor - GuestEntry;
+  MoveABI.GuestRIPLiteral.GuestRIP = GuestRIP;
+
+  dc64(GuestRIP);
+  Relocations.emplace_back(MoveABI);
+}
+
 bool Arm64JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uint64_t CursorEntry, size_t NumRelocations, const char* EntryRelocations) {
   size_t DataIndex{};
   for (size_t j = 0; j < NumRelocations; ++j) {
@@ -98,7 +113,8 @@ bool Arm64JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uin
       }
       case FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE: {
         uint64_t Pointer = reinterpret_cast<uint64_t>(EmitterCTX->ThunkHandler->LookupThunk(Reloc->NamedThunkMove.Symbol));
-        if (Pointer == ~0ULL) {
+        if (Pointer == 0) {
+          // Thunk isn't registered in this process
           return false;
         }
 
@@ -109,11 +125,10 @@ bool Arm64JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uin
         break;
       }
       case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_MOVE: {
-        // XXX: Reenable once the JIT Object Cache is upstream
-        // XXX: Should spin the relocation list, create a list of guest RIP moves, and ask for them all once, reduces lock contention.
-        uint64_t Pointer = ~0ULL; // EmitterCTX->JITObjectCache->FindRelocatedRIP(Reloc->GuestRIPMove.GuestRIP);
-        if (Pointer == ~0ULL) {
-          return false;
+        // Serialized guest RIPs are relative to the block entry
+        uint64_t Pointer = GuestEntry + Reloc->GuestRIPMove.GuestRIP;
+        if (!EmitterCTX->Config.Is64BitMode()) {
+          Pointer &= 0xFFFF'FFFFULL;
         }
 
         // Relocation occurs at the cursorEntry + offset relative to that cursor.
@@ -122,10 +137,60 @@ bool Arm64JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uin
         DataIndex += sizeof(Reloc->GuestRIPMove);
         break;
       }
+      case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_LITERAL: {
+        // Serialized guest RIPs are relative to the block entry
+        uint64_t Pointer = GuestEntry + Reloc->GuestRIPLiteral.GuestRIP;
+        if (!EmitterCTX->Config.Is64BitMode()) {
+          Pointer &= 0xFFFF'FFFFULL;
+        }
+
+        // Relocation occurs at the cursorEntry + offset relative to that cursor.
+        SetCursorOffset(CursorEntry + Reloc->GuestRIPLiteral.Offset);
+        dc64(Pointer);
+        DataIndex += sizeof(Reloc->GuestRIPLiteral);
+        break;
+      }
+      default:
+        // Written by a newer FEX, don't try to use it
+        return false;
     }
   }
 
   return true;
 }
+
+void *Arm64JITCore::RelocateJITObjectCode(uint64_t Entry, CodeSerialize::CodeObjectFileSection const *SerializationData) {
+  FEXCORE_PROFILE_SCOPED("Arm64::RelocateJITObjectCode");
+
+  const auto Data = SerializationData->Data;
+  constexpr uint64_t Alignment = CodeSerialize::CodeSerializationData::ENTRY_ALIGNMENT;
+
+  if ((GetCursorOffset() + Data->HostCodeLength + Alignment + MaxBlockTailSize(0)) > GetCodeBufferLimit()) {
+    CTX->ClearCodeCache(ThreadState);
+  }
+
+  // Place the code with the alignment it was emitted with so its literals keep their alignment
+  CursorIncrement((Data->HostCodeAlignment - GetCursorAddress<uint64_t>()) & (Alignment - 1));
+
+  const auto CursorBegin = GetCursorOffset();
+  auto HostEntry = GetCursorAddress<uint8_t *>();
+  memcpy(HostEntry, SerializationData->HostCode, Data->HostCodeLength);
+
+  if (!ApplyRelocations(Entry, reinterpret_cast<uint64_t>(HostEntry), CursorBegin,
+                        SerializationData->NumRelocations, SerializationData->Relocations)) {
+    // Throw the copy away, the caller will compile the block instead
+    SetCursorOffset(CursorBegin);
+    return nullptr;
+  }
+
+  SetCursorOffset(CursorBegin + Data->HostCodeLength);
+  ClearICache(HostEntry, Data->HostCodeLength);
+
+  // Cached code has no instruction boundaries, the PC map only knows the block entry
+  CursorIncrement(EmitBlockTail(Entry, HostEntry, Data->HostCodeLength, GetCursorAddress<uint8_t *>()));
+  Align();
+
+  return HostEntry;
+}
 }
 
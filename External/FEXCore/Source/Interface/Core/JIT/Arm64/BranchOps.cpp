@@ -61,18 +61,20 @@ DEF_OP(ExitFunction) {
 
   uint64_t NewRIP;
 
-  if (IsInlineConstant(Op->NewRIP, &NewRIP) || IsInlineEntrypointOffset(Op->NewRIP, &NewRIP)) {
-    ARMEmitter::ForwardLabel l_BranchHost;
-    ARMEmitter::ForwardLabel l_BranchGuest;
+  const bool IsEntrypointOffset = IsInlineEntrypointOffset(Op->NewRIP, &NewRIP);
+  if (IsEntrypointOffset || IsInlineConstant(Op->NewRIP, &NewRIP)) {
+    auto l_BranchHost = InsertNamedSymbolLiteral(FEXCore::CPU::RelocNamedSymbolLiteral::NamedSymbol::SYMBOL_LITERAL_EXITFUNCTION_LINKER);
 
-    ldr(ARMEmitter::XReg::x0, &l_BranchHost);
+    ldr(ARMEmitter::XReg::x0, &l_BranchHost.Loc);
     blr(ARMEmitter::Reg::r0);
 
-    Bind(&l_BranchHost);
-    dc64(ThreadState->CurrentFrame->Pointers.Common.ExitFunctionLinker);
-    Bind(&l_BranchGuest);
-    dc64(NewRIP);
-
+    PlaceNamedSymbolLiteral(l_BranchHost);
+    if (IsEntrypointOffset) {
+      InsertGuestRIPLiteral(NewRIP);
+    }
+    else {
+      dc64(NewRIP);
+    }
   } else {
 
     ARMEmitter::ForwardLabel FullLookup;
@@ -334,8 +336,7 @@ DEF_OP(Thunk) {
 
   mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, GetReg(Op->ArgPtr.ID()));
 
-  auto thunkFn = ThreadState->CTX->ThunkHandler->LookupThunk(Op->ThunkNameHash);
-  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r2, (uintptr_t)thunkFn);
+  InsertNamedThunkRelocation(ARMEmitter::Reg::r2, Op->ThunkNameHash);
 #ifdef VIXL_SIMULATOR
   GenerateIndirectRuntimeCall<void, void*, void*>(ARMEmitter::Reg::r2);
 #else
@@ -354,7 +355,7 @@ DEF_OP(ValidateCode) {
   int idx = 0;
 
   LoadConstant(ARMEmitter::Size::i64Bit, GetReg(Node), 0);
-  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, Entry + Op->Offset);
+  InsertGuestRIPMove(ARMEmitter::Reg::r0, Entry + Op->Offset);
   LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r1, 1);
 
   const auto Dst = GetReg(Node);
@@ -405,7 +406,7 @@ DEF_OP(ThreadRemoveCodeEntry) {
   PushDynamicRegsAndLR(TMP1);
 
   mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, STATE.R());
-  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r1, Entry);
+  InsertGuestRIPMove(ARMEmitter::Reg::r1, Entry);
 
   ldr(ARMEmitter::XReg::x2, STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.ThreadRemoveCodeEntryFromJIT));
   SpillStaticRegs();
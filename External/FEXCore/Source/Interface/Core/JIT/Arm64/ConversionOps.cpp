@@ -78,6 +78,15 @@ DEF_OP(VInsGPR) {
       Insert(Dst, DestIdx);
       splice<ARMEmitter::OpType::Destructive>(ARMEmitter::SubRegSize::i64Bit, Dst.Z(), PRED_TMP_16B, Dst.Z(), DestVector.Z());
     }
+  } else if (PairedAVX && Is256Bit) {
+    const auto DestPair = GetVRegPair(Op->DestVector.ID());
+    const auto InUpperLane = DestIdx >= ElementsPer128Bit;
+
+    mov(VTMP1.Q(), DestPair.first.Q());
+    mov(VTMP2.Q(), DestPair.second.Q());
+    ins(SubEmitSize, InUpperLane ? VTMP2 : VTMP1, DestIdx % ElementsPer128Bit, Src);
+    mov(Dst.Q(), VTMP1.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP2.Q());
   } else {
     mov(Dst.Q(), DestVector.Q());
     ins(SubEmitSize, Dst, DestIdx, Src);
@@ -106,6 +115,11 @@ DEF_OP(VCastFromGPR) {
       break;
     default: LOGMAN_MSG_A_FMT("Unknown castGPR element size: {}", Op->Header.ElementSize);
   }
+
+  if (IsFPRPair(Node)) {
+    const auto Upper = GetVRegUpper(Node);
+    eor(Upper.Q(), Upper.Q(), Upper.Q());
+  }
 }
 
 DEF_OP(Float_FromGPR_S) {
@@ -289,6 +303,29 @@ DEF_OP(Vector_FToF) {
         LOGMAN_MSG_A_FMT("Unknown Vector_FToF Type : 0x{:04x}", Conv);
         break;
     }
+  } else if (PairedAVX && Is256Bit) {
+    switch (Conv) {
+      case 0x0402: // Float <- Half
+      case 0x0804: { // Double <- Float
+        fcvtl(SubEmitSize, VTMP1.D(), Vector.D());
+        fcvtl2(SubEmitSize, GetVRegUpper(Node).Q(), Vector.Q());
+        mov(Dst.Q(), VTMP1.Q());
+        break;
+      }
+      case 0x0204: // Half <- Float
+      case 0x0408: { // Float <- Double
+        // Both halves narrow in to the lower half, which the upper half duplicates.
+        const auto Src = GetVRegPair(Op->Vector.ID());
+        fcvtn(SubEmitSize, VTMP1.D(), Src.first.D());
+        fcvtn2(SubEmitSize, VTMP1.Q(), Src.second.Q());
+        mov(Dst.Q(), VTMP1.Q());
+        mov(GetVRegUpper(Node).Q(), VTMP1.Q());
+        break;
+      }
+      default:
+        LOGMAN_MSG_A_FMT("Unknown Vector_FToF Type : 0x{:04x}", Conv);
+        break;
+    }
   } else {
     switch (Conv) {
       case 0x0402: // Float <- Half
@@ -509,10 +509,85 @@ static uint64_t Arm64JITCore_ExitFunctionLink(FEXCore::Core::CpuStateFrame *Fram
 void Arm64JITCore::Op_NoOp(IR::IROp_Header const *IROp, IR::NodeID Node) {
 }
 
+void Arm64JITCore::RegisterSplitPairedOps() {
+  // Ops where every 128-bit half of the result only depends on the same half of the sources.
+  // Anything crossing the halves handles FPRPairs itself.
+  constexpr std::array LaneIndependentOps = {
+    IR::OP_VECTORZERO, IR::OP_VECTORIMM, IR::OP_VMOV,
+    IR::OP_VAND, IR::OP_VBIC, IR::OP_VOR, IR::OP_VXOR, IR::OP_VNOT,
+    IR::OP_VADD, IR::OP_VSUB, IR::OP_VUQADD, IR::OP_VUQSUB, IR::OP_VSQADD, IR::OP_VSQSUB,
+    IR::OP_VURAVG, IR::OP_VABS, IR::OP_VPOPCOUNT, IR::OP_VNEG,
+    IR::OP_VUMIN, IR::OP_VSMIN, IR::OP_VUMAX, IR::OP_VSMAX, IR::OP_VUMUL, IR::OP_VSMUL,
+    IR::OP_VFADD, IR::OP_VFSUB, IR::OP_VFMUL, IR::OP_VFDIV, IR::OP_VFMIN, IR::OP_VFMAX,
+    IR::OP_VFRECP, IR::OP_VFSQRT, IR::OP_VFRSQRT, IR::OP_VFNEG,
+    IR::OP_VCMPEQ, IR::OP_VCMPEQZ, IR::OP_VCMPGT, IR::OP_VCMPGTZ, IR::OP_VCMPLTZ,
+    IR::OP_VFCMPEQ, IR::OP_VFCMPNEQ, IR::OP_VFCMPLT, IR::OP_VFCMPGT, IR::OP_VFCMPLE, IR::OP_VFCMPORD, IR::OP_VFCMPUNO,
+    IR::OP_VUSHLS, IR::OP_VUSHRS, IR::OP_VSSHRS,
+    IR::OP_VUSHRI, IR::OP_VSSHRI, IR::OP_VSHLI, IR::OP_VREV64,
+    IR::OP_VECTOR_STOF, IR::OP_VECTOR_FTOZS, IR::OP_VECTOR_FTOS, IR::OP_VECTOR_FTOI,
+  };
+
+  for (auto Op : LaneIndependentOps) {
+    SplitPairedOps[Op] = true;
+  }
+}
+
+void Arm64JITCore::EmitSplitPairedOp(IR::IROp_Header const *IROp, IR::NodeID Node) {
+  // Emit the handler on a copy of the op that claims to be 128-bit, so it takes its ASIMD path.
+  alignas(16) std::array<uint8_t, 64> HalfOpData;
+  const auto OpStructSize = IR::GetSize(IROp->Op);
+  LOGMAN_THROW_AA_FMT(OpStructSize <= HalfOpData.size(), "{} is too large to split", IR::GetName(IROp->Op));
+  memcpy(HalfOpData.data(), IROp, OpStructSize);
+
+  auto HalfOp = reinterpret_cast<IR::IROp_Header*>(HalfOpData.data());
+  HalfOp->Size = Core::CPUState::XMM_SSE_REG_SIZE;
+
+  const OpHandler Handler = OpHandlers[IROp->Op];
+  const auto Dst = RAFPRPair[GetPhys(Node).Reg];
+
+  if (IROp->Op == IR::OP_VUSHLS || IROp->Op == IR::OP_VUSHRS || IROp->Op == IR::OP_VSSHRS) {
+    // Both halves shift by the same scalar, which the lower half might overwrite.
+    const auto Vector = IROp->Args[0].ID();
+    const auto ShiftScalar = IROp->Args[1].ID();
+
+    if (!IsFPRPair(Vector)) {
+      // Shifting the zero upper half results in zero
+      (this->*Handler)(HalfOp, Node);
+      eor(Dst.second.Q(), Dst.second.Q(), Dst.second.Q());
+      return;
+    }
+
+    mov(VTMP4.Q(), GetVReg(ShiftScalar).Q());
+    SplitOverride = {ShiftScalar, VTMP4};
+  } else {
+    const uint8_t NumArgs = IR::GetArgs(IROp->Op);
+    for (uint8_t i = 0; i < NumArgs; ++i) {
+      const auto Arg = IROp->Args[i].ID();
+      if (Arg.IsInvalid()) {
+        continue;
+      }
+
+      const auto Class = RAData->GetNodeRegister(Arg).Class;
+      if (Class == IR::FPRClass.Val || Class == IR::FPRFixedClass.Val) {
+        // The upper half of a 128-bit source reads from VTMP4
+        eor(VTMP4.Q(), VTMP4.Q(), VTMP4.Q());
+        break;
+      }
+    }
+  }
+
+  (this->*Handler)(HalfOp, Node);
+  EmittingUpperHalf = true;
+  (this->*Handler)(HalfOp, Node);
+  EmittingUpperHalf = false;
+  SplitOverride.first.Invalidate();
+}
+
 Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
   : CPUBackend(Thread, INITIAL_CODE_SIZE, MAX_CODE_SIZE)
   , Arm64Emitter(ctx, 0)
-  , HostSupportsSVE{ctx->HostFeatures.SupportsAVX}
+  , HostSupportsSVE{ctx->HostFeatures.SupportsSVE256}
+  , PairedAVX{ctx->HostFeatures.SupportsAVX && !ctx->HostFeatures.SupportsSVE256}
   , CTX {ctx} {
 
   RAPass = Thread->PassManager->GetPass<IR::RegisterAllocationPass>("RA");
@@ -529,12 +604,18 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::Intern
   RAPass->AddRegisters(FEXCore::IR::FPRFixedClass, SRAFPR.size()  );
   RAPass->AddRegisters(FEXCore::IR::GPRPairClass, NumUsedGPRPairs);
   RAPass->AddRegisters(FEXCore::IR::ComplexClass, 1);
+  RAPass->AddRegisters(FEXCore::IR::FPRPairClass, NumFPRPairs);
 
   for (uint32_t i = 0; i < NumUsedGPRPairs; ++i) {
     RAPass->AddRegisterConflict(FEXCore::IR::GPRClass, i * 2,     FEXCore::IR::GPRPairClass, i);
     RAPass->AddRegisterConflict(FEXCore::IR::GPRClass, i * 2 + 1, FEXCore::IR::GPRPairClass, i);
   }
 
+  for (uint32_t i = 0; i < NumFPRPairs; ++i) {
+    RAPass->AddRegisterConflict(FEXCore::IR::FPRClass, i * 2,     FEXCore::IR::FPRPairClass, i);
+    RAPass->AddRegisterConflict(FEXCore::IR::FPRClass, i * 2 + 1, FEXCore::IR::FPRPairClass, i);
+  }
+
   for (uint32_t i = 0; i < FEXCore::IR::IROps::OP_LAST + 1; ++i) {
     OpHandlers[i] = &Arm64JITCore::Op_Unhandled;
   }
@@ -549,6 +630,7 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::Intern
   RegisterMoveHandlers();
   RegisterVectorHandlers();
   RegisterEncryptionHandlers();
+  RegisterSplitPairedOps();
 
   {
     // Set up pointers that the JIT needs to load
@@ -662,7 +744,7 @@ FEXCore::IR::RegisterClassType Arm64JITCore::GetRegClass(IR::NodeID Node) const
 bool Arm64JITCore::IsFPR(IR::NodeID Node) const {
   auto Class = GetRegClass(Node);
 
-  return Class == IR::FPRClass || Class == IR::FPRFixedClass;
+  return Class == IR::FPRClass || Class == IR::FPRFixedClass || Class == IR::FPRPairClass;
 }
 
 bool Arm64JITCore::IsGPR(IR::NodeID Node) const {
@@ -696,8 +778,8 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
   this->IR = IR;
 
   // Fairly excessive buffer range to make sure we don't overflow
-  uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
-  if ((GetCursorOffset() + BufferRange) > CurrentCodeBuffer->Size) {
+  uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize + MaxBlockTailSize(SSACount);
+  if ((GetCursorOffset() + BufferRange) > GetCodeBufferLimit()) {
     CTX->ClearCodeCache(ThreadState);
   }
 
@@ -771,8 +853,12 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
       const auto ID = IR->GetID(CodeNode);
 
       // Execute handler
-      OpHandler Handler = OpHandlers[IROp->Op];
-      (this->*Handler)(IROp, ID);
+      if (PairedAVX && IROp->Size == Core::CPUState::XMM_AVX_REG_SIZE && SplitPairedOps[IROp->Op]) {
+        EmitSplitPairedOp(IROp, ID);
+      } else {
+        OpHandler Handler = OpHandlers[IROp->Op];
+        (this->*Handler)(IROp, ID);
+      }
     }
 
     if (DebugData) {
@@ -803,6 +889,10 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
     DebugData->Relocations = &Relocations;
   }
 
+  // PC map for the block, it is data so it stays out of the icache flush above
+  CursorIncrement(EmitBlockTail(Entry, GuestEntry, CodeEnd - GuestEntry, GetCursorAddress<uint8_t *>()));
+  Align();
+
   this->IR = nullptr;
 
   return GuestEntry;
@@ -834,7 +924,8 @@ void InitializeArm64JITSignalHandlers(FEXCore::Context::Context *CTX) {
 
 CPUBackendFeatures GetArm64JITBackendFeatures() {
   return CPUBackendFeatures {
-    .SupportsStaticRegisterAllocation = true
+    .SupportsStaticRegisterAllocation = true,
+    .SupportsFPRPairs = true,
   };
 }
 
@@ -42,6 +42,8 @@ public:
                                   FEXCore::Core::DebugData *DebugData,
                                   FEXCore::IR::RegisterAllocationData *RAData, bool GDBEnabled) override;
 
+  [[nodiscard]] void *RelocateJITObjectCode(uint64_t Entry, CodeSerialize::CodeObjectFileSection const *SerializationData) override;
+
   [[nodiscard]] void *MapRegion(void* HostPtr, uint64_t, uint64_t) override { return HostPtr; }
 
   [[nodiscard]] bool NeedsOpDispatch() override { return true; }
@@ -55,6 +57,8 @@ public:
 private:
   FEX_CONFIG_OPT(ParanoidTSO, PARANOIDTSO);
   const bool HostSupportsSVE{};
+  // AVX without 256-bit SVE, 256-bit vectors live in a FPRPair
+  const bool PairedAVX{};
 
   ARMEmitter::BiDirectionalLabel *PendingTargetLabel;
   FEXCore::Context::Context *CTX;
@@ -69,10 +73,11 @@ private:
   constexpr static uint32_t NumGPRs = RA64.size();
   constexpr static uint32_t NumFPRs = RAFPR.size();
   constexpr static uint32_t NumGPRPairs = RA64Pair.size();
+  constexpr static uint32_t NumFPRPairs = RAFPRPair.size();
   constexpr static uint32_t NumCalleeGPRs = 10;
   constexpr static uint32_t NumCalleeGPRPairs = 5;
-  constexpr static uint32_t RegisterCount = NumGPRs + NumFPRs + NumGPRPairs;
-  constexpr static uint32_t RegisterClasses = 6;
+  constexpr static uint32_t RegisterCount = NumGPRs + NumFPRs + NumGPRPairs + NumFPRPairs;
+  constexpr static uint32_t RegisterClasses = 7;
 
   constexpr static uint64_t GPRBase = (0ULL << 32);
   constexpr static uint64_t FPRBase = (1ULL << 32);
@@ -101,7 +106,22 @@ private:
   [[nodiscard]] FEXCore::ARMEmitter::VRegister GetVReg(IR::NodeID Node) const {
     const auto Reg = GetPhys(Node);
 
-    LOGMAN_THROW_AA_FMT(Reg.Class == IR::FPRFixedClass.Val || Reg.Class == IR::FPRClass.Val, "Unexpected Class: {}", Reg.Class);
+    LOGMAN_THROW_AA_FMT(Reg.Class == IR::FPRFixedClass.Val || Reg.Class == IR::FPRClass.Val || Reg.Class == IR::FPRPairClass.Val,
+                        "Unexpected Class: {}", Reg.Class);
+
+    if (SplitOverride.first == Node) {
+      return SplitOverride.second;
+    }
+
+    if (Reg.Class == IR::FPRPairClass.Val) {
+      // 128-bit users of a pair only see the lower half
+      return EmittingUpperHalf ? RAFPRPair[Reg.Reg].second : RAFPRPair[Reg.Reg].first;
+    }
+
+    if (EmittingUpperHalf) {
+      // Values narrower than 256-bit have a zero upper half
+      return VTMP4;
+    }
 
     if (Reg.Class == IR::FPRFixedClass.Val) {
       return SRAFPR[Reg.Reg];
@@ -112,6 +132,34 @@ private:
     FEX_UNREACHABLE;
   }
 
+  /**
+   * @brief Gets both 128-bit halves of a 256-bit vector
+   *
+   * Only valid with PairedAVX. A node that isn't in a FPRPair has a zero upper half, which is materialized in VTMP4.
+   */
+  [[nodiscard]] std::pair<FEXCore::ARMEmitter::VRegister, FEXCore::ARMEmitter::VRegister> GetVRegPair(IR::NodeID Node) {
+    const auto Reg = GetPhys(Node);
+
+    if (Reg.Class == IR::FPRPairClass.Val) {
+      return RAFPRPair[Reg.Reg];
+    }
+
+    eor(VTMP4.Q(), VTMP4.Q(), VTMP4.Q());
+    return {GetVReg(Node), VTMP4};
+  }
+
+  [[nodiscard]] bool IsFPRPair(IR::NodeID Node) const {
+    return GetPhys(Node).Class == IR::FPRPairClass.Val;
+  }
+
+  [[nodiscard]] FEXCore::ARMEmitter::VRegister GetVRegUpper(IR::NodeID Node) const {
+    const auto Reg = GetPhys(Node);
+
+    LOGMAN_THROW_AA_FMT(Reg.Class == IR::FPRPairClass.Val, "Unexpected Class: {}", Reg.Class);
+
+    return RAFPRPair[Reg.Reg].second;
+  }
+
   [[nodiscard]] std::pair<FEXCore::ARMEmitter::Register, FEXCore::ARMEmitter::Register> GetRegPair(IR::NodeID Node) const {
     const auto Reg = GetPhys(Node);
 
@@ -133,6 +181,21 @@ private:
   [[nodiscard]] bool IsFPR(IR::NodeID Node) const;
   [[nodiscard]] bool IsGPR(IR::NodeID Node) const;
 
+  /**
+   * @name Paired AVX
+   *
+   * Lane independent ops on a FPRPair are emitted twice as 128-bit ops, once per half.
+   * @{ */
+  // Set while emitting the upper half, GetVReg returns the upper registers
+  bool EmittingUpperHalf{};
+  // Arg that resolves to the same register for both halves, like a shift amount
+  std::pair<IR::NodeID, FEXCore::ARMEmitter::VRegister> SplitOverride{IR::NodeID{}, VTMP4};
+  std::array<bool, IR::IROps::OP_LAST + 1> SplitPairedOps{};
+
+  void RegisterSplitPairedOps();
+  void EmitSplitPairedOp(IR::IROp_Header const *IROp, IR::NodeID Node);
+  /**  @} */
+
   [[nodiscard]] FEXCore::ARMEmitter::ExtendedMemOperand GenerateMemOperand(uint8_t AccessSize,
                                               FEXCore::ARMEmitter::Register Base,
                                               IR::OrderedNodeWrapper Offset,
@@ -150,6 +213,16 @@ private:
                                                     IR::MemOffsetType OffsetType,
                                                     uint8_t OffsetScale);
 
+  // ldp/stp of FPRPairs only have an immediate offset form.
+  // Returns the address with the offset applied, in TMP1 if it needed computing.
+  [[nodiscard]] FEXCore::ARMEmitter::Register GeneratePairedMemAddress(FEXCore::ARMEmitter::Register Base,
+                                                                       IR::OrderedNodeWrapper Offset,
+                                                                       IR::MemOffsetType OffsetType,
+                                                                       uint8_t OffsetScale);
+
+  // Emits the dmb matching one of the IR's TSO_BARRIER_* values
+  void EmitTSOBarrier(uint8_t Barrier);
+
   [[nodiscard]] bool IsInlineConstant(const IR::OrderedNodeWrapper& Node, uint64_t* Value = nullptr) const;
   [[nodiscard]] bool IsInlineEntrypointOffset(const IR::OrderedNodeWrapper& WNode, uint64_t* Value) const;
 
@@ -204,6 +277,13 @@ private:
      */
     void InsertGuestRIPMove(ARMEmitter::Register Reg, uint64_t Constant);
 
+    /**
+     * @brief Places a guest RIP as a literal in memory at the current location
+     *
+     * @param GuestRIP - The guest RIP that will be relocated
+     */
+    void InsertGuestRIPLiteral(uint64_t GuestRIP);
+
     /**
      * @brief Inserts a named symbol as a literal in memory
      *
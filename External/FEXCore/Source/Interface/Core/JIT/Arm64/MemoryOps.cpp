@@ -59,8 +59,15 @@ DEF_OP(LoadContext) {
       ldr(Dst.Q(), STATE, Op->Offset);
       break;
     case 32:
-      mov(TMP1, Op->Offset);
-      ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), STATE, TMP1);
+      if (PairedAVX) {
+        ldr(Dst.Q(), STATE, Op->Offset);
+        if (IsFPRPair(Node)) {
+          ldr(GetVRegUpper(Node).Q(), STATE, Op->Offset + Core::CPUState::XMM_SSE_REG_SIZE);
+        }
+      } else {
+        mov(TMP1, Op->Offset);
+        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), STATE, TMP1);
+      }
       break;
     default:
       LOGMAN_MSG_A_FMT("Unhandled LoadContext size: {}", OpSize);
@@ -114,8 +121,14 @@ DEF_OP(StoreContext) {
       str(Src.Q(), STATE, Op->Offset);
       break;
     case 32:
-      mov(TMP1, Op->Offset);
-      st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, STATE, TMP1);
+      if (PairedAVX) {
+        const auto Upper = GetVRegPair(Op->Value.ID()).second;
+        str(Src.Q(), STATE, Op->Offset);
+        str(Upper.Q(), STATE, Op->Offset + Core::CPUState::XMM_SSE_REG_SIZE);
+      } else {
+        mov(TMP1, Op->Offset);
+        st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, STATE, TMP1);
+      }
       break;
     default:
       LOGMAN_MSG_A_FMT("Unhandled StoreContext size: {}", OpSize);
@@ -166,8 +179,8 @@ DEF_OP(LoadRegister) {
     }
   }
   else if (Op->Class == IR::FPRClass) {
-    const auto regSize = HostSupportsSVE ? Core::CPUState::XMM_AVX_REG_SIZE
-                                         : Core::CPUState::XMM_SSE_REG_SIZE;
+    const auto regSize = CTX->HostFeatures.SupportsAVX ? Core::CPUState::XMM_AVX_REG_SIZE
+                                                       : Core::CPUState::XMM_SSE_REG_SIZE;
     const auto regId = (Op->Offset - offsetof(Core::CpuStateFrame, State.xmm.avx.data[0][0])) / regSize;
 
     LOGMAN_THROW_A_FMT(regId < SRAFPR.size(), "out of range regId");
@@ -302,6 +315,19 @@ DEF_OP(LoadRegister) {
           }
           break;
 
+        case 32: {
+          // Paired AVX, the static register only holds the lower half.
+          // The upper half always lives in the context.
+          LOGMAN_THROW_AA_FMT(PairedAVX && regOffs == 0, "unexpected regOffs: {}", regOffs);
+          if (host.Idx() != guest.Idx()) {
+            mov(host.Q(), guest.Q());
+          }
+          if (IsFPRPair(Node)) {
+            ldr(RAFPRPair[GetPhys(Node).Reg].second.Q(), STATE, Op->Offset + Core::CPUState::XMM_SSE_REG_SIZE);
+          }
+          break;
+        }
+
         default:
           LOGMAN_MSG_A_FMT("Unhandled LoadRegister FPR size: {}", OpSize);
           break;
@@ -352,8 +378,8 @@ DEF_OP(StoreRegister) {
         break;
     }
   } else if (Op->Class == IR::FPRClass) {
-    const auto regSize = HostSupportsSVE ? Core::CPUState::XMM_AVX_REG_SIZE
-                                         : Core::CPUState::XMM_SSE_REG_SIZE;
+    const auto regSize = CTX->HostFeatures.SupportsAVX ? Core::CPUState::XMM_AVX_REG_SIZE
+                                                       : Core::CPUState::XMM_SSE_REG_SIZE;
     const auto regId = (Op->Offset - offsetof(Core::CpuStateFrame, State.xmm.avx.data[0][0])) / regSize;
 
     LOGMAN_THROW_A_FMT(regId < SRAFPR.size(), "regId out of range");
@@ -490,6 +516,16 @@ DEF_OP(StoreRegister) {
           }
           break;
 
+        case 32: {
+          LOGMAN_THROW_AA_FMT(PairedAVX && regOffs == 0, "unexpected regOffs: {}", regOffs);
+          const auto Upper = GetVRegPair(Op->Value.ID()).second;
+          if (guest.Idx() != host.Idx()) {
+            mov(guest.Q(), host.Q());
+          }
+          str(Upper.Q(), STATE, Op->Offset + Core::CPUState::XMM_SSE_REG_SIZE);
+          break;
+        }
+
         default:
           LOGMAN_MSG_A_FMT("Unhandled StoreRegister FPR size: {}", OpSize);
           break;
@@ -581,8 +617,17 @@ DEF_OP(LoadContextIndexed) {
         }
         break;
       case 32:
-        mov(TMP2, Op->BaseOffset);
-        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), TMP1, TMP2);
+        if (PairedAVX) {
+          add(ARMEmitter::Size::i64Bit, TMP1, TMP1, Op->BaseOffset);
+          if (IsFPRPair(Node)) {
+            ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), TMP1, 0);
+          } else {
+            ldr(Dst.Q(), TMP1, 0);
+          }
+        } else {
+          mov(TMP2, Op->BaseOffset);
+          ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), TMP1, TMP2);
+        }
         break;
       default:
         LOGMAN_MSG_A_FMT("Unhandled LoadContextIndexed size: {}", OpSize);
@@ -678,8 +723,14 @@ DEF_OP(StoreContextIndexed) {
         }
         break;
       case 32:
-        mov(TMP2, Op->BaseOffset);
-        st1b<ARMEmitter::SubRegSize::i8Bit>(Value.Z(), PRED_TMP_32B, TMP1, TMP2);
+        if (PairedAVX) {
+          const auto Upper = GetVRegPair(Op->Value.ID()).second;
+          add(ARMEmitter::Size::i64Bit, TMP1, TMP1, Op->BaseOffset);
+          stp<ARMEmitter::IndexType::OFFSET>(Value.Q(), Upper.Q(), TMP1, 0);
+        } else {
+          mov(TMP2, Op->BaseOffset);
+          st1b<ARMEmitter::SubRegSize::i8Bit>(Value.Z(), PRED_TMP_32B, TMP1, TMP2);
+        }
         break;
       default:
         LOGMAN_MSG_A_FMT("Unhandled StoreContextIndexed size: {}", OpSize);
@@ -773,16 +824,28 @@ DEF_OP(SpillRegister) {
     case 16: {
       if (SlotOffset > 65520) {
         LoadConstant(ARMEmitter::Size::i64Bit, TMP1, SlotOffset);
-        str(Src.D(), ARMEmitter::Reg::rsp, TMP1.R(), ARMEmitter::ExtendedType::LSL_64, 0);
+        str(Src.Q(), ARMEmitter::Reg::rsp, TMP1.R(), ARMEmitter::ExtendedType::LSL_64, 0);
       }
       else {
-        str(Src.D(), ARMEmitter::Reg::rsp, SlotOffset);
+        str(Src.Q(), ARMEmitter::Reg::rsp, SlotOffset);
       }
       break;
     }
     case 32: {
-      mov(TMP3, SlotOffset);
-      st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, ARMEmitter::Reg::rsp, TMP3);
+      if (PairedAVX) {
+        const auto Upper = GetVRegPair(Op->Value.ID()).second;
+        if (SlotOffset > 1008) {
+          LoadConstant(ARMEmitter::Size::i64Bit, TMP1, SlotOffset);
+          add(ARMEmitter::Size::i64Bit, TMP1, ARMEmitter::Reg::rsp, TMP1, ARMEmitter::ExtendedType::LSL_64, 0);
+          stp<ARMEmitter::IndexType::OFFSET>(Src.Q(), Upper.Q(), TMP1, 0);
+        }
+        else {
+          stp<ARMEmitter::IndexType::OFFSET>(Src.Q(), Upper.Q(), ARMEmitter::Reg::rsp, SlotOffset);
+        }
+      } else {
+        mov(TMP3, SlotOffset);
+        st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, ARMEmitter::Reg::rsp, TMP3);
+      }
       break;
     }
     default:
@@ -881,8 +944,23 @@ DEF_OP(FillRegister) {
       break;
     }
     case 32: {
-      mov(TMP3, SlotOffset);
-      ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), ARMEmitter::Reg::rsp, TMP3);
+      if (PairedAVX) {
+        // Only the lower half was needed by anything after the fill
+        if (!IsFPRPair(Node)) {
+          ldr(Dst.Q(), ARMEmitter::Reg::rsp, SlotOffset);
+        }
+        else if (SlotOffset > 1008) {
+          LoadConstant(ARMEmitter::Size::i64Bit, TMP1, SlotOffset);
+          add(ARMEmitter::Size::i64Bit, TMP1, ARMEmitter::Reg::rsp, TMP1, ARMEmitter::ExtendedType::LSL_64, 0);
+          ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), TMP1, 0);
+        }
+        else {
+          ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), ARMEmitter::Reg::rsp, SlotOffset);
+        }
+      } else {
+        mov(TMP3, SlotOffset);
+        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), ARMEmitter::Reg::rsp, TMP3);
+      }
       break;
     }
     default:
@@ -944,6 +1022,48 @@ static auto ConvertExtendedType(IR::MemOffsetType OffsetType) -> ARMEmitter::Ext
   FEX_UNREACHABLE;
 }
 
+FEXCore::ARMEmitter::Register Arm64JITCore::GeneratePairedMemAddress(FEXCore::ARMEmitter::Register Base,
+                                                                     IR::OrderedNodeWrapper Offset,
+                                                                     IR::MemOffsetType OffsetType,
+                                                                     uint8_t OffsetScale) {
+  if (Offset.IsInvalid()) {
+    return Base;
+  }
+
+  uint64_t Const{};
+  if (IsInlineConstant(Offset, &Const)) {
+    if (Const == 0) {
+      return Base;
+    }
+    LoadConstant(ARMEmitter::Size::i64Bit, TMP1, Const);
+    add(ARMEmitter::Size::i64Bit, TMP1, Base, TMP1);
+    return TMP1;
+  }
+
+  const auto RegOffset = GetReg(Offset.ID());
+  add(ARMEmitter::Size::i64Bit, TMP1, Base, RegOffset, ConvertExtendedType(OffsetType), (int)std::log2(OffsetScale));
+  return TMP1;
+}
+
+void Arm64JITCore::EmitTSOBarrier(uint8_t Barrier) {
+  switch (Barrier) {
+    case IR::TSO_BARRIER_NONE:
+      break;
+    case IR::TSO_BARRIER_LOAD:
+      dmb(FEXCore::ARMEmitter::BarrierScope::ISHLD);
+      break;
+    case IR::TSO_BARRIER_STORE:
+      dmb(FEXCore::ARMEmitter::BarrierScope::ISHST);
+      break;
+    case IR::TSO_BARRIER_FULL:
+      dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
+      break;
+    default:
+      LOGMAN_MSG_A_FMT("Unhandled TSO barrier: {}", Barrier);
+      break;
+  }
+}
+
 FEXCore::ARMEmitter::SVEMemOperand Arm64JITCore::GenerateSVEMemOperand(uint8_t AccessSize,
                                                   FEXCore::ARMEmitter::Register Base,
                                                   IR::OrderedNodeWrapper Offset,
@@ -1047,8 +1167,17 @@ DEF_OP(LoadMem) {
         ldr(Dst.Q(), MemSrc);
         break;
       case 32: {
-        const auto Operand = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
-        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), Operand);
+        if (PairedAVX) {
+          if (IsFPRPair(Node)) {
+            const auto Addr = GeneratePairedMemAddress(MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+            ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), Addr, 0);
+          } else {
+            ldr(Dst.Q(), MemSrc);
+          }
+        } else {
+          const auto Operand = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), Operand);
+        }
         break;
       }
       default:
@@ -1150,7 +1279,7 @@ DEF_OP(LoadMemTSO) {
     }
   }
   else {
-    dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
+    EmitTSOBarrier(Op->BarrierBefore);
     const auto Dst = GetVReg(Node);
     const auto MemSrc = GenerateMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
     switch (OpSize) {
@@ -1170,15 +1299,24 @@ DEF_OP(LoadMemTSO) {
         ldr(Dst.Q(), MemSrc);
         break;
       case 32: {
-        const auto MemSrc = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
-        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), MemSrc);
+        if (PairedAVX) {
+          if (IsFPRPair(Node)) {
+            const auto Addr = GeneratePairedMemAddress(MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+            ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), Addr, 0);
+          } else {
+            ldr(Dst.Q(), MemSrc);
+          }
+        } else {
+          const auto MemSrc = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), MemSrc);
+        }
         break;
       }
       default:
         LOGMAN_MSG_A_FMT("Unhandled LoadMemTSO size: {}", OpSize);
         break;
     }
-    dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
+    EmitTSOBarrier(Op->BarrierAfter);
   }
 }
 
@@ -1234,8 +1372,14 @@ DEF_OP(StoreMem) {
         break;
       }
       case 32: {
-        const auto MemSrc = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
-        st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, MemSrc);
+        if (PairedAVX) {
+          const auto Upper = GetVRegPair(Op->Value.ID()).second;
+          const auto Addr = GeneratePairedMemAddress(MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          stp<ARMEmitter::IndexType::OFFSET>(Src.Q(), Upper.Q(), Addr, 0);
+        } else {
+          const auto MemSrc = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, MemSrc);
+        }
         break;
       }
       default:
@@ -1308,7 +1452,7 @@ DEF_OP(StoreMemTSO) {
     }
   }
   else {
-    dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
+    EmitTSOBarrier(Op->BarrierBefore);
     const auto Src = GetVReg(Op->Value.ID());
     const auto MemSrc = GenerateMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
     switch (OpSize) {
@@ -1328,15 +1472,21 @@ DEF_OP(StoreMemTSO) {
         str(Src.Q(), MemSrc);
         break;
       case 32: {
-        const auto Operand = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
-        st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, Operand);
+        if (PairedAVX) {
+          const auto Upper = GetVRegPair(Op->Value.ID()).second;
+          const auto Addr = GeneratePairedMemAddress(MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          stp<ARMEmitter::IndexType::OFFSET>(Src.Q(), Upper.Q(), Addr, 0);
+        } else {
+          const auto Operand = GenerateSVEMemOperand(OpSize, MemReg, Op->Offset, Op->OffsetType, Op->OffsetScale);
+          st1b<ARMEmitter::SubRegSize::i8Bit>(Src.Z(), PRED_TMP_32B, Operand);
+        }
         break;
       }
       default:
         LOGMAN_MSG_A_FMT("Unhandled StoreMemTSO size: {}", OpSize);
         break;
     }
-    dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
+    EmitTSOBarrier(Op->BarrierAfter);
   }
 }
 
@@ -1398,7 +1548,15 @@ DEF_OP(ParanoidLoadMemTSO) {
         break;
       case 32:
         dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
-        ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), Addr);
+        if (PairedAVX) {
+          if (IsFPRPair(Node)) {
+            ldp<ARMEmitter::IndexType::OFFSET>(Dst.Q(), GetVRegUpper(Node).Q(), Addr, 0);
+          } else {
+            ldr(Dst.Q(), Addr, 0);
+          }
+        } else {
+          ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), Addr);
+        }
         dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
         break;
       default:
@@ -1473,7 +1631,12 @@ DEF_OP(ParanoidStoreMemTSO) {
       }
       case 32: {
         dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
-        st1b<ARMEmitter::SubRegSize::i8Bit>(Src, PRED_TMP_32B, Addr, 0);
+        if (PairedAVX) {
+          const auto Upper = GetVRegPair(Op->Value.ID()).second;
+          stp<ARMEmitter::IndexType::OFFSET>(Src.Q(), Upper.Q(), Addr, 0);
+        } else {
+          st1b<ARMEmitter::SubRegSize::i8Bit>(Src, PRED_TMP_32B, Addr, 0);
+        }
         dmb(FEXCore::ARMEmitter::BarrierScope::ISH);
         break;
       }
@@ -5,6 +5,7 @@ $end_info$
 */
 
 #include <syscall.h>
+#include "Interface/Context/Context.h"
 #include "Interface/Core/ArchHelpers/CodeEmitter/Emitter.h"
 #include "Interface/Core/JIT/Arm64/JITClass.h"
 #include "FEXCore/Debug/InternalThreadState.h"
@@ -15,7 +16,12 @@ namespace FEXCore::CPU {
 DEF_OP(GuestOpcode) {
   auto Op = IROp->C<IR::IROp_GuestOpcode>();
   // metadata
-  DebugData->GuestOpcodes.push_back({Op->GuestEntryOffset, GetCursorAddress<uint8_t*>() - GuestEntry});
+  const auto HostOffset = GetCursorAddress<uint8_t*>() - GuestEntry;
+  AddPCMapEntry(HostOffset, Op->GuestEntryOffset);
+
+  if (DebugData && CTX->Config.GDBSymbols()) {
+    DebugData->GuestOpcodes.push_back({Op->GuestEntryOffset, HostOffset});
+  }
 }
 
 DEF_OP(Fence) {
@@ -349,6 +349,13 @@ DEF_OP(VAddP) {
 
     // Merge upper half with lower half.
     splice<ARMEmitter::OpType::Destructive>(ARMEmitter::SubRegSize::i64Bit, Dst.Z(), PRED_TMP_16B, Dst.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    // Both halves of the lower vector pair up in to the lower half of the result.
+    const auto Lower = GetVRegPair(Op->VectorLower.ID());
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID());
+    addp(SubRegSize, VTMP1.Q(), Lower.first.Q(), Lower.second.Q());
+    addp(SubRegSize, GetVRegUpper(Node).Q(), Upper.first.Q(), Upper.second.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     if (IsScalar) {
       addp(SubRegSize, Dst.D(), VectorLower.D(), VectorUpper.D());
@@ -390,6 +397,18 @@ DEF_OP(VAddV) {
     addv(SubRegSize.Vector, VTMP2.Q(), Vector.Q());
     addv(SubRegSize.Vector, VTMP1.Q(), VTMP1.Q());
     add(SubRegSize.Vector, Dst.Q(), VTMP1.Q(), VTMP2.Q());
+  } else if (PairedAVX && Is256Bit) {
+    // Sum the halves element-wise first, a single reduction then covers the whole vector.
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    add(SubRegSize.Vector, VTMP1.Q(), Src.first.Q(), Src.second.Q());
+    if (ElementSize == 8) {
+      addp(SubRegSize.Scalar, Dst, VTMP1);
+    }
+    else {
+      addv(SubRegSize.Vector, Dst.Q(), VTMP1.Q());
+    }
+    const auto DstUpper = GetVRegUpper(Node);
+    eor(DstUpper.Q(), DstUpper.Q(), DstUpper.Q());
   } else {
     if (ElementSize == 8) {
       addp(SubRegSize.Scalar, Dst, Vector);
@@ -416,7 +435,13 @@ DEF_OP(VUMinV) {
     ElementSize == 4 ? ARMEmitter::SubRegSize::i32Bit :
     ElementSize == 8 ? ARMEmitter::SubRegSize::i64Bit : ARMEmitter::SubRegSize::i8Bit;
 
-  if (HostSupportsSVE) {
+  if (PairedAVX && OpSize == Core::CPUState::XMM_AVX_REG_SIZE) {
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    umin(SubRegSize, VTMP1.Q(), Src.first.Q(), Src.second.Q());
+    uminv(SubRegSize, Dst.Q(), VTMP1.Q());
+    const auto DstUpper = GetVRegUpper(Node);
+    eor(DstUpper.Q(), DstUpper.Q(), DstUpper.Q());
+  } else if (HostSupportsSVE) {
     LOGMAN_THROW_AA_FMT(OpSize == 16 || OpSize == 32,
                         "Unsupported vector length: {}", OpSize);
 
@@ -603,6 +628,12 @@ DEF_OP(VFAddP) {
 
     // Merge upper half with lower half.
     splice<ARMEmitter::OpType::Destructive>(ARMEmitter::SubRegSize::i64Bit, Dst.Z(), PRED_TMP_16B, Dst.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Lower = GetVRegPair(Op->VectorLower.ID());
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID());
+    faddp(SubRegSize, VTMP1.Q(), Lower.first.Q(), Lower.second.Q());
+    faddp(SubRegSize, GetVRegUpper(Node).Q(), Upper.first.Q(), Upper.second.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     faddp(SubRegSize, Dst.Q(), VectorLower.Q(), VectorUpper.Q());
   }
@@ -1315,6 +1346,13 @@ DEF_OP(VZip) {
 
   if (HostSupportsSVE && Is256Bit) {
     zip1(SubRegSize, Dst.Z(), VectorLower.Z(), VectorUpper.Z());
+  } else if (PairedAVX && Is256Bit) {
+    // Interleaving the lower halves fills the whole result.
+    const auto Lower = GetVRegPair(Op->VectorLower.ID()).first;
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID()).first;
+    zip1(SubRegSize, VTMP1.Q(), Lower.Q(), Upper.Q());
+    zip2(SubRegSize, GetVRegUpper(Node).Q(), Lower.Q(), Upper.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     if (OpSize == 8) {
       zip1(SubRegSize, Dst.D(), VectorLower.D(), VectorUpper.D());
@@ -1344,6 +1382,12 @@ DEF_OP(VZip2) {
 
   if (HostSupportsSVE && Is256Bit) {
     zip2(SubRegSize, Dst.Z(), VectorLower.Z(), VectorUpper.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Lower = GetVRegPair(Op->VectorLower.ID()).second;
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID()).second;
+    zip1(SubRegSize, VTMP1.Q(), Lower.Q(), Upper.Q());
+    zip2(SubRegSize, GetVRegUpper(Node).Q(), Lower.Q(), Upper.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     if (OpSize == 8) {
       zip2(SubRegSize, Dst.D(), VectorLower.D(), VectorUpper.D());
@@ -1373,6 +1417,12 @@ DEF_OP(VUnZip) {
 
   if (HostSupportsSVE && Is256Bit) {
     uzp1(SubRegSize, Dst.Z(), VectorLower.Z(), VectorUpper.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Lower = GetVRegPair(Op->VectorLower.ID());
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID());
+    uzp1(SubRegSize, VTMP1.Q(), Lower.first.Q(), Lower.second.Q());
+    uzp1(SubRegSize, GetVRegUpper(Node).Q(), Upper.first.Q(), Upper.second.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     if (OpSize == 8) {
       uzp1(SubRegSize, Dst.D(), VectorLower.D(), VectorUpper.D());
@@ -1402,6 +1452,12 @@ DEF_OP(VUnZip2) {
 
   if (HostSupportsSVE && Is256Bit) {
     uzp2(SubRegSize, Dst.Z(), VectorLower.Z(), VectorUpper.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Lower = GetVRegPair(Op->VectorLower.ID());
+    const auto Upper = GetVRegPair(Op->VectorUpper.ID());
+    uzp2(SubRegSize, VTMP1.Q(), Lower.first.Q(), Lower.second.Q());
+    uzp2(SubRegSize, GetVRegUpper(Node).Q(), Upper.first.Q(), Upper.second.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     if (OpSize == 8) {
       uzp2(SubRegSize, Dst.D(), VectorLower.D(), VectorUpper.D());
@@ -2194,6 +2250,31 @@ DEF_OP(VInsElement) {
     dc32(Data);
     Bind(&PastConstant);
   }
+  else if (PairedAVX && Is256Bit) {
+    const auto DestVector = GetVRegPair(Op->DestVector.ID());
+    const auto SrcVector = GetVRegPair(Op->SrcVector.ID());
+    const auto ElementsPerHalf = 16 / ElementSize;
+    const auto SrcHalf = SrcIdx >= ElementsPerHalf ? SrcVector.second : SrcVector.first;
+
+    mov(VTMP1.Q(), DestVector.first.Q());
+    mov(VTMP2.Q(), DestVector.second.Q());
+    const auto DestHalf = DestIdx >= ElementsPerHalf ? VTMP2 : VTMP1;
+
+    if (ElementSize == 16) {
+      mov(DestHalf.Q(), SrcHalf.Q());
+    } else {
+      LOGMAN_THROW_AA_FMT(ElementSize == 1 || ElementSize == 2 || ElementSize == 4 || ElementSize == 8, "Invalid size");
+      const auto SubRegSize =
+        ElementSize == 1 ? ARMEmitter::SubRegSize::i8Bit :
+        ElementSize == 2 ? ARMEmitter::SubRegSize::i16Bit :
+        ElementSize == 4 ? ARMEmitter::SubRegSize::i32Bit : ARMEmitter::SubRegSize::i64Bit;
+
+      ins(SubRegSize, DestHalf.Q(), DestIdx % ElementsPerHalf, SrcHalf.Q(), SrcIdx % ElementsPerHalf);
+    }
+
+    mov(Dst.Q(), VTMP1.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP2.Q());
+  }
   else {
     if (Dst.Idx() != Reg.Idx()) {
       mov(VTMP1.Q(), Reg.Q());
@@ -2235,6 +2316,17 @@ DEF_OP(VDupElement) {
 
   if (HostSupportsSVE && Is256Bit) {
     dup(SubRegSize, Dst.Z(), Vector.Z(), Index);
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    const auto ElementsPerHalf = 16 / ElementSize;
+    const auto Half = Index >= ElementsPerHalf ? Src.second : Src.first;
+
+    if (ElementSize == 16) {
+      mov(Dst.Q(), Half.Q());
+    } else {
+      dup(SubRegSize, Dst.Q(), Half.Q(), Index % ElementsPerHalf);
+    }
+    mov(GetVRegUpper(Node).Q(), Dst.Q());
   } else {
     dup(SubRegSize, Dst.Q(), Vector.Q(), Index);
   }
@@ -2253,6 +2345,32 @@ DEF_OP(VExtr) {
   const auto ElementSize = Op->Header.ElementSize;
   auto Index = Op->Index;
 
+  if (PairedAVX && Is256Bit) {
+    // Walk the concatenation of both vectors in 128-bit chunks, anything past the end is zero.
+    const auto Lower = GetVRegPair(Op->VectorUpper.ID());
+    const auto Upper = GetVRegPair(Op->VectorLower.ID());
+    eor(VTMP3.Q(), VTMP3.Q(), VTMP3.Q());
+    const std::array<ARMEmitter::VRegister, 6> Chunks {
+      Lower.first, Lower.second, Upper.first, Upper.second, VTMP3, VTMP3,
+    };
+
+    const auto ExtractChunk = [&](ARMEmitter::VRegister Dst, uint32_t Offset) {
+      const auto Chunk = std::min<uint32_t>(Offset / 16, 4);
+      const auto Remainder = Chunk == 4 ? 0 : Offset % 16;
+      if (Remainder == 0) {
+        mov(Dst.Q(), Chunks[Chunk].Q());
+      } else {
+        ext(Dst.Q(), Chunks[Chunk].Q(), Chunks[Chunk + 1].Q(), Remainder);
+      }
+    };
+
+    const uint32_t CopyFromByte = Index * ElementSize;
+    ExtractChunk(VTMP1, CopyFromByte);
+    ExtractChunk(GetVRegUpper(Node), CopyFromByte + 16);
+    mov(Dst.Q(), VTMP1.Q());
+    return;
+  }
+
   if (Index >= OpSize) {
     // Upper bits have moved in to the lower bits
     LowerBits = UpperBits;
@@ -2395,6 +2513,13 @@ DEF_OP(VUShrNI) {
   if (HostSupportsSVE && Is256Bit) {
     shrnb(SubRegSize, Dst.Z(), Vector.Z(), BitShift);
     uzp1(SubRegSize, Dst.Z(), Dst.Z(), Dst.Z());
+  } else if (PairedAVX && Is256Bit) {
+    // Both halves of the source narrow in to the lower half, which the upper half duplicates.
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    shrn(SubRegSize, VTMP1.D(), Src.first.D(), BitShift);
+    shrn2(SubRegSize, VTMP1.Q(), Src.second.Q(), BitShift);
+    mov(Dst.Q(), VTMP1.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     shrn(SubRegSize, Dst.D(), Vector.D(), BitShift);
   }
@@ -2427,6 +2552,13 @@ DEF_OP(VUShrNI2) {
     uzp1(SubRegSize, VTMP2.Z(), VTMP2.Z(), VTMP2.Z());
     splice<ARMEmitter::OpType::Destructive>(SubRegSize, VTMP1.Z(), Mask, VTMP1.Z(), VTMP2.Z());
     mov(Dst.Z(), VTMP1.Z());
+  } else if (PairedAVX && Is256Bit) {
+    // Lower half of the result is the lower half of VectorLower, the upper half is all of VectorUpper narrowed.
+    const auto Src = GetVRegPair(Op->VectorUpper.ID());
+    shrn(SubRegSize, VTMP1.D(), Src.first.D(), BitShift);
+    shrn2(SubRegSize, VTMP1.Q(), Src.second.Q(), BitShift);
+    mov(Dst.Q(), VectorLower.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     mov(VTMP1.Q(), VectorLower.Q());
     shrn2(SubRegSize, VTMP1.Q(), VectorUpper.Q(), BitShift);
@@ -2452,6 +2584,11 @@ DEF_OP(VSXTL) {
 
   if (HostSupportsSVE && Is256Bit) {
     sunpklo(SubRegSize, Dst.Z(), Vector.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = Vector;
+    sxtl(SubRegSize, VTMP1.D(), Src.D());
+    sxtl2(SubRegSize, GetVRegUpper(Node).Q(), Src.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     sxtl(SubRegSize, Dst.D(), Vector.D());
   }
@@ -2475,6 +2612,11 @@ DEF_OP(VSXTL2) {
 
   if (HostSupportsSVE && Is256Bit) {
     sunpkhi(SubRegSize, Dst.Z(), Vector.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->Vector.ID()).second;
+    sxtl(SubRegSize, VTMP1.D(), Src.D());
+    sxtl2(SubRegSize, GetVRegUpper(Node).Q(), Src.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     sxtl2(SubRegSize, Dst.Q(), Vector.Q());
   }
@@ -2498,6 +2640,11 @@ DEF_OP(VUXTL) {
 
   if (HostSupportsSVE && Is256Bit) {
     uunpklo(SubRegSize, Dst.Z(), Vector.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = Vector;
+    uxtl(SubRegSize, VTMP1.D(), Src.D());
+    uxtl2(SubRegSize, GetVRegUpper(Node).Q(), Src.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     uxtl(SubRegSize, Dst.D(), Vector.D());
   }
@@ -2522,6 +2669,11 @@ DEF_OP(VUXTL2) {
 
   if (HostSupportsSVE && Is256Bit) {
     uunpkhi(SubRegSize, Dst.Z(), Vector.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->Vector.ID()).second;
+    uxtl(SubRegSize, VTMP1.D(), Src.D());
+    uxtl2(SubRegSize, GetVRegUpper(Node).Q(), Src.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     uxtl2(SubRegSize, Dst.D(), Vector.D());
   }
@@ -2579,6 +2731,12 @@ DEF_OP(VSQXTN) {
 
     sqxtnb(SubRegSize, Dst.Z(), Vector.Z());
     uzp1(SubRegSize, Dst.Z(), Dst.Z(), Dst.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    sqxtn(SubRegSize, VTMP1, Src.first);
+    sqxtn2(SubRegSize, VTMP1, Src.second);
+    mov(Dst.Q(), VTMP1.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     sqxtn(SubRegSize, Dst, Vector);
   }
@@ -2620,6 +2778,12 @@ DEF_OP(VSQXTN2) {
     splice<ARMEmitter::OpType::Destructive>(SubRegSize, VTMP1.Z(), Mask, VTMP1.Z(), VTMP2.Z());
 
     mov(Dst.Z(), VTMP1.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->VectorUpper.ID());
+    sqxtn(SubRegSize, VTMP1, Src.first);
+    sqxtn2(SubRegSize, VTMP1, Src.second);
+    mov(Dst.Q(), VectorLower.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     mov(VTMP1.Q(), VectorLower.Q());
 
@@ -2653,6 +2817,12 @@ DEF_OP(VSQXTUN) {
   if (HostSupportsSVE && Is256Bit) {
     sqxtunb(SubRegSize, Dst.Z(), Vector.Z());
     uzp1(SubRegSize, Dst.Z(), Dst.Z(), Dst.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->Vector.ID());
+    sqxtun(SubRegSize, VTMP1, Src.first);
+    sqxtun2(SubRegSize, VTMP1, Src.second);
+    mov(Dst.Q(), VTMP1.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     sqxtun(SubRegSize, Dst, Vector);
   }
@@ -2688,6 +2858,12 @@ DEF_OP(VSQXTUN2) {
     splice<ARMEmitter::OpType::Destructive>(SubRegSize, VTMP1.Z(), Mask, VTMP1.Z(), VTMP2.Z());
 
     mov(Dst.Z(), VTMP1.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src = GetVRegPair(Op->VectorUpper.ID());
+    sqxtun(SubRegSize, VTMP1, Src.first);
+    sqxtun2(SubRegSize, VTMP1, Src.second);
+    mov(Dst.Q(), VectorLower.Q());
+    mov(GetVRegUpper(Node).Q(), VTMP1.Q());
   } else {
     mov(VTMP1.Q(), VectorLower.Q());
     if (OpSize == 8) {
@@ -2744,6 +2920,12 @@ DEF_OP(VUMull) {
     umullb(SubRegSize, VTMP1.Z(), Vector1.Z(), Vector2.Z());
     umullt(SubRegSize, VTMP2.Z(), Vector1.Z(), Vector2.Z());
     zip1(SubRegSize, Dst.Z(), VTMP1.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src1 = Vector1;
+    const auto Src2 = Vector2;
+    umull(SubRegSize, VTMP1.D(), Src1.D(), Src2.D());
+    umull2(SubRegSize, GetVRegUpper(Node).Q(), Src1.Q(), Src2.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     umull(SubRegSize, Dst.D(), Vector1.D(), Vector2.D());
   }
@@ -2770,6 +2952,12 @@ DEF_OP(VSMull) {
     smullb(SubRegSize, VTMP1.Z(), Vector1.Z(), Vector2.Z());
     smullt(SubRegSize, VTMP2.Z(), Vector1.Z(), Vector2.Z());
     zip1(SubRegSize, Dst.Z(), VTMP1.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src1 = Vector1;
+    const auto Src2 = Vector2;
+    smull(SubRegSize, VTMP1.D(), Src1.D(), Src2.D());
+    smull2(SubRegSize, GetVRegUpper(Node).Q(), Src1.Q(), Src2.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     smull(SubRegSize, Dst.D(), Vector1.D(), Vector2.D());
   }
@@ -2796,6 +2984,12 @@ DEF_OP(VUMull2) {
     umullb(SubRegSize, VTMP1.Z(), Vector1.Z(), Vector2.Z());
     umullt(SubRegSize, VTMP2.Z(), Vector1.Z(), Vector2.Z());
     zip2(SubRegSize, Dst.Z(), VTMP1.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src1 = GetVRegPair(Op->Vector1.ID()).second;
+    const auto Src2 = GetVRegPair(Op->Vector2.ID()).second;
+    umull(SubRegSize, VTMP1.D(), Src1.D(), Src2.D());
+    umull2(SubRegSize, GetVRegUpper(Node).Q(), Src1.Q(), Src2.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     umull2(SubRegSize, Dst.Q(), Vector1.Q(), Vector2.Q());
   }
@@ -2822,6 +3016,12 @@ DEF_OP(VSMull2) {
     smullb(SubRegSize, VTMP1.Z(), Vector1.Z(), Vector2.Z());
     smullt(SubRegSize, VTMP2.Z(), Vector1.Z(), Vector2.Z());
     zip2(SubRegSize, Dst.Z(), VTMP1.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src1 = GetVRegPair(Op->Vector1.ID()).second;
+    const auto Src2 = GetVRegPair(Op->Vector2.ID()).second;
+    smull(SubRegSize, VTMP1.D(), Src1.D(), Src2.D());
+    smull2(SubRegSize, GetVRegUpper(Node).Q(), Src1.Q(), Src2.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     smull2(SubRegSize, Dst.Q(), Vector1.Q(), Vector2.Q());
   }
@@ -2853,6 +3053,12 @@ DEF_OP(VUABDL) {
     uabdlb(SubRegSize, VTMP1.Z(), Vector1.Z(), Vector2.Z());
     uabdlt(SubRegSize, VTMP2.Z(), Vector1.Z(), Vector2.Z());
     zip1(SubRegSize, Dst.Z(), VTMP1.Z(), VTMP2.Z());
+  } else if (PairedAVX && Is256Bit) {
+    const auto Src1 = Vector1;
+    const auto Src2 = Vector2;
+    uabdl(SubRegSize, VTMP1.D(), Src1.D(), Src2.D());
+    uabdl2(SubRegSize, GetVRegUpper(Node).Q(), Src1.Q(), Src2.Q());
+    mov(Dst.Q(), VTMP1.Q());
   } else {
     uabdl(SubRegSize, Dst.D(), Vector1.D(), Vector2.D());
   }
@@ -2876,6 +3082,23 @@ DEF_OP(VTBL1) {
       break;
     }
     case 32: {
+      if (PairedAVX) {
+        // Two register TBL wants the table in consecutive registers, which the halves of a pair already are.
+        auto Table = std::make_pair(VTMP1, VTMP2);
+        if (IsFPRPair(Op->VectorTable.ID())) {
+          Table = GetVRegPair(Op->VectorTable.ID());
+        } else {
+          mov(VTMP1.Q(), VectorTable.Q());
+          eor(VTMP2.Q(), VTMP2.Q(), VTMP2.Q());
+        }
+
+        const auto Indices = GetVRegPair(Op->VectorIndices.ID());
+        tbl(VTMP3.Q(), Table.first.Q(), Table.second.Q(), Indices.first.Q());
+        tbl(GetVRegUpper(Node).Q(), Table.first.Q(), Table.second.Q(), Indices.second.Q());
+        mov(Dst.Q(), VTMP3.Q());
+        break;
+      }
+
       LOGMAN_THROW_AA_FMT(HostSupportsSVE,
                           "Host does not support SVE. Cannot perform 256-bit table lookup");
 
@@ -76,18 +76,20 @@ DEF_OP(ExitFunction) {
 
   uint64_t NewRIP;
 
-  if (IsInlineConstant(Op->NewRIP, &NewRIP) || IsInlineEntrypointOffset(Op->NewRIP, &NewRIP)) {
-    Label l_BranchHost;
-    Label l_BranchGuest;
+  const bool IsEntrypointOffset = IsInlineEntrypointOffset(Op->NewRIP, &NewRIP);
+  if (IsEntrypointOffset || IsInlineConstant(Op->NewRIP, &NewRIP)) {
+    auto l_BranchHost = InsertNamedSymbolLiteral(FEXCore::CPU::RelocNamedSymbolLiteral::NamedSymbol::SYMBOL_LITERAL_EXITFUNCTION_LINKER);
 
-    lea(rax, ptr[rip + l_BranchHost]);
+    lea(rax, ptr[rip + l_BranchHost.Offset]);
     jmp(qword[rax]);
 
-    L(l_BranchHost);
-    //FEX_TODO(this is not per thread)
-    dq(ThreadState->CurrentFrame->Pointers.Common.ExitFunctionLinker);
-    L(l_BranchGuest);
-    dq(NewRIP);
+    PlaceNamedSymbolLiteral(l_BranchHost);
+    if (IsEntrypointOffset) {
+      InsertGuestRIPLiteral(NewRIP);
+    }
+    else {
+      dq(NewRIP);
+    }
   } else {
     Xbyak::Reg RipReg = GetSrc<RA_64>(Op->NewRIP.ID());
 
@@ -211,9 +213,7 @@ DEF_OP(Thunk) {
 
   mov(rdi, GetSrc<RA_64>(Op->ArgPtr.ID()));
 
-  auto thunkFn = ThreadState->CTX->ThunkHandler->LookupThunk(Op->ThunkNameHash);
-
-  mov(rax, reinterpret_cast<uintptr_t>(thunkFn));
+  InsertNamedThunkRelocation(rax, Op->ThunkNameHash);
   call(rax);
 
   if (NumPush & 1)
@@ -230,7 +230,7 @@ DEF_OP(ValidateCode) {
   int idx = 0;
 
   xor_(GetDst<RA_64>(Node), GetDst<RA_64>(Node));
-  mov(rax, Entry + Op->Offset);
+  InsertGuestRIPMove(rax, Entry + Op->Offset);
   mov(rbx, 1);
   while (len >= 4) {
     cmp(dword[rax + idx], *(const uint32_t*)(OldCode + idx));
@@ -263,7 +263,7 @@ DEF_OP(ThreadRemoveCodeEntry) {
     sub(rsp, 8); // Align
 
   mov(rdi, STATE);
-  mov(rax, Entry); // imm64 move
+  InsertGuestRIPMove(rax, Entry); // imm64 move
   mov(rsi, rax);
 
   call(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.ThreadRemoveCodeEntryFromJIT)]);
@@ -593,8 +593,8 @@ void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRLi
   this->DebugData = DebugData;
 
   // Fairly excessive buffer range to make sure we don't overflow
-  uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
-  if ((getSize() + BufferRange) > CurrentCodeBuffer->Size) {
+  uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize + MaxBlockTailSize(SSACount);
+  if ((getSize() + BufferRange) > GetCodeBufferLimit()) {
     CTX->ClearCodeCache(ThreadState);
   }
 
@@ -742,10 +742,15 @@ void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRLi
   void *GuestExit = getCurr<void*>();
   this->IR = nullptr;
 
+  const auto HostCodeSize = reinterpret_cast<uintptr_t>(GuestExit) - reinterpret_cast<uintptr_t>(GuestEntry);
+
+  // PC map for the block
+  setSize(getSize() + EmitBlockTail(Entry, GuestEntry, HostCodeSize, getCurr<uint8_t*>()));
+
   ready();
 
   if (DebugData) {
-    DebugData->HostCodeSize = reinterpret_cast<uintptr_t>(GuestExit) - reinterpret_cast<uintptr_t>(GuestEntry);
+    DebugData->HostCodeSize = HostCodeSize;
     DebugData->Relocations = &Relocations;
   }
 
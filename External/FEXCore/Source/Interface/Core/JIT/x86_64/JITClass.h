@@ -62,6 +62,8 @@ public:
                                   FEXCore::Core::DebugData *DebugData,
                                   FEXCore::IR::RegisterAllocationData *RAData, bool GDBEnabled) override;
 
+  [[nodiscard]] void *RelocateJITObjectCode(uint64_t Entry, CodeSerialize::CodeObjectFileSection const *SerializationData) override;
+
   [[nodiscard]] void *MapRegion(void* HostPtr, uint64_t, uint64_t) override { return HostPtr; }
 
   [[nodiscard]] bool NeedsOpDispatch() override { return true; }
@@ -104,6 +106,13 @@ private:
      */
     void InsertGuestRIPMove(Xbyak::Reg Reg, uint64_t Constant);
 
+    /**
+     * @brief Places a guest RIP as a literal in memory at the current location
+     *
+     * @param GuestRIP - The guest RIP that will be relocated
+     */
+    void InsertGuestRIPLiteral(uint64_t GuestRIP);
+
     /**
      * @brief Inserts a named symbol as a literal in memory
      *
@@ -24,7 +24,12 @@ namespace FEXCore::CPU {
 DEF_OP(GuestOpcode) {
   auto Op = IROp->C<IR::IROp_GuestOpcode>();
   // metadata
-  DebugData->GuestOpcodes.push_back({Op->GuestEntryOffset, getCurr<uint8_t*>() - GuestEntry});
+  const auto HostOffset = getCurr<uint8_t*>() - GuestEntry;
+  AddPCMapEntry(HostOffset, Op->GuestEntryOffset);
+
+  if (DebugData && CTX->Config.GDBSymbols()) {
+    DebugData->GuestOpcodes.push_back({Op->GuestEntryOffset, HostOffset});
+  }
 }
 
 DEF_OP(Fence) {
@@ -6,8 +6,11 @@ $end_info$
 */
 #include "Interface/Context/Context.h"
 #include "Interface/Core/JIT/x86_64/JITClass.h"
+#include "Interface/Core/ObjectCache/ObjectCacheService.h"
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include <cstring>
+
 namespace FEXCore::CPU {
 uint64_t X86JITCore::GetNamedSymbolLiteral(FEXCore::CPU::RelocNamedSymbolLiteral::NamedSymbol Op) {
   switch (Op) {
@@ -39,6 +42,28 @@ void X86JITCore::LoadConstantWithPadding(Xbyak::Reg Reg, uint64_t Constant) {
   nop(NOPPadSize);
 }
 
+void X86JITCore::InsertNamedThunkRelocation(Xbyak::Reg Reg, const IR::SHA256Sum &Sum) {
+  Relocation MoveABI{};
+  MoveABI.NamedThunkMove.Header.Type = FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE;
+
+  // Offset is the offset from the entrypoint of the block
+  auto CurrentCursor = getSize();
+  MoveABI.NamedThunkMove.Offset = CurrentCursor - CursorEntry;
+  MoveABI.NamedThunkMove.Symbol = Sum;
+  MoveABI.NamedThunkMove.RegisterIndex = Reg.getIdx();
+
+  uint64_t Pointer = reinterpret_cast<uint64_t>(CTX->ThunkHandler->LookupThunk(Sum));
+
+  if (CTX->Config.CacheObjectCodeCompilation()) {
+    LoadConstantWithPadding(Reg, Pointer);
+  }
+  else {
+    mov(Reg, Pointer);
+  }
+
+  Relocations.emplace_back(MoveABI);
+}
+
 X86JITCore::NamedSymbolLiteralPair X86JITCore::InsertNamedSymbolLiteral(FEXCore::CPU::RelocNamedSymbolLiteral::NamedSymbol Op) {
   NamedSymbolLiteralPair Lit {
     .MoveABI = {
@@ -87,6 +112,19 @@ void X86JITCore::InsertGuestRIPMove(Xbyak::Reg Reg, uint64_t Constant) {
   Relocations.emplace_back(MoveABI);
 }
 
+void X86JITCore::InsertGuestRIPLiteral(const uint64_t GuestRIP) {
+  Relocation MoveABI{};
+  MoveABI.GuestRIPLiteral.Header.Type = FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_LITERAL;
+
+  // Offset is the offset from the entrypoint of the block
+  auto CurrentCursor = getSize();
+  MoveABI.GuestRIPLiteral.Offset = CurrentCursor - CursorEntry;
+  MoveABI.GuestRIPLiteral.GuestRIP = GuestRIP;
+
+  dq(GuestRIP);
+  Relocations.emplace_back(MoveABI);
+}
+
 bool X86JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uint64_t CursorEntry, size_t NumRelocations, const char* EntryRelocations) {
   size_t DataIndex{};
   for (size_t j = 0; j < NumRelocations; ++j) {
@@ -107,7 +145,8 @@ bool X86JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uint6
       }
       case FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE: {
         uint64_t Pointer = reinterpret_cast<uint64_t>(CTX->ThunkHandler->LookupThunk(Reloc->NamedThunkMove.Symbol));
-        if (Pointer == ~0ULL) {
+        if (Pointer == 0) {
+          // Thunk isn't registered in this process
           return false;
         }
 
@@ -117,12 +156,11 @@ bool X86JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uint6
         DataIndex += sizeof(Reloc->NamedThunkMove);
         break;
       }
-      case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_MOVE:
-        // XXX: Reenable once the JIT Object Cache is upstream
-        // XXX: Should spin the relocation list, create a list of guest RIP moves, and ask for them all once, reduces lock contention.
-        uint64_t Pointer = ~0ULL; // EmitterCTX->JITObjectCache->FindRelocatedRIP(Reloc->GuestRIPMove.GuestRIP);
-        if (Pointer == ~0ULL) {
-          return false;
+      case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_MOVE: {
+        // Serialized guest RIPs are relative to the block entry
+        uint64_t Pointer = GuestEntry + Reloc->GuestRIPMove.GuestRIP;
+        if (!CTX->Config.Is64BitMode()) {
+          Pointer &= 0xFFFF'FFFFULL;
         }
 
         // Relocation occurs at the cursorEntry + offset relative to that cursor.
@@ -130,10 +168,60 @@ bool X86JITCore::ApplyRelocations(uint64_t GuestEntry, uint64_t CodeEntry, uint6
         LoadConstantWithPadding(Xbyak::Reg64(Reloc->GuestRIPMove.RegisterIndex), Pointer);
         DataIndex += sizeof(Reloc->GuestRIPMove);
         break;
+      }
+      case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_LITERAL: {
+        // Serialized guest RIPs are relative to the block entry
+        uint64_t Pointer = GuestEntry + Reloc->GuestRIPLiteral.GuestRIP;
+        if (!CTX->Config.Is64BitMode()) {
+          Pointer &= 0xFFFF'FFFFULL;
+        }
+
+        // Relocation occurs at the cursorEntry + offset relative to that cursor.
+        setSize(CursorEntry + Reloc->GuestRIPLiteral.Offset);
+        dq(Pointer);
+        DataIndex += sizeof(Reloc->GuestRIPLiteral);
+        break;
+      }
+      default:
+        // Written by a newer FEX, don't try to use it
+        return false;
     }
   }
 
   return true;
 }
+
+void *X86JITCore::RelocateJITObjectCode(uint64_t Entry, CodeSerialize::CodeObjectFileSection const *SerializationData) {
+  FEXCORE_PROFILE_SCOPED("x86::RelocateJITObjectCode");
+
+  const auto Data = SerializationData->Data;
+  constexpr uint64_t Alignment = CodeSerialize::CodeSerializationData::ENTRY_ALIGNMENT;
+
+  if ((getSize() + Data->HostCodeLength + Alignment + MaxBlockTailSize(0)) > GetCodeBufferLimit()) {
+    CTX->ClearCodeCache(ThreadState);
+  }
+
+  // Place the code with the alignment it was emitted with so its literals keep their alignment
+  setSize(getSize() + ((Data->HostCodeAlignment - reinterpret_cast<uint64_t>(getCurr())) & (Alignment - 1)));
+
+  const auto CursorBegin = getSize();
+  auto HostEntry = getCurr<uint8_t *>();
+  memcpy(HostEntry, SerializationData->HostCode, Data->HostCodeLength);
+
+  if (!ApplyRelocations(Entry, reinterpret_cast<uint64_t>(HostEntry), CursorBegin,
+                        SerializationData->NumRelocations, SerializationData->Relocations)) {
+    // Throw the copy away, the caller will compile the block instead
+    setSize(CursorBegin);
+    return nullptr;
+  }
+
+  setSize(CursorBegin + Data->HostCodeLength);
+
+  // Cached code has no instruction boundaries, the PC map only knows the block entry
+  setSize(getSize() + EmitBlockTail(Entry, HostEntry, Data->HostCodeLength, getCurr<uint8_t*>()));
+  ready();
+
+  return HostEntry;
+}
 }
 
@@ -25,10 +25,10 @@ LookupCache::LookupCache(FEXCore::Context::Context *CTX)
   // PageMemoryMap[VirtualMemoryRegion >> 12]
   //       |
   //       v
-  // PageMemory[Memory & (VIRTUAL_PAGE_SIZE - 1)]
+  // L2Page, hashed by Memory & (VIRTUAL_PAGE_SIZE - 1)
   //       |
   //       v
-  // Pointer to Code
+  // L2Page::CodeBase + Offset to Code
   //
   // Allocate a region of memory that we can use to back our block pointers
   // We need one pointer per page of virtual memory
@@ -36,10 +36,9 @@ LookupCache::LookupCache(FEXCore::Context::Context *CTX)
   PagePointer = reinterpret_cast<uintptr_t>(FEXCore::Allocator::mmap(nullptr, TotalCacheSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
 
   // Allocate our memory backing our pages
-  // We need 32KB per guest page (One pointer per byte)
-  // XXX: We can drop down to 16KB if we store 4byte offsets from the code base
+  // Each guest page gets a table of 8 bytes per entry sized for the blocks it contains,
+  // most pages only hold a handful of blocks and stay below 256 bytes.
   // We currently limit to 128MB of real memory for caching for the total cache size.
-  // Can end up being inefficient if we compile a small number of blocks per page
   PageMemory = PagePointer + ctx->Config.VirtualMemSize / 4096 * 8;
   LOGMAN_THROW_AA_FMT(PageMemory != -1ULL, "Failed to allocate page memory");
 
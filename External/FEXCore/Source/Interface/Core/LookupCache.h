@@ -1,6 +1,7 @@
 #pragma once
 #include <FEXCore/Utils/LogManager.h>
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -24,6 +25,94 @@ public:
     uintptr_t GuestCode;
   };
 
+  // The dispatchers read entries without the lock, always as a single 64-bit load so key and offset can't tear
+  struct alignas(8) L2Entry {
+    // Offset of the block in the guest page plus one, zero marks an empty slot
+    uint32_t Key;
+    // Relative to L2Page::CodeBase
+    int32_t HostCodeOffset;
+  };
+  static_assert(sizeof(L2Entry) == 8 && std::atomic_ref<L2Entry>::is_always_lock_free);
+
+  /**
+   * @brief Per guest page L2 table
+   *
+   * Open addressed with linear probing and sized to the number of blocks in the page,
+   * the L2Entry array directly follows the header.
+   */
+  struct L2Page {
+    // Full guest address of the page, pages alias once addresses go past the virtual memory size
+    uint64_t GuestPage;
+    uintptr_t CodeBase;
+    // Number of entries minus one
+    uint32_t Mask;
+    uint32_t Count;
+    uint64_t Pad;
+
+    L2Entry *Entries() {
+      return reinterpret_cast<L2Entry*>(this + 1);
+    }
+  };
+
+  // The dispatchers inline this, keep them in sync
+  static uint32_t L2Hash(uint64_t PageOffset) {
+    return PageOffset ^ (PageOffset >> 4);
+  }
+
+  // L2 table operations, the caller holds WriteLock
+  static L2Entry *FindL2Entry(L2Page *Page, uint64_t PageOffset) {
+    const uint32_t Key = PageOffset + 1;
+    auto Entries = Page->Entries();
+
+    // Tables are never full, so this always runs in to an empty slot
+    for (uint32_t i = L2Hash(PageOffset) & Page->Mask;; i = (i + 1) & Page->Mask) {
+      if (Entries[i].Key == Key) {
+        return &Entries[i];
+      }
+      if (Entries[i].Key == 0) {
+        return nullptr;
+      }
+    }
+  }
+
+  static void InsertL2Entry(L2Page *Page, uint32_t Key, int32_t HostCodeOffset) {
+    auto Entries = Page->Entries();
+
+    uint32_t i = L2Hash(Key - 1) & Page->Mask;
+    while (Entries[i].Key) {
+      i = (i + 1) & Page->Mask;
+    }
+
+    StoreL2Entry(&Entries[i], Key, HostCodeOffset);
+    ++Page->Count;
+  }
+
+  static void EraseL2Entry(L2Page *Page, L2Entry *Entry) {
+    auto Entries = Page->Entries();
+    const auto Mask = Page->Mask;
+
+    // No tombstones, instead pull later entries of the probe run back in to the hole
+    // An entry can move when the hole sits between its home slot and where it is now.
+    // A moved entry stays in its old slot until that is overwritten or cleared, so lock-free probes never
+    // stop early on a hole that is only there mid-move. At worst they see the entry twice.
+    uint32_t Hole = Entry - Entries;
+    for (uint32_t i = (Hole + 1) & Mask; Entries[i].Key; i = (i + 1) & Mask) {
+      const uint32_t Home = L2Hash(Entries[i].Key - 1) & Mask;
+      if (((i - Home) & Mask) >= ((i - Hole) & Mask)) {
+        StoreL2Entry(&Entries[Hole], Entries[i].Key, Entries[i].HostCodeOffset);
+        Hole = i;
+      }
+    }
+
+    StoreL2Entry(&Entries[Hole], 0, 0);
+    --Page->Count;
+  }
+
+  static void StoreL2Entry(L2Entry *Entry, uint32_t Key, int32_t HostCodeOffset) {
+    // Release so the dispatcher doesn't see the entry before what it points to
+    std::atomic_ref<L2Entry>(*Entry).store(L2Entry {Key, HostCodeOffset}, std::memory_order_release);
+  }
+
   LookupCache(FEXCore::Context::Context *CTX);
   ~LookupCache();
 
@@ -42,17 +131,13 @@ public:
     const auto PageOffset = Address & (0x0FFF);
 
     const auto Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    auto LocalPagePointer = Pointers[PageIndex];
-
-    // Do we a page pointer for this address?
-    if (LocalPagePointer) {
-      // Find there pointer for the address in the blocks
-      auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
+    auto Page = reinterpret_cast<L2Page*>(Pointers[PageIndex]);
 
-      if (BlockPointers[PageOffset].GuestCode == Address)
-      {
+    // Do we have a table for the page of this address?
+    if (Page && Page->GuestPage == (Address & ~0x0FFFULL)) {
+      if (auto Entry = FindL2Entry(Page, PageOffset)) {
         L1Entry.GuestCode = Address;
-        L1Entry.HostCode = BlockPointers[PageOffset].HostCode;
+        L1Entry.HostCode = Page->CodeBase + Entry->HostCodeOffset;
         return L1Entry.HostCode;
       }
     }
@@ -125,21 +210,19 @@ public:
     }
 
     // Do full map
-    Address = Address & (VirtualMemSize -1);
-    uint64_t PageOffset = Address & (0x0FFF);
-    Address >>= 12;
+    const auto PageIndex = (Address & (VirtualMemSize -1)) >> 12;
+    const auto PageOffset = Address & (0x0FFF);
 
     uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    uint64_t LocalPagePointer = Pointers[Address];
-    if (!LocalPagePointer) {
+    auto Page = reinterpret_cast<L2Page*>(Pointers[PageIndex]);
+    if (!Page || Page->GuestPage != (Address & ~0x0FFFULL)) {
       // Page for this code didn't even exist, nothing to do
       return;
     }
 
-    // Page exists, just set the offset to zero
-    auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
-    BlockPointers[PageOffset].GuestCode = 0;
-    BlockPointers[PageOffset].HostCode = 0;
+    if (auto Entry = FindL2Entry(Page, PageOffset)) {
+      EraseL2Entry(Page, Entry);
+    }
   }
 
 
@@ -177,48 +260,90 @@ private:
     L1Entry.GuestCode = Address;
     L1Entry.HostCode = HostCode;
 
-    // Do ful map
-    auto FullAddress = Address;
-    Address = Address & (VirtualMemSize -1);
+    // Do full map
+    const auto GuestPage = Address & ~0x0FFFULL;
+    const auto PageIndex = (Address & (VirtualMemSize -1)) >> 12;
+    const auto PageOffset = Address & (0x0FFF);
 
-    uint64_t PageOffset = Address & (0x0FFF);
-    Address >>= 12;
     uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    uint64_t LocalPagePointer = Pointers[Address];
-    if (!LocalPagePointer) {
-      // We don't have a page pointer for this address
+    auto Page = reinterpret_cast<L2Page*>(Pointers[PageIndex]);
+    if (!Page || Page->GuestPage != GuestPage) {
+      // We don't have a table for this page, or the slot belongs to a page aliasing with it
       // Allocate one now if we can
-      uintptr_t NewPageBacking = AllocateBackingForPage();
-      if (!NewPageBacking) {
+      Page = AllocateL2Page(GuestPage, HostCode, L2_MIN_ENTRIES);
+      if (!Page) {
         // Couldn't allocate, clear L2 and retry
         ClearL2Cache();
         CacheBlockMapping(Address, HostCode);
         return;
       }
-      Pointers[Address] = NewPageBacking;
-      LocalPagePointer = NewPageBacking;
+      PublishL2Page(&Pointers[PageIndex], Page);
     }
 
-    // Add the new pointer to the page block
-    auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
+    auto Entry = FindL2Entry(Page, PageOffset);
+
+    const int64_t HostCodeOffset = HostCode - Page->CodeBase;
+    if (HostCodeOffset != static_cast<int32_t>(HostCodeOffset)) {
+      // Too far away from the rest of the page's code to encode, leave this block to L3
+      if (Entry) {
+        EraseL2Entry(Page, Entry);
+      }
+      return;
+    }
+
+    if (Entry) {
+      // This silently replaces existing mappings
+      StoreL2Entry(Entry, Entry->Key, HostCodeOffset);
+      return;
+    }
 
-    // This silently replaces existing mappings
-    BlockPointers[PageOffset].GuestCode = FullAddress;
-    BlockPointers[PageOffset].HostCode = HostCode;
+    if ((Page->Count + 1) * 4 > (Page->Mask + 1) * 3) {
+      // Table is getting full, move to one twice the size
+      // The old one stays allocated until the next L2 clear
+      auto NewPage = AllocateL2Page(GuestPage, Page->CodeBase, (Page->Mask + 1) * 2);
+      if (!NewPage) {
+        ClearL2Cache();
+        CacheBlockMapping(Address, HostCode);
+        return;
+      }
+
+      auto Entries = Page->Entries();
+      for (uint32_t i = 0; i <= Page->Mask; ++i) {
+        if (Entries[i].Key) {
+          InsertL2Entry(NewPage, Entries[i].Key, Entries[i].HostCodeOffset);
+        }
+      }
+
+      PublishL2Page(&Pointers[PageIndex], NewPage);
+      Page = NewPage;
+    }
+
+    InsertL2Entry(Page, PageOffset + 1, HostCodeOffset);
   }
 
-  uintptr_t AllocateBackingForPage() {
-    uintptr_t NewBase = AllocateOffset;
-    uintptr_t NewEnd = AllocateOffset + SIZE_PER_PAGE;
+  // The header and entries of a page have to be visible before the dispatchers can find it
+  static void PublishL2Page(uintptr_t *Pointer, L2Page *Page) {
+    std::atomic_ref<uintptr_t>(*Pointer).store(reinterpret_cast<uintptr_t>(Page), std::memory_order_release);
+  }
+
+  L2Page *AllocateL2Page(uint64_t GuestPage, uintptr_t CodeBase, uint32_t NumEntries) {
+    const size_t Size = sizeof(L2Page) + NumEntries * sizeof(L2Entry);
 
-    if (NewEnd >= CODE_SIZE) {
+    if (AllocateOffset + Size >= CODE_SIZE) {
       // We ran out of block backing space. Need to clear the block cache and tell the JIT cores to clear their caches as well
       // Tell whatever is calling this that it needs to do it.
-      return 0;
+      return nullptr;
     }
 
-    AllocateOffset = NewEnd;
-    return PageMemory + NewBase;
+    // Backing memory is zero filled, so every entry starts out empty
+    auto Page = reinterpret_cast<L2Page*>(PageMemory + AllocateOffset);
+    AllocateOffset += Size;
+
+    Page->GuestPage = GuestPage;
+    Page->CodeBase = CodeBase;
+    Page->Mask = NumEntries - 1;
+    Page->Count = 0;
+    return Page;
   }
 
   uintptr_t PagePointer;
@@ -255,7 +380,8 @@ private:
   size_t TotalCacheSize;
 
   constexpr static size_t CODE_SIZE = 128 * 1024 * 1024;
-  constexpr static size_t SIZE_PER_PAGE = 4096 * sizeof(LookupCacheEntry);
+  // Must be a power of 2
+  constexpr static uint32_t L2_MIN_ENTRIES = 8;
   constexpr static size_t L1_SIZE = L1_ENTRIES * sizeof(LookupCacheEntry);
 
   size_t AllocateOffset {};
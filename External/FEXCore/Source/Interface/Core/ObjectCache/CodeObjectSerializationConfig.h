@@ -42,9 +42,15 @@ namespace FEXCore::CodeSerialize {
     // x87 reduced precision
     bool x87ReducedPrecision : 1;
 
+    // Stack accesses skip TSO emulation
+    bool StackTSOElision : 1;
+
+    // RBP based accesses skip TSO emulation
+    bool FramePointerTSOElision : 1;
+
     // Padding to remove uninitialized data warning from asan
     // Shows remaining amount of bits available for config
-    unsigned _Pad : 18;
+    unsigned _Pad : 16;
 
     bool operator==(CodeObjectSerializationConfig const &other) const {
       return Cookie == other.Cookie &&
@@ -58,7 +64,9 @@ namespace FEXCore::CodeSerialize {
         ParanoidTSO == other.ParanoidTSO &&
         Is64BitMode == other.Is64BitMode &&
         SMCChecks == other.SMCChecks &&
-        x87ReducedPrecision == other.x87ReducedPrecision;
+        x87ReducedPrecision == other.x87ReducedPrecision &&
+        StackTSOElision == other.StackTSOElision &&
+        FramePointerTSOElision == other.FramePointerTSOElision;
     }
     static uint64_t GetHash(CodeObjectSerializationConfig const &other) {
       // For < 64-bits of data just pack directly
@@ -75,6 +83,8 @@ namespace FEXCore::CodeSerialize {
       Hash <<= 1;  Hash |= other.Is64BitMode;
       Hash <<= 2;  Hash |= other.SMCChecks;
       Hash <<= 1;  Hash |= other.x87ReducedPrecision;
+      Hash <<= 1;  Hash |= other.StackTSOElision;
+      Hash <<= 1;  Hash |= other.FramePointerTSOElision;
       return Hash;
     }
   };
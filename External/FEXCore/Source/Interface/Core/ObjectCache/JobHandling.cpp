@@ -37,7 +37,8 @@ namespace FEXCore::CodeSerialize {
 
         auto &EntryMap = CodeObjectCacheService->GetEntryMap();
 
-        auto it = EntryMap.emplace(Base, std::move(Entry));
+        // try_emplace leaves Entry alone if the insert fails
+        auto it = EntryMap.try_emplace(Base, std::move(Entry));
         if (!it.second) {
           // This happens when an application overwrites a previous region without unmapping what was there
 
@@ -45,11 +46,16 @@ namespace FEXCore::CodeSerialize {
           // Once this passes then we know that this section has been loaded.
           it.first->second->NamedJobRefCountMutex.lock();
 
+          // Wait for any outstanding serialization jobs on the entry
+          it.first->second->ObjectJobRefCountMutex.lock();
+
           // Finalize anything the region needs to do first.
           CodeObjectCacheService->DoCodeRegionClosure(it.first->second->Base, it.first->second.get());
 
           // munmap the file that was mapped
-          FEXCore::Allocator::munmap(it.first->second->CodeData, it.first->second->FileSize);
+          if (it.first->second->CodeData) {
+            FEXCore::Allocator::munmap(it.first->second->CodeData, it.first->second->FileSize);
+          }
 
           // Remove this entry from the unrelocated map as well
           {
@@ -57,6 +63,10 @@ namespace FEXCore::CodeSerialize {
             CodeObjectCacheService->GetUnrelocatedEntryMap().erase(it.first->second->EntryHeader.OriginalBase);
           }
 
+          // Nothing can reach the old entry anymore, unlock it so it can be destroyed
+          it.first->second->ObjectJobRefCountMutex.unlock();
+          it.first->second->NamedJobRefCountMutex.unlock();
+
           // Now overwrite the entry in the map
           it = EntryMap.insert_or_assign(Base, std::move(Entry));
           EntryIterator = it.first;
@@ -81,47 +91,91 @@ namespace FEXCore::CodeSerialize {
 
   void AsyncJobHandler::AsyncRemoveNamedRegionJob(uintptr_t Base, uintptr_t Size) {
     // Removing a named region through the job system
-    // We need to find the entry that we are deleting first
-    std::unique_ptr<CodeRegionEntry> EntryPointer;
-    {
-      std::unique_lock lk {CodeObjectCacheService->GetEntryMapMutex()};
+    // Every region that starts inside of the removed range goes away
+    std::unique_lock lk {CodeObjectCacheService->GetEntryMapMutex()};
 
-      auto &EntryMap = CodeObjectCacheService->GetEntryMap();
-      auto it = EntryMap.find(Base);
-      if (it != EntryMap.end()) {
-        // Lock the job ref counter since we are erasing it
-        // Once this passes it will have been loaded
-        it->second->NamedJobRefCountMutex.lock();
+    auto &EntryMap = CodeObjectCacheService->GetEntryMap();
+    auto it = EntryMap.lower_bound(Base);
+    bool HadWork {};
 
-        // Take the pointer from the map
-        EntryPointer = std::move(it->second);
+    // The canary at the end of the map is never removed
+    while (it != EntryMap.end() && it->first < (Base + Size) && it->first != ~0ULL) {
+      // Lock the job ref counter since we are erasing it
+      // Once this passes it will have been loaded
+      it->second->NamedJobRefCountMutex.lock();
 
-        // We can now unmap the file data
-        FEXCore::Allocator::munmap(EntryPointer->CodeData, EntryPointer->FileSize);
+      // Wait for any outstanding serialization jobs on the entry
+      it->second->ObjectJobRefCountMutex.lock();
 
-        // Remove this from the entry map
-        EntryMap.erase(it);
+      // Take the pointer from the map
+      auto EntryPointer = std::move(it->second);
 
-        // Remove this entry from the unrelocated map as well
-        {
-          std::unique_lock lk2 {CodeObjectCacheService->GetUnrelocatedEntryMapMutex()};
-          CodeObjectCacheService->GetUnrelocatedEntryMap().erase(EntryPointer->EntryHeader.OriginalBase);
-        }
+      // Finalize anything the region needs to do first.
+      CodeObjectCacheService->DoCodeRegionClosure(EntryPointer->Base, EntryPointer.get());
+
+      // We can now unmap the file data
+      if (EntryPointer->CodeData) {
+        FEXCore::Allocator::munmap(EntryPointer->CodeData, EntryPointer->FileSize);
       }
-      else {
-        // Tried to remove something that wasn't in our code object tracking
-        return;
+
+      // Remove this from the entry map
+      it = EntryMap.erase(it);
+
+      // Remove this entry from the unrelocated map as well
+      {
+        std::unique_lock lk2 {CodeObjectCacheService->GetUnrelocatedEntryMapMutex()};
+        CodeObjectCacheService->GetUnrelocatedEntryMap().erase(EntryPointer->EntryHeader.OriginalBase);
       }
 
       // Create the async work queue job now so it can finalize what it needs to do
-      NamedRegionHandler->AsyncRemoveNamedRegionWorkItem(Base, Size, std::move(EntryPointer));
+      NamedRegionHandler->AsyncRemoveNamedRegionWorkItem(EntryPointer->Base, EntryPointer->Size, std::move(EntryPointer));
+      HadWork = true;
+    }
 
+    if (HadWork) {
       // Tell the async thread that it has work to do
       CodeObjectCacheService->NotifyWork();
     }
   }
 
   void AsyncJobHandler::AsyncAddSerializationJob(std::unique_ptr<SerializationJobData> Data) {
-    // XXX: Actually add serialization job
+    // This is called from the JIT thread directly after compiling a block.
+    // Only the parts that can't be deferred happen here, the async thread does the rest.
+    {
+      std::shared_lock lk {CodeObjectCacheService->GetEntryMapMutex()};
+
+      auto it = CodeObjectCacheService->FindCodeRegion(Data->GuestRIP);
+      if (it == CodeObjectCacheService->GetEntryMap().end()) {
+        // Not inside of a named region, nothing to key the code off of
+        return;
+      }
+
+      auto Entry = it->second.get();
+      if (Data->GuestCodeStart < Entry->Base ||
+          Data->GuestCodeLength > (Entry->Base + Entry->Size - Data->GuestCodeStart)) {
+        // Block spans multiple regions, it can't be validated against a single region on load
+        return;
+      }
+
+      // Keep the region alive until the job is done
+      Data->ObjectJobRefCountMutexPtr = &Entry->ObjectJobRefCountMutex;
+      Data->ObjectJobRefCountMutexPtr->lock_shared();
+      Data->CodeRegionIterator = it;
+    }
+
+    // The guest code is free to change once we return, hash it now
+    Data->GuestCodeHash = XXH3_64bits(reinterpret_cast<const void*>(Data->GuestCodeStart), Data->GuestCodeLength);
+
+    // Block linking backpatches the host code once it executes, copy it now
+    auto HostCode = reinterpret_cast<const uint8_t*>(Data->HostCodeBegin);
+    Data->HostCode.assign(HostCode, HostCode + Data->HostCodeLength);
+
+    // Thread shutdown waits for this to be released
+    Data->ThreadJobRefCount->lock_shared();
+
+    CodeObjectCacheService->AsyncAddSerializationWorkItem(std::move(Data));
+
+    // Tell the async thread that it has work to do
+    CodeObjectCacheService->NotifyWork();
   }
 }
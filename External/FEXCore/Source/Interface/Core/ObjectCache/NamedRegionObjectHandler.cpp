@@ -2,9 +2,21 @@
 #include "Interface/Core/ObjectCache/ObjectCacheService.h"
 
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/Allocator.h>
+
+#include <fcntl.h>
+#include <filesystem>
+#include <fmt/format.h>
+#include <string>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <xxhash.h>
 
 namespace FEXCore::CodeSerialize {
-  NamedRegionObjectHandler::NamedRegionObjectHandler(FEXCore::Context::Context *ctx) {
+  NamedRegionObjectHandler::NamedRegionObjectHandler(FEXCore::Context::Context *ctx)
+    : CTX {ctx} {
     DefaultSerializationConfig.Cookie = CODE_COOKIE;
 
     // Initialize the Arch from CPUID
@@ -21,19 +33,116 @@ namespace FEXCore::CodeSerialize {
     DefaultSerializationConfig.Is64BitMode = ctx->Config.Is64BitMode;
     DefaultSerializationConfig.SMCChecks = ctx->Config.SMCChecks;
     DefaultSerializationConfig.x87ReducedPrecision = ctx->Config.x87ReducedPrecision;
+    DefaultSerializationConfig.StackTSOElision = ctx->Config.StackTSOElision;
+    DefaultSerializationConfig.FramePointerTSOElision = ctx->Config.FramePointerTSOElision;
+
+    if (CTX->Config.CacheObjectCodeCompilation() == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_READWRITE) {
+      std::error_code ec{};
+      std::filesystem::create_directories(std::filesystem::path(FEXCore::Config::GetDataDirectory()) / "cache", ec);
+    }
+  }
+
+  std::string NamedRegionObjectHandler::GetObjectCacheFilename(CodeRegionEntry const *Entry, const std::string &base_filename) const {
+    auto FilenameHash = XXH3_64bits(Entry->Filename.c_str(), Entry->Filename.size());
+    auto ConfigHash = CodeObjectSerializationConfig::GetHash(DefaultSerializationConfig);
+    return fmt::format("{}cache/{}-{:x}-{:x}-{:x}.objcache",
+      FEXCore::Config::GetDataDirectory(), base_filename, FilenameHash, Entry->Offset, ConfigHash);
+  }
+
+  bool NamedRegionObjectHandler::LoadObjectCacheFile(CodeRegionEntry *Entry) {
+    int FD = open(Entry->ObjectEntrySourceFilename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FD == -1) {
+      return false;
+    }
+
+    // Other processes append to the file while holding an exclusive lock
+    // Holding a shared lock while mapping means we never see a partially written entry
+    flock(FD, LOCK_SH);
+
+    struct stat Stat{};
+    void *Data = MAP_FAILED;
+    if (fstat(FD, &Stat) == 0 && static_cast<size_t>(Stat.st_size) >= sizeof(CodeObjectSerializationHeader)) {
+      Data = FEXCore::Allocator::mmap(nullptr, Stat.st_size, PROT_READ, MAP_PRIVATE, FD, 0);
+    }
+
+    flock(FD, LOCK_UN);
+    close(FD);
+
+    if (Data == MAP_FAILED) {
+      return false;
+    }
+
+    Entry->CodeData = reinterpret_cast<char*>(Data);
+    Entry->FileSize = Stat.st_size;
+
+    auto Header = reinterpret_cast<CodeObjectSerializationHeader const*>(Entry->CodeData);
+    if (!(Header->Config == DefaultSerializationConfig) ||
+        Header->OriginalOffset != Entry->Offset) {
+      // Written by a different version of FEX, leave the file alone
+      FEXCore::Allocator::munmap(Entry->CodeData, Entry->FileSize);
+      Entry->CodeData = nullptr;
+      Entry->FileSize = 0;
+      Entry->StillSerializing = false;
+      return false;
+    }
+
+    // Walk the entries, stopping at anything that doesn't fit inside of the file
+    // This only happens when a process died while appending
+    Entry->FileCodeSections.reserve(Header->NumCodeEntries);
+    size_t Offset = sizeof(CodeObjectSerializationHeader);
+    while ((Entry->FileSize - Offset) >= sizeof(CodeSerializationData)) {
+      auto SectionData = reinterpret_cast<CodeSerializationData const*>(&Entry->CodeData[Offset]);
+      if (SectionData->HostCodeLength == 0 ||
+          SectionData->HostCodeLength > Entry->FileSize ||
+          SectionData->GetEntrySize() > (Entry->FileSize - Offset)) {
+        break;
+      }
+
+      Entry->FileCodeSections.emplace_back(CodeObjectFileSection {
+        .Serialized = true,
+        .Invalid = false,
+        .Data = SectionData,
+        .HostCode = &Entry->CodeData[Offset + SectionData->GetHostCodeOffset()],
+        .NumRelocations = SectionData->NumRelocations,
+        .Relocations = &Entry->CodeData[Offset + SectionData->GetRelocationsOffset()],
+      });
+
+      Offset += SectionData->GetEntrySize();
+    }
+
+    Entry->SectionLookupMap.reserve(Entry->FileCodeSections.size());
+    for (auto &Section : Entry->FileCodeSections) {
+      // A stale entry gets a replacement appended after it, so the last one wins
+      Entry->SectionLookupMap.insert_or_assign(Section.Data->GuestRIPOffset, &Section);
+    }
+
+    return true;
   }
 
   void NamedRegionObjectHandler::AddNamedRegionObject(CodeRegionMapType::iterator Entry, const std::string &base_filename, const std::string &filename, bool Executable) {
-    // XXX: Add named region objects
+    auto RegionEntry = Entry->second.get();
+
+    if (Executable) {
+      RegionEntry->ObjectEntrySourceFilename = GetObjectCacheFilename(RegionEntry, base_filename);
+
+      LoadObjectCacheFile(RegionEntry);
+
+      if (RegionEntry->StillSerializing &&
+          CTX->Config.CacheObjectCodeCompilation() == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_READWRITE) {
+        RegionEntry->CurrentSerializedFD = open(RegionEntry->ObjectEntrySourceFilename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+      }
+    }
 
-    // XXX: Until entry loading is complete just claim it is loaded
-    Entry->second->NamedJobRefCountMutex.unlock();
+    RegionEntry->StillSerializing = RegionEntry->CurrentSerializedFD != -1;
+
+    // Entry is loaded, code lookups can use it now
+    RegionEntry->NamedJobRefCountMutex.unlock();
   }
 
   void NamedRegionObjectHandler::RemoveNamedRegionObject(uintptr_t Base, uintptr_t Size, std::unique_ptr<CodeRegionEntry> Entry) {
-    // XXX: Remove named region objects
-
-    // XXX: Until entry loading is complete just claim it is loaded
+    // The removal job already waited for outstanding lookups and serialization jobs and closed the entry.
+    // Release the locks it took so the entry can be safely destroyed.
+    Entry->ObjectJobRefCountMutex.unlock();
     Entry->NamedJobRefCountMutex.unlock();
   }
 
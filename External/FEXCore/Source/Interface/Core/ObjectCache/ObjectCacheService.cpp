@@ -1,8 +1,16 @@
 #include "Interface/Core/ObjectCache/ObjectCacheService.h"
 
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/LogManager.h>
 
+#include <array>
 #include <memory>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <xxhash.h>
 
 namespace {
   static void* ThreadHandler(void *Arg) {
@@ -51,12 +59,212 @@ namespace FEXCore::CodeSerialize {
       // Don't do closure on canary
       return;
     }
-    // XXX: Do code region closure
+
+    // Every entry was appended as it was serialized, only the file needs closing
+    it->StillSerializing = false;
+    if (it->CurrentSerializedFD != -1) {
+      close(it->CurrentSerializedFD);
+      it->CurrentSerializedFD = -1;
+    }
+  }
+
+  CodeRegionMapType::iterator CodeObjectSerializeService::FindCodeRegion(uint64_t Address) {
+    auto it = AddressToEntryMap.upper_bound(Address);
+    if (it == AddressToEntryMap.begin()) {
+      return AddressToEntryMap.end();
+    }
+
+    --it;
+    // The canary has no size so it never contains anything
+    if (Address >= (it->second->Base + it->second->Size)) {
+      return AddressToEntryMap.end();
+    }
+
+    return it;
   }
 
   CodeObjectFileSection const *CodeObjectSerializeService::FetchCodeObjectFromCache(uint64_t GuestRIP) {
-    // XXX: Actually fetch code objects from cache
-    return nullptr;
+    std::shared_lock lk {EntryMapMutex};
+
+    auto it = FindCodeRegion(GuestRIP);
+    if (it == AddressToEntryMap.end()) {
+      return nullptr;
+    }
+
+    auto Entry = it->second.get();
+
+    // Blocks until the async thread has finished loading the region
+    std::shared_lock lk2 {Entry->NamedJobRefCountMutex};
+
+    auto SectionIt = Entry->SectionLookupMap.find(GuestRIP - Entry->Base);
+    if (SectionIt == Entry->SectionLookupMap.end()) {
+      return nullptr;
+    }
+
+    auto Section = SectionIt->second;
+    auto Data = Section->Data;
+
+    const uint64_t GuestCodeStart = GuestRIP + Data->GuestCodeOffset;
+    if (GuestCodeStart < Entry->Base ||
+        Data->GuestCodeLength > (Entry->Base + Entry->Size - GuestCodeStart)) {
+      return nullptr;
+    }
+
+    // Compiled while TSO wasn't in effect yet, either by this process before memory was shared or by a single threaded process.
+    // Code compiled with TSO is safe to run either way.
+    if (!(Data->Flags & CodeSerializationData::FLAG_TSO) && CTX->IsTSOEnabled()) {
+      return nullptr;
+    }
+
+    // The guest code might have changed since the entry was written, either from SMC or a different build of the file
+    if (XXH3_64bits(reinterpret_cast<const void*>(GuestCodeStart), Data->GuestCodeLength) != Data->GuestCodeHash) {
+      return nullptr;
+    }
+
+    if (XXH3_64bits(Section->HostCode, Data->HostCodeLength) != Data->HostCodeHash) {
+      LogMan::Msg::DFmt("ObjectCache: Corrupt entry for 0x{:x} in {}", GuestRIP, Entry->ObjectEntrySourceFilename);
+      return nullptr;
+    }
+
+    return Section;
+  }
+
+  void CodeObjectSerializeService::HandleSerializationJobs() {
+    while (SerializationWorkQueueJobs.load()) {
+      std::unique_ptr<AsyncJobHandler::SerializationJobData> Data;
+
+      {
+        std::unique_lock lk {SerializationWorkQueueMutex};
+        Data = std::move(SerializationWorkQueue.front());
+        SerializationWorkQueue.pop();
+        --SerializationWorkQueueJobs;
+      }
+
+      // The load job for this job's region was queued before the job itself.
+      // Drain the named region jobs so the region is loaded before we append to it.
+      NamedRegionHandler.HandleNamedRegionObjectJobs();
+
+      SerializeCodeObject(Data.get());
+
+      // Release the references the job was holding
+      Data->ObjectJobRefCountMutexPtr->unlock_shared();
+      Data->ThreadJobRefCount->unlock_shared();
+    }
+  }
+
+  void CodeObjectSerializeService::SerializeCodeObject(AsyncJobHandler::SerializationJobData *Data) {
+    auto Entry = Data->CodeRegionIterator->second.get();
+
+    // Fails if the region is still being loaded or is being removed, either way the job is dropped.
+    std::shared_lock lk {Entry->NamedJobRefCountMutex, std::try_to_lock};
+    if (!lk.owns_lock() || !Entry->StillSerializing) {
+      return;
+    }
+
+    const uint64_t GuestRIPOffset = Data->GuestRIP - Entry->Base;
+
+    const uint32_t Flags = Data->TSOEnabled ? CodeSerializationData::FLAG_TSO : 0;
+
+    // Multiple threads can compile the same block, only write it once per set of flags
+    if (!Entry->WrittenSections.insert((GuestRIPOffset << 1) | (Flags & CodeSerializationData::FLAG_TSO)).second) {
+      return;
+    }
+
+    // Already in the file, compiled again because it was in use with gdb or its thunks weren't loaded yet.
+    // An entry compiled without TSO gets replaced once the block is compiled with it.
+    auto SectionIt = Entry->SectionLookupMap.find(GuestRIPOffset);
+    if (SectionIt != Entry->SectionLookupMap.end() &&
+        SectionIt->second->Data->GuestCodeHash == Data->GuestCodeHash &&
+        (SectionIt->second->Data->Flags & Flags) == Flags) {
+      return;
+    }
+
+    // Pack the relocations, guest RIPs become relative to the block entry
+    std::vector<uint8_t> Relocations;
+    for (auto const &Reloc : Data->Relocations) {
+      FEXCore::CPU::Relocation Serialized = Reloc;
+      size_t Size{};
+      switch (Reloc.Header.Type) {
+        case FEXCore::CPU::RelocationTypes::RELOC_NAMED_SYMBOL_LITERAL:
+          Size = sizeof(Serialized.NamedSymbolLiteral);
+          break;
+        case FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE:
+          Size = sizeof(Serialized.NamedThunkMove);
+          break;
+        case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_MOVE:
+          Serialized.GuestRIPMove.GuestRIP -= Data->GuestRIP;
+          Size = sizeof(Serialized.GuestRIPMove);
+          break;
+        case FEXCore::CPU::RelocationTypes::RELOC_GUEST_RIP_LITERAL:
+          Serialized.GuestRIPLiteral.GuestRIP -= Data->GuestRIP;
+          Size = sizeof(Serialized.GuestRIPLiteral);
+          break;
+      }
+
+      auto Bytes = reinterpret_cast<const uint8_t*>(&Serialized);
+      Relocations.insert(Relocations.end(), Bytes, Bytes + Size);
+    }
+
+    const CodeSerializationData EntryData {
+      .GuestRIPOffset = GuestRIPOffset,
+      .GuestCodeOffset = static_cast<int64_t>(Data->GuestCodeStart - Data->GuestRIP),
+      .GuestCodeLength = Data->GuestCodeLength,
+      .GuestCodeHash = Data->GuestCodeHash,
+      .HostCodeLength = Data->HostCode.size(),
+      .HostCodeHash = XXH3_64bits(Data->HostCode.data(), Data->HostCode.size()),
+      .NumRelocations = static_cast<uint32_t>(Data->Relocations.size()),
+      .RelocationsSize = static_cast<uint32_t>(Relocations.size()),
+      .HostCodeAlignment = static_cast<uint32_t>(reinterpret_cast<uint64_t>(Data->HostCodeBegin) & (CodeSerializationData::ENTRY_ALIGNMENT - 1)),
+      .Flags = Flags,
+    };
+
+    static const std::array<uint8_t, CodeSerializationData::ENTRY_ALIGNMENT> Padding{};
+    struct iovec iov[] = {
+      { const_cast<CodeSerializationData*>(&EntryData), sizeof(EntryData) },
+      { Data->HostCode.data(), Data->HostCode.size() },
+      { const_cast<uint8_t*>(Padding.data()), CodeSerializationData::AlignUp(Data->HostCode.size()) - Data->HostCode.size() },
+      { Relocations.data(), Relocations.size() },
+      { const_cast<uint8_t*>(Padding.data()), CodeSerializationData::AlignUp(Relocations.size()) - Relocations.size() },
+    };
+    const ssize_t EntrySize = EntryData.GetEntrySize();
+
+    // Other processes are appending to the same file
+    const int FD = Entry->CurrentSerializedFD;
+    flock(FD, LOCK_EX);
+
+    bool Success {};
+    struct stat Stat{};
+    if (fstat(FD, &Stat) == 0) {
+      CodeObjectSerializationHeader Header{};
+      off_t Offset = Stat.st_size;
+      if (static_cast<size_t>(Offset) < sizeof(Header)) {
+        // New file, this process writes the header
+        Header = Entry->EntryHeader;
+        Offset = sizeof(Header);
+        Success = true;
+      }
+      else {
+        Success = pread(FD, &Header, sizeof(Header), 0) == sizeof(Header) &&
+                  Header.Config == NamedRegionHandler.GetDefaultSerializationConfig();
+      }
+
+      if (Success) {
+        Header.TotalCodeSize += EntryData.HostCodeLength;
+        ++Header.NumCodeEntries;
+        Header.TotalRelocationsCount += EntryData.NumRelocations;
+
+        Success = pwritev(FD, iov, std::size(iov), Offset) == EntrySize &&
+                  pwrite(FD, &Header, sizeof(Header), 0) == sizeof(Header);
+      }
+    }
+
+    flock(FD, LOCK_UN);
+
+    if (!Success) {
+      // Something is wrong with the file, stop appending to it
+      LogMan::Msg::DFmt("ObjectCache: Couldn't append to {}", Entry->ObjectEntrySourceFilename);
+      Entry->StillSerializing = false;
+    }
   }
 
   void CodeObjectSerializeService::ExecutionThread() {
@@ -70,12 +278,20 @@ namespace FEXCore::CodeSerialize {
       // Handle named region async jobs first. Highest priority
       NamedRegionHandler.HandleNamedRegionObjectJobs();
 
-      // XXX: Handle code serialization jobs second.
+      // Handle code serialization jobs second.
+      HandleSerializationJobs();
     }
 
+    // Finish anything that was still queued, threads waiting on their job queue need it
+    NamedRegionHandler.HandleNamedRegionObjectJobs();
+    HandleSerializationJobs();
+
     // Do final code region closures on thread shutdown
     for (auto &it : AddressToEntryMap) {
       DoCodeRegionClosure(it.first, it.second.get());
+      if (it.second->CodeData) {
+        FEXCore::Allocator::munmap(it.second->CodeData, it.second->FileSize);
+      }
     }
 
     // Safely clear our maps now
@@ -7,18 +7,74 @@
 #include <FEXCore/Utils/Event.h>
 #include <FEXCore/Utils/Threads.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <tsl/robin_map.h>
 
 namespace FEXCore::CodeSerialize {
   // XXX: Does this need to be signal safe?
   using CodeSerializationMutex = std::shared_mutex;
+
+  /**
+   * @brief Header for a single code entry inside of an object cache file
+   *
+   * Each entry is laid out as this header, the host code, then the serialized relocations.
+   * Every part starts aligned to `ENTRY_ALIGNMENT`.
+   */
   struct CodeSerializationData {
+    constexpr static size_t ENTRY_ALIGNMENT = 16;
+
+    enum EntryFlags : uint32_t {
+      // Memory accesses were compiled with TSO ordering
+      // Without it the entry is only safe to run while TSO isn't in effect
+      FLAG_TSO = (1U << 0),
+    };
+
+    // Guest RIP of the entry, relative to the base of the named region
+    uint64_t GuestRIPOffset;
+    // Start of the guest code the entry was compiled from, relative to the guest RIP
+    int64_t GuestCodeOffset;
+    // Length of the guest code the entry was compiled from
+    uint64_t GuestCodeLength;
+    // Hash of the guest code, checked against guest memory before the entry is used
+    uint64_t GuestCodeHash;
+    // Length of the host code
+    uint64_t HostCodeLength;
+    // Hash of the host code before relocation, catches file corruption
+    uint64_t HostCodeHash;
+    // Number of relocations and the size they take in the file
+    uint32_t NumRelocations;
+    uint32_t RelocationsSize;
+    // Alignment of the host code when it was originally emitted
+    // Literals in the code keep their alignment when the code is relocated
+    uint32_t HostCodeAlignment;
+    // EntryFlags
+    uint32_t Flags;
+
+    size_t GetHostCodeOffset() const {
+      return sizeof(CodeSerializationData);
+    }
+
+    size_t GetRelocationsOffset() const {
+      return GetHostCodeOffset() + AlignUp(HostCodeLength);
+    }
+
+    size_t GetEntrySize() const {
+      return GetRelocationsOffset() + AlignUp(RelocationsSize);
+    }
+
+    static size_t AlignUp(size_t Size) {
+      return (Size + ENTRY_ALIGNMENT - 1) & ~(ENTRY_ALIGNMENT - 1);
+    }
   };
+  static_assert(sizeof(CodeSerializationData) % CodeSerializationData::ENTRY_ALIGNMENT == 0, "Entry header needs to keep code aligned");
 
   struct CodeObjectFileSection {
     bool Serialized;
@@ -51,6 +107,7 @@ namespace FEXCore::CodeSerialize {
     // Total relocations in this file
     uint64_t TotalRelocationsCount{};
   };
+  static_assert(sizeof(CodeObjectSerializationHeader) % CodeSerializationData::ENTRY_ALIGNMENT == 0, "Header needs to keep entries aligned");
 
   struct CodeRegionEntry {
     /**
@@ -111,6 +168,10 @@ namespace FEXCore::CodeSerialize {
       // This per section map takes the most time to load and needs to be quick
       // This is the map of all code segments for this entry
       tsl::robin_map<uint64_t, CodeObjectFileSection*> SectionLookupMap{};
+
+      // Sections this process has appended to the file, only touched by the async thread
+      // Keyed by the guest RIP offset shifted left by one, with FLAG_TSO in the low bit
+      std::unordered_set<uint64_t> WrittenSections{};
     /**  @} */
 
     // Default initialization
@@ -144,13 +205,14 @@ namespace FEXCore::CodeSerialize {
        */
       struct SerializationJobData {
         uint64_t GuestRIP;        ///< The RIP for the guest
-        // XXX: Support multiblock
+        uint64_t GuestCodeStart;  ///< Lowest guest address the block was decoded from, differs from GuestRIP with multiblock
         uint64_t GuestCodeLength; ///< The Guest's code length
         uint64_t GuestCodeHash;   ///< Hash of the guest code
 
         void *HostCodeBegin;      ///< Host JIT code starting memory address
         size_t HostCodeLength;    ///< Host JIT code length
         uint64_t HostCodeHash;    ///< Host JIT code hash before any backpatching
+        bool TSOEnabled;          ///< TSO was in effect when the block was compiled
 
         // This is the thread specific ref counter for outstanding jobs.
         // This shared mutex is incremented when the job is added, then decremented when the job is complete.
@@ -173,6 +235,10 @@ namespace FEXCore::CodeSerialize {
           // This is the code region iterator to reduce the number of map lookups
           // This will remain valid while jobs are outstanding for this region
           CodeRegionMapType::iterator CodeRegionIterator;
+
+          // Copy of the host code taken when the job is added.
+          // Block linking backpatches the code once it starts executing.
+          std::vector<uint8_t> HostCode;
         /**  @} */
       };
 
@@ -304,7 +370,9 @@ namespace FEXCore::CodeSerialize {
 
     private:
       // Code version. If the code emission changes then this needs to increment
-      constexpr static uint32_t CODE_VERSION = 0x0;
+      constexpr static uint32_t CODE_VERSION = 0x2;
+
+      FEXCore::Context::Context *CTX;
 
       // Default cookie header for the file header
       constexpr static uint64_t CODE_COOKIE = FEXCore::IR::COOKIE_VERSION("FEXC", CODE_VERSION);
@@ -328,6 +396,20 @@ namespace FEXCore::CodeSerialize {
        * @{ */
         void AddNamedRegionObject(CodeRegionMapType::iterator Entry, const std::string &base_filename, const std::string &filename, bool Executable);
         void RemoveNamedRegionObject(uintptr_t Base, uintptr_t Size, std::unique_ptr<CodeRegionEntry> Entry);
+
+        /**
+         * @brief Maps the object cache file for an entry and builds its section lookup map
+         *
+         * @return false if the file doesn't exist or doesn't match our configuration
+         */
+        bool LoadObjectCacheFile(CodeRegionEntry *Entry);
+
+        /**
+         * @brief Filename of the object cache file backing a named region
+         *
+         * Mappings of the same file at different offsets are different code regions
+         */
+        std::string GetObjectCacheFilename(CodeRegionEntry const *Entry, const std::string &base_filename) const;
       /**  @} */
   };
 
@@ -429,7 +511,7 @@ namespace FEXCore::CodeSerialize {
       void DoCodeRegionClosure(uint64_t Base, CodeRegionEntry *it);
 
       CodeSerializationMutex &GetEntryMapMutex() { return EntryMapMutex; }
-      CodeSerializationMutex &GetUnrelocatedEntryMapMutex() { return EntryMapMutex; }
+      CodeSerializationMutex &GetUnrelocatedEntryMapMutex() { return UnrelocatedEntryMapMutex; }
 
       CodeRegionMapType &GetEntryMap() { return AddressToEntryMap; }
       CodeRegionPtrMapType &GetUnrelocatedEntryMap() { return UnrelocatedAddressToEntryMap; }
@@ -439,9 +521,49 @@ namespace FEXCore::CodeSerialize {
        */
       void NotifyWork() { WorkAvailable.NotifyOne(); }
 
+      /**
+       * @brief Adds a code serialization work item to the queue
+       *
+       * The job must already hold its references on the thread and code region
+       */
+      void AsyncAddSerializationWorkItem(std::unique_ptr<AsyncJobHandler::SerializationJobData> Data) {
+        std::unique_lock lk {SerializationWorkQueueMutex};
+        SerializationWorkQueue.emplace(std::move(Data));
+        ++SerializationWorkQueueJobs;
+      }
+
+      /**
+       * @brief Finds the named code region containing an address
+       *
+       * EntryMapMutex must be held.
+       *
+       * @return The region or the end of the entry map
+       */
+      CodeRegionMapType::iterator FindCodeRegion(uint64_t Address);
+
     private:
       FEXCore::Context::Context *CTX;
 
+      /**
+       * @name Code serialization job handling
+       * @{ */
+        void HandleSerializationJobs();
+
+        /**
+         * @brief Appends a single code object to the object cache file of its region
+         */
+        void SerializeCodeObject(AsyncJobHandler::SerializationJobData *Data);
+
+        // Atomic counter for number of jobs in the queue without needing to pull the mutex to check
+        std::atomic<uint64_t> SerializationWorkQueueJobs{};
+
+        // Mutex for adding new jobs to the work queue
+        std::mutex SerializationWorkQueueMutex{};
+
+        // Jobs get consumed as a FIFO
+        std::queue<std::unique_ptr<AsyncJobHandler::SerializationJobData>> SerializationWorkQueue{};
+      /**  @} */
+
       Event WorkAvailable{};
       std::unique_ptr<FEXCore::Threads::Thread> WorkerThread;
       std::atomic_bool WorkerThreadShuttingDown {false};
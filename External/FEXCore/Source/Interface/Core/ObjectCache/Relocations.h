@@ -18,6 +18,10 @@ namespace FEXCore::CPU {
     // 64-bit mov on x86-64
     // Aligned to struct RelocGuestRIPMove
     RELOC_GUEST_RIP_MOVE,
+
+    // 8 byte literal in memory for a guest RIP
+    // Aligned to struct RelocGuestRIPLiteral
+    RELOC_GUEST_RIP_LITERAL,
   };
 
   struct RelocationTypeHeader final {
@@ -62,6 +66,18 @@ namespace FEXCore::CPU {
     uint64_t Offset{};
 
     // The unrelocated RIP that is being moved
+    // Once serialized this is relative to the RIP of the block entry
+    uint64_t GuestRIP;
+  };
+
+  struct RelocGuestRIPLiteral final {
+    RelocationTypeHeader Header{};
+
+    // Offset in to the code section to begin the relocation
+    uint64_t Offset{};
+
+    // The unrelocated RIP that is being placed
+    // Once serialized this is relative to the RIP of the block entry
     uint64_t GuestRIP;
   };
 
@@ -74,5 +90,7 @@ namespace FEXCore::CPU {
     RelocNamedThunkMove NamedThunkMove;
 
     RelocGuestRIPMove GuestRIPMove;
+
+    RelocGuestRIPLiteral GuestRIPLiteral;
   };
 }
@@ -27,6 +27,18 @@ $end_info$
 
 namespace FEXCore::IR {
 
+// Host features and guest modes that a dispatch handler depends on
+namespace DispatchRequirement {
+  constexpr uint8_t NONE         = 0;
+  constexpr uint8_t MODE_64BIT   = (1U << 0);
+  constexpr uint8_t CRC          = (1U << 1);
+  constexpr uint8_t AES          = (1U << 2);
+  constexpr uint8_t CLZERO       = (1U << 3);
+  constexpr uint8_t RAND         = (1U << 4);
+  constexpr uint8_t AVX          = (1U << 5);
+  constexpr uint8_t PMULL_128BIT = (1U << 6);
+}
+
 using X86Tables::OpToIndex;
 
 #define OpcodeArgs [[maybe_unused]] FEXCore::X86Tables::DecodedOp Op
@@ -4989,7 +5001,7 @@ OrderedNode *OpDispatchBuilder::LoadSource_WithOpSize(FEXCore::IR::RegisterClass
     Src = _LoadRegister(false, offsetof(FEXCore::Core::CPUState, gregs[Operand.Data.GPR.GPR]), GPRClass, GPRFixedClass, GPRSize);
 
     LoadableType = true;
-    if (Operand.Data.GPR.GPR == FEXCore::X86State::REG_RSP && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+    if (IsThreadPrivateStackAccess(Operand.Data.GPR.GPR, false) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
       AccessType = MemoryAccessType::ACCESS_NONTSO;
     }
   }
@@ -5001,7 +5013,7 @@ OrderedNode *OpDispatchBuilder::LoadSource_WithOpSize(FEXCore::IR::RegisterClass
     Src = _Add(GPR, Constant);
 
     LoadableType = true;
-    if (Operand.Data.GPRIndirect.GPR == FEXCore::X86State::REG_RSP && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+    if (IsThreadPrivateStackAccess(Operand.Data.GPRIndirect.GPR, false) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
       AccessType = MemoryAccessType::ACCESS_NONTSO;
     }
   }
@@ -5040,7 +5052,7 @@ OrderedNode *OpDispatchBuilder::LoadSource_WithOpSize(FEXCore::IR::RegisterClass
         Tmp = GPR;
       }
 
-      if (Operand.Data.SIB.Base == FEXCore::X86State::REG_RSP && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+      if (IsThreadPrivateStackAccess(Operand.Data.SIB.Base, false) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
         AccessType = MemoryAccessType::ACCESS_NONTSO;
       }
     }
@@ -5233,7 +5245,7 @@ void OpDispatchBuilder::StoreResult_WithOpSize(FEXCore::IR::RegisterClassType Cl
   else if (Operand.IsGPRDirect()) {
     MemStoreDst = _LoadRegister(false, offsetof(FEXCore::Core::CPUState, gregs[Operand.Data.GPR.GPR]), GPRClass, GPRFixedClass, GPRSize);
     MemStore = true;
-    if (Operand.Data.GPR.GPR == FEXCore::X86State::REG_RSP && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+    if (IsThreadPrivateStackAccess(Operand.Data.GPR.GPR, true) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
       AccessType = MemoryAccessType::ACCESS_NONTSO;
     }
   }
@@ -5243,7 +5255,7 @@ void OpDispatchBuilder::StoreResult_WithOpSize(FEXCore::IR::RegisterClassType Cl
 
     MemStoreDst = _Add(GPR, Constant);
     MemStore = true;
-    if (Operand.Data.GPRIndirect.GPR == FEXCore::X86State::REG_RSP && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+    if (IsThreadPrivateStackAccess(Operand.Data.GPRIndirect.GPR, true) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
       AccessType = MemoryAccessType::ACCESS_NONTSO;
     }
   }
@@ -5277,6 +5289,10 @@ void OpDispatchBuilder::StoreResult_WithOpSize(FEXCore::IR::RegisterClassType Cl
       else {
         Tmp = GPR;
       }
+
+      if (IsThreadPrivateStackAccess(Operand.Data.SIB.Base, true) && AccessType == MemoryAccessType::ACCESS_DEFAULT) {
+        AccessType = MemoryAccessType::ACCESS_NONTSO;
+      }
     }
 
     if (Operand.Data.SIB.Offset) {
@@ -5337,7 +5353,20 @@ OpDispatchBuilder::OpDispatchBuilder(FEXCore::Context::Context *ctx)
   : IREmitter {ctx->OpDispatcherAllocator}
   , CTX {ctx} {
   ResetWorkingList();
-  InstallHostSpecificOpcodeHandlers();
+
+  // Handlers that depend on the host or the guest mode are filtered on lookup
+  DispatchRequirementMask =
+    (CTX->Config.Is64BitMode ? DispatchRequirement::MODE_64BIT : 0) |
+    (CTX->HostFeatures.SupportsCRC ? DispatchRequirement::CRC : 0) |
+    (CTX->HostFeatures.SupportsAES ? DispatchRequirement::AES : 0) |
+    (CTX->HostFeatures.SupportsCLZERO ? DispatchRequirement::CLZERO : 0) |
+    (CTX->HostFeatures.SupportsRAND ? DispatchRequirement::RAND : 0) |
+    (CTX->HostFeatures.SupportsAVX ? DispatchRequirement::AVX : 0) |
+    (CTX->HostFeatures.SupportsPMULL_128Bit ? DispatchRequirement::PMULL_128BIT : 0);
+
+  if (CTX->Config.x87ReducedPrecision) {
+    X87DispatchOffset = X86Tables::DispatchIndex::X87_F64_OPS - X86Tables::DispatchIndex::X87_OPS;
+  }
 }
 OpDispatchBuilder::OpDispatchBuilder(FEXCore::Utils::IntrusivePooledAllocator &Allocator)
   : IREmitter {Allocator}
@@ -5728,12 +5757,79 @@ void OpDispatchBuilder::InvalidOp(OpcodeArgs) {
 #undef OpcodeArgs
 
 
-void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
-  static bool Initialized = false;
-  if (!CTX || Initialized) {
-    // IRCompaction doesn't set a CTX and doesn't need this anyway
-    return;
+namespace {
+struct DispatchHandler {
+  X86Tables::OpDispatchPtr Handler;
+  // DispatchRequirement flags that need to be met for the handler to be used
+  uint8_t Requirements;
+};
+
+// Only called while generating the dispatch tables, this is intentionally never defined.
+// Reaching it turns a duplicate handler in to a build failure.
+void DuplicateDispatchEntry();
+
+/**
+ * @brief Maps every X86InstInfo::DispatchIndex to a handler
+ *
+ * Slots holds an index in to Handlers for every DispatchIndex, slot zero being the empty handler.
+ * Handlers that depend on the host or guest mode are installed unconditionally and filtered with their
+ * requirements at lookup, so the tables can be generated once at compile time.
+ */
+template<size_t MaxHandlers>
+struct DispatchTables {
+  std::array<uint16_t, X86Tables::DispatchIndex::MAX> Slots{};
+  std::array<DispatchHandler, MaxHandlers> Handlers{};
+  size_t NumHandlers{1};
+
+  template<typename OpcodeType, size_t TableSize>
+  consteval void Install(uint32_t DispatchBase, std::tuple<OpcodeType, uint8_t, X86Tables::OpDispatchPtr> const (&LocalTable)[TableSize], uint8_t Requirements = DispatchRequirement::NONE) {
+    for (auto const &Op : LocalTable) {
+      const uint16_t Slot = AllocateHandler(std::get<2>(Op), Requirements);
+      const uint32_t OpNum = std::get<0>(Op);
+      for (uint32_t i = 0; i < std::get<1>(Op); ++i) {
+        SetSlot(DispatchBase + OpNum + i, Slot);
+      }
+    }
+  }
+
+  template<size_t TableSize>
+  consteval void InstallX87(uint32_t DispatchBase, std::tuple<uint16_t, uint8_t, X86Tables::OpDispatchPtr> const (&LocalTable)[TableSize]) {
+    for (auto const &Op : LocalTable) {
+      const uint16_t Slot = AllocateHandler(std::get<2>(Op), DispatchRequirement::NONE);
+      uint32_t OpNum = std::get<0>(Op);
+      const bool Repeat = (OpNum & 0x8000) != 0;
+      OpNum = OpNum & 0x7FF;
+      for (uint32_t i = 0; i < std::get<1>(Op); ++i) {
+        SetSlot(DispatchBase + OpNum + i, Slot);
+
+        // Flag to indicate if we need to repeat this op in {0x40, 0x80} ranges
+        if (Repeat) {
+          Slots[DispatchBase + (OpNum | 0x40) + i] = Slot;
+          Slots[DispatchBase + (OpNum | 0x80) + i] = Slot;
+        }
+      }
+    }
+  }
+
+private:
+  consteval uint16_t AllocateHandler(X86Tables::OpDispatchPtr Handler, uint8_t Requirements) {
+    // The sizing pass only counts the handlers
+    if (NumHandlers < MaxHandlers) {
+      Handlers[NumHandlers] = {Handler, Requirements};
+    }
+    return NumHandlers++;
+  }
+
+  consteval void SetSlot(uint32_t Index, uint16_t Slot) {
+    if (Slots[Index] != 0) {
+      DuplicateDispatchEntry();
+    }
+    Slots[Index] = Slot;
   }
+};
+
+template<size_t MaxHandlers>
+consteval void InstallHostSpecificOpcodeHandlers(DispatchTables<MaxHandlers> &Tables) {
 #define OPD(prefix, opcode) (((prefix) << 8) | opcode)
   constexpr uint16_t PF_38_NONE = 0;
   constexpr uint16_t PF_38_66   = (1U << 0);
@@ -5803,7 +5899,7 @@ void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
   };
 
 #define OPD(map_select, pp, opcode) (((map_select - 1) << 10) | (pp << 8) | (opcode))
-  static constexpr std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> AVXTable[] = {
+  constexpr std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> AVXTable[] = {
     {OPD(1, 0b00, 0x10), 1, &OpDispatchBuilder::VMOVUPS_VMOVUPD_Op},
     {OPD(1, 0b01, 0x10), 1, &OpDispatchBuilder::VMOVUPS_VMOVUPD_Op},
     {OPD(1, 0b00, 0x11), 1, &OpDispatchBuilder::VMOVUPS_VMOVUPD_Op},
@@ -6099,7 +6195,7 @@ void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
 #undef OPD
 
 #define OPD(group, pp, opcode) (((group - X86Tables::TYPE_VEX_GROUP_12) << 4) | (pp << 3) | (opcode))
-  static constexpr std::tuple<uint8_t, uint8_t, X86Tables::OpDispatchPtr> VEXTableGroupOps[] {
+  constexpr std::tuple<uint8_t, uint8_t, X86Tables::OpDispatchPtr> VEXTableGroupOps[] {
     {OPD(X86Tables::TYPE_VEX_GROUP_12, 1, 0b010), 1, &OpDispatchBuilder::VPSRLIOp<2>},
     {OPD(X86Tables::TYPE_VEX_GROUP_12, 1, 0b110), 1, &OpDispatchBuilder::VPSLLIOp<2>},
     {OPD(X86Tables::TYPE_VEX_GROUP_12, 1, 0b100), 1, &OpDispatchBuilder::VPSRAIOp<2>},
@@ -6118,49 +6214,21 @@ void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
   };
 #undef OPD
 
-  auto InstallToTable = [](auto& FinalTable, auto& LocalTable) {
-    for (auto Op : LocalTable) {
-      auto OpNum = std::get<0>(Op);
-      auto Dispatcher = std::get<2>(Op);
-      for (uint8_t i = 0; i < std::get<1>(Op); ++i) {
-        LOGMAN_THROW_A_FMT(FinalTable[OpNum + i].OpcodeDispatcher == nullptr, "Duplicate Entry");
-        FinalTable[OpNum + i].OpcodeDispatcher = Dispatcher;
-      }
-    }
-  };
-
-  if (CTX->HostFeatures.SupportsCRC) {
-    InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_CRC);
-  }
-
-  InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_SHA);
-
-  if (CTX->HostFeatures.SupportsAES) {
-    InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_AES);
-    InstallToTable(FEXCore::X86Tables::H0F3ATableOps, H0F3A_AES);
-  }
-
-  if (CTX->HostFeatures.SupportsCLZERO) {
-    InstallToTable(FEXCore::X86Tables::SecondModRMTableOps, SecondaryModRMExtensionOp_CLZero);
-  }
-
-  if (CTX->HostFeatures.SupportsRAND) {
-    InstallToTable(FEXCore::X86Tables::SecondInstGroupOps, SecondaryExtensionOp_RDRAND);
-  }
-
-  if (CTX->HostFeatures.SupportsAVX) {
-    InstallToTable(FEXCore::X86Tables::VEXTableOps, AVXTable);
-    InstallToTable(FEXCore::X86Tables::VEXTableGroupOps, VEXTableGroupOps);
-  }
-
-  if (CTX->HostFeatures.SupportsPMULL_128Bit) {
-    InstallToTable(FEXCore::X86Tables::H0F3ATableOps, H0F3A_PCLMUL);
-    InstallToTable(FEXCore::X86Tables::VEXTableOps, VEX_PCLMUL);
-  }
-  Initialized = true;
-}
-
-void InstallOpcodeHandlers(Context::OperatingMode Mode) {
+  using namespace X86Tables;
+  Tables.Install(DispatchIndex::H0F38_TABLE_OPS, H0F38_CRC, DispatchRequirement::CRC);
+  Tables.Install(DispatchIndex::H0F38_TABLE_OPS, H0F38_SHA);
+  Tables.Install(DispatchIndex::H0F38_TABLE_OPS, H0F38_AES, DispatchRequirement::AES);
+  Tables.Install(DispatchIndex::H0F3A_TABLE_OPS, H0F3A_AES, DispatchRequirement::AES);
+  Tables.Install(DispatchIndex::SECOND_MODRM_TABLE_OPS, SecondaryModRMExtensionOp_CLZero, DispatchRequirement::CLZERO);
+  Tables.Install(DispatchIndex::SECOND_INST_GROUP_OPS, SecondaryExtensionOp_RDRAND, DispatchRequirement::RAND);
+  Tables.Install(DispatchIndex::VEX_TABLE_OPS, AVXTable, DispatchRequirement::AVX);
+  Tables.Install(DispatchIndex::VEX_TABLE_GROUP_OPS, VEXTableGroupOps, DispatchRequirement::AVX);
+  Tables.Install(DispatchIndex::H0F3A_TABLE_OPS, H0F3A_PCLMUL, DispatchRequirement::PMULL_128BIT);
+  Tables.Install(DispatchIndex::VEX_TABLE_OPS, VEX_PCLMUL, DispatchRequirement::PMULL_128BIT);
+}
+
+template<size_t MaxHandlers>
+consteval void InstallOpcodeHandlers(DispatchTables<MaxHandlers> &Tables) {
   constexpr std::tuple<uint8_t, uint8_t, X86Tables::OpDispatchPtr> BaseOpTable[] = {
     // Instructions
     {0x00, 6, &OpDispatchBuilder::ALUOp},
@@ -7387,7 +7455,7 @@ constexpr uint16_t PF_F2 = 3;
 
 #undef OPD
 
-  static constexpr std::tuple<uint8_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> DDDNowTable[] = {
+  constexpr std::tuple<uint8_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> DDDNowTable[] = {
     {0x0C, 1, &OpDispatchBuilder::PI2FWOp},
     {0x0D, 1, &OpDispatchBuilder::Vector_CVT_Int_To_Float<4, false>},
     {0x1C, 1, &OpDispatchBuilder::PF2IWOp},
@@ -7427,7 +7495,7 @@ constexpr uint16_t PF_F2 = 3;
   };
 
 #define OPD(map_select, pp, opcode) (((map_select - 1) << 10) | (pp << 8) | (opcode))
-  static constexpr std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> BMITable[] = {
+  constexpr std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr> BMITable[] = {
     {OPD(2, 0b00, 0xF2), 1, &OpDispatchBuilder::ANDNBMIOp},
     {OPD(2, 0b00, 0xF5), 1, &OpDispatchBuilder::BZHI},
     {OPD(2, 0b10, 0xF5), 1, &OpDispatchBuilder::PEXT},
@@ -7456,71 +7524,67 @@ constexpr uint16_t PF_F2 = 3;
     {0x7F, 1, &OpDispatchBuilder::UnimplementedOp},
   };
 
-  auto InstallToTable = [](auto& FinalTable, auto& LocalTable) {
-    for (auto Op : LocalTable) {
-      auto OpNum = std::get<0>(Op);
-      auto Dispatcher = std::get<2>(Op);
-      for (uint8_t i = 0; i < std::get<1>(Op); ++i) {
-        LOGMAN_THROW_A_FMT(FinalTable[OpNum + i].OpcodeDispatcher == nullptr, "Duplicate Entry");
-        FinalTable[OpNum + i].OpcodeDispatcher = Dispatcher;
-      }
-    }
-  };
-  auto InstallToX87Table = [](auto& FinalTable, auto& LocalTable) {
-    for (auto Op : LocalTable) {
-      auto OpNum = std::get<0>(Op);
-      bool Repeat = (OpNum & 0x8000) != 0;
-      OpNum = OpNum & 0x7FF;
-      auto Dispatcher = std::get<2>(Op);
-      for (uint8_t i = 0; i < std::get<1>(Op); ++i) {
-        LOGMAN_THROW_A_FMT(FinalTable[OpNum + i].OpcodeDispatcher == nullptr, "Duplicate Entry");
-        FinalTable[OpNum + i].OpcodeDispatcher = Dispatcher;
+  using namespace X86Tables;
+  Tables.Install(DispatchIndex::BASE_OPS_32, BaseOpTable);
+  Tables.Install(DispatchIndex::BASE_OPS_32, BaseOpTable_32);
+  Tables.Install(DispatchIndex::SECOND_BASE_OPS_32, TwoByteOpTable);
+  Tables.Install(DispatchIndex::SECOND_BASE_OPS_32, TwoByteOpTable_32);
 
-        // Flag to indicate if we need to repeat this op in {0x40, 0x80} ranges
-        if (Repeat) {
-          FinalTable[(OpNum | 0x40) + i].OpcodeDispatcher = Dispatcher;
-          FinalTable[(OpNum | 0x80) + i].OpcodeDispatcher = Dispatcher;
-        }
-      }
-    }
-  };
+  Tables.Install(DispatchIndex::BASE_OPS_64, BaseOpTable);
+  Tables.Install(DispatchIndex::BASE_OPS_64, BaseOpTable_64);
+  Tables.Install(DispatchIndex::SECOND_BASE_OPS_64, TwoByteOpTable);
+  Tables.Install(DispatchIndex::SECOND_BASE_OPS_64, TwoByteOpTable_64);
 
-  InstallToTable(FEXCore::X86Tables::BaseOps, BaseOpTable);
-  if (Mode == Context::MODE_32BIT) {
-    InstallToTable(FEXCore::X86Tables::BaseOps, BaseOpTable_32);
-    InstallToTable(FEXCore::X86Tables::SecondBaseOps, TwoByteOpTable_32);
-  }
-  else {
-    InstallToTable(FEXCore::X86Tables::BaseOps, BaseOpTable_64);
-    InstallToTable(FEXCore::X86Tables::SecondBaseOps, TwoByteOpTable_64);
-  }
+  Tables.Install(DispatchIndex::PRIMARY_INST_GROUP_OPS, PrimaryGroupOpTable);
 
-  InstallToTable(FEXCore::X86Tables::SecondBaseOps, TwoByteOpTable);
-  InstallToTable(FEXCore::X86Tables::PrimaryInstGroupOps, PrimaryGroupOpTable);
+  Tables.Install(DispatchIndex::REP_MOD_OPS, RepModOpTable);
+  Tables.Install(DispatchIndex::REPNE_MOD_OPS, RepNEModOpTable);
+  Tables.Install(DispatchIndex::OPSIZE_MOD_OPS, OpSizeModOpTable);
+  Tables.Install(DispatchIndex::SECOND_INST_GROUP_OPS, SecondaryExtensionOpTable);
+  Tables.Install(DispatchIndex::SECOND_INST_GROUP_OPS, SecondaryExtensionOpTable_64, DispatchRequirement::MODE_64BIT);
 
-  InstallToTable(FEXCore::X86Tables::RepModOps, RepModOpTable);
-  InstallToTable(FEXCore::X86Tables::RepNEModOps, RepNEModOpTable);
-  InstallToTable(FEXCore::X86Tables::OpSizeModOps, OpSizeModOpTable);
-  InstallToTable(FEXCore::X86Tables::SecondInstGroupOps, SecondaryExtensionOpTable);
-  if (Mode == Context::MODE_64BIT) {
-    InstallToTable(FEXCore::X86Tables::SecondInstGroupOps, SecondaryExtensionOpTable_64);
-  }
+  Tables.Install(DispatchIndex::SECOND_MODRM_TABLE_OPS, SecondaryModRMExtensionOpTable);
 
-  InstallToTable(FEXCore::X86Tables::SecondModRMTableOps, SecondaryModRMExtensionOpTable);
+  Tables.InstallX87(DispatchIndex::X87_OPS, X87OpTable);
+  Tables.InstallX87(DispatchIndex::X87_F64_OPS, X87F64OpTable);
 
-  FEX_CONFIG_OPT(ReducedPrecision, X87REDUCEDPRECISION);
-  if(ReducedPrecision) {
-    InstallToX87Table(FEXCore::X86Tables::X87Ops, X87F64OpTable);
-  } else {
-    InstallToX87Table(FEXCore::X86Tables::X87Ops, X87OpTable);
+  Tables.Install(DispatchIndex::H0F38_TABLE_OPS, H0F38Table);
+  Tables.Install(DispatchIndex::H0F3A_TABLE_OPS, H0F3ATable);
+  Tables.Install(DispatchIndex::DDDNOW_OPS, DDDNowTable);
+  Tables.Install(DispatchIndex::VEX_TABLE_OPS, BMITable);
+  Tables.Install(DispatchIndex::VEX_TABLE_GROUP_OPS, VEXGroupTable);
+  Tables.Install(DispatchIndex::EVEX_TABLE_OPS, EVEXTable);
+}
+
+template<size_t MaxHandlers>
+consteval DispatchTables<MaxHandlers> GenerateDispatchTables() {
+  DispatchTables<MaxHandlers> Tables{};
+  InstallHostSpecificOpcodeHandlers(Tables);
+  InstallOpcodeHandlers(Tables);
+  return Tables;
+}
+
+// Sized in two passes so the handler array doesn't carry any unused entries
+constexpr size_t MAX_DISPATCH_HANDLERS = 4096;
+constexpr size_t NumDispatchHandlers = GenerateDispatchTables<MAX_DISPATCH_HANDLERS>().NumHandlers;
+static_assert(NumDispatchHandlers <= MAX_DISPATCH_HANDLERS, "Too many dispatch handlers");
+static_assert(NumDispatchHandlers <= UINT16_MAX, "Dispatch slots can't address every handler");
+
+constexpr DispatchTables<NumDispatchHandlers> DispatchTable = GenerateDispatchTables<NumDispatchHandlers>();
+}
+
+X86Tables::OpDispatchPtr OpDispatchBuilder::GetDispatcher(X86Tables::X86InstInfo const *Info) const {
+  uint32_t Index = Info->DispatchIndex;
+  if (Index >= X86Tables::DispatchIndex::X87_OPS && Index < X86Tables::DispatchIndex::X87_F64_OPS) {
+    Index += X87DispatchOffset;
   }
 
-  InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38Table);
-  InstallToTable(FEXCore::X86Tables::H0F3ATableOps, H0F3ATable);
-  InstallToTable(FEXCore::X86Tables::DDDNowOps, DDDNowTable);
-  InstallToTable(FEXCore::X86Tables::VEXTableOps, BMITable);
-  InstallToTable(FEXCore::X86Tables::VEXTableGroupOps, VEXGroupTable);
-  InstallToTable(FEXCore::X86Tables::EVEXTableOps, EVEXTable);
+  auto const &Handler = DispatchTable.Handlers[DispatchTable.Slots[Index]];
+  if ((Handler.Requirements & DispatchRequirementMask) != Handler.Requirements) {
+    // Not supported by this host or guest mode
+    return nullptr;
+  }
+  return Handler.Handler;
 }
 
 }
@@ -152,6 +152,13 @@ public:
   OpDispatchBuilder(FEXCore::Context::Context *ctx);
   OpDispatchBuilder(FEXCore::Utils::IntrusivePooledAllocator &Allocator);
 
+  /**
+   * @brief Returns the handler for a decoded instruction
+   *
+   * @return nullptr if the instruction has no handler or its handler isn't usable by this host or guest mode
+   */
+  X86Tables::OpDispatchPtr GetDispatcher(X86Tables::X86InstInfo const *Info) const;
+
   void ResetWorkingList();
   void ResetDecodeFailure() { NeedsBlockEnd = DecodeFailure = false; }
   bool HadDecodeFailure() const { return DecodeFailure; }
@@ -1423,6 +1430,21 @@ private:
   bool Multiblock{};
   uint64_t Entry;
 
+  /**
+   * @brief Whether an explicit memory access based off of GPR can skip TSO emulation
+   *
+   * Stack loads are assumed to be thread private. StackTSOElision extends this to stores.
+   * RBP is only a stack base with frame pointers, so it is only included with FramePointerTSOElision.
+   */
+  bool IsThreadPrivateStackAccess(uint32_t GPR, bool IsStore) const {
+    if (CTX->Config.StackTSOElision) {
+      return GPR == FEXCore::X86State::REG_RSP ||
+        (CTX->Config.FramePointerTSOElision && GPR == FEXCore::X86State::REG_RBP);
+    }
+
+    return !IsStore && GPR == FEXCore::X86State::REG_RSP;
+  }
+
   OrderedNode* _StoreMemAutoTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *Addr, OrderedNode *Value, uint8_t Align = 1) {
     if (CTX->IsTSOEnabled())
       return _StoreMemTSO(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
@@ -1437,11 +1459,12 @@ private:
       return _LoadMem(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
   }
 
-  void InstallHostSpecificOpcodeHandlers();
+  // DispatchRequirement flags met by this context
+  uint8_t DispatchRequirementMask{};
+  // Added to x87 dispatch indexes to select the reduced precision handlers
+  uint32_t X87DispatchOffset{};
 };
 
-void InstallOpcodeHandlers(Context::OperatingMode Mode);
-
 }
 template <>
 struct fmt::formatter<FEXCore::IR::OpDispatchBuilder::FlagsGenerationType> : fmt::formatter<int> {
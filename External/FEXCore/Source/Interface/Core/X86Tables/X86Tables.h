@@ -8,15 +8,12 @@ $end_info$
 #include <FEXCore/Debug/X86Tables.h>
 #include <FEXCore/Core/Context.h>
 
-#include <FEXCore/Utils/LogManager.h>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
 
 namespace FEXCore::X86Tables {
 
-#ifndef NDEBUG
-extern uint64_t Total;
-extern uint64_t NumInsts;
-#endif
-
 template <typename OpcodeType>
 struct X86TablesInfoStruct {
   OpcodeType first;
@@ -26,79 +23,93 @@ struct X86TablesInfoStruct {
 using U8U8InfoStruct = X86TablesInfoStruct<uint8_t>;
 using U16U8InfoStruct = X86TablesInfoStruct<uint16_t>;
 
+// The tables are only generated at compile time, this is intentionally never defined.
+// Reaching it while generating a table turns the bad entry in to a build failure.
+void InvalidTableEntry(char const *Reason, char const *Name);
+
 template<typename OpcodeType>
-static inline void GenerateTable(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize) {
+consteval void GenerateTable(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize, uint32_t DispatchBase) {
   for (size_t j = 0; j < TableSize; ++j) {
     X86TablesInfoStruct<OpcodeType> const &Op = LocalTable[j];
     auto OpNum = Op.first;
     X86InstInfo const &Info = Op.Info;
     for (uint32_t i = 0; i < Op.second; ++i) {
-      LOGMAN_THROW_AA_FMT(FinalTable[OpNum + i].Type == TYPE_UNKNOWN, "Duplicate Entry {}->{}", FinalTable[OpNum + i].Name, Info.Name);
+      if (FinalTable[OpNum + i].Type != TYPE_UNKNOWN) {
+        InvalidTableEntry("Duplicate Entry", Info.Name);
+      }
       FinalTable[OpNum + i] = Info;
-#ifndef NDEBUG
-      ++Total;
-      if (Info.Type == TYPE_INST)
-        NumInsts++;
-#endif
+      // Tables without any handlers leave every entry pointing at the empty slot
+      if (DispatchBase != DispatchIndex::NONE) {
+        FinalTable[OpNum + i].DispatchIndex = DispatchBase + OpNum + i;
+      }
     }
   }
 };
 
 template<typename OpcodeType>
-static inline void GenerateTableWithCopy(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize, X86InstInfo *OtherLocal) {
+consteval void GenerateTableWithCopy(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize, X86InstInfo const *OtherLocal, uint32_t DispatchBase) {
   for (size_t j = 0; j < TableSize; ++j) {
     X86TablesInfoStruct<OpcodeType> const &Op = LocalTable[j];
     auto OpNum = Op.first;
     X86InstInfo const &Info = Op.Info;
     for (uint32_t i = 0; i < Op.second; ++i) {
-      LOGMAN_THROW_AA_FMT(FinalTable[OpNum + i].Type == TYPE_UNKNOWN, "Duplicate Entry {}->{}", FinalTable[OpNum + i].Name, Info.Name);
+      if (FinalTable[OpNum + i].Type != TYPE_UNKNOWN) {
+        InvalidTableEntry("Duplicate Entry", Info.Name);
+      }
       if (Info.Type == TYPE_COPY_OTHER) {
         FinalTable[OpNum + i] = OtherLocal[OpNum + i];
       }
       else {
         FinalTable[OpNum + i] = Info;
-#ifndef NDEBUG
-        ++Total;
-        if (Info.Type == TYPE_INST)
-          NumInsts++;
-#endif
       }
+      // Copied entries still get their handler from this table
+      FinalTable[OpNum + i].DispatchIndex = DispatchBase + OpNum + i;
     }
   }
 };
 
 template<typename OpcodeType>
-static inline void GenerateX87Table(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize) {
+consteval void GenerateX87Table(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *LocalTable, size_t TableSize, uint32_t DispatchBase) {
   for (size_t j = 0; j < TableSize; ++j) {
     X86TablesInfoStruct<OpcodeType> const &Op = LocalTable[j];
     auto OpNum = Op.first;
     X86InstInfo const &Info = Op.Info;
     for (uint32_t i = 0; i < Op.second; ++i) {
-      LOGMAN_THROW_AA_FMT(FinalTable[OpNum + i].Type == TYPE_UNKNOWN, "Duplicate Entry {}->{}", FinalTable[OpNum + i].Name, Info.Name);
+      if (FinalTable[OpNum + i].Type != TYPE_UNKNOWN) {
+        InvalidTableEntry("Duplicate Entry", Info.Name);
+      }
       if ((OpNum & 0b11'000'000) == 0b11'000'000) {
         // If the mod field is 0b11 then it is a regular op
         FinalTable[OpNum + i] = Info;
+        FinalTable[OpNum + i].DispatchIndex = DispatchBase + OpNum + i;
       }
       else {
         // If the mod field is !0b11 then this instruction is duplicated through the whole mod [0b00, 0b10] range
         // and the modrm.rm space because that is used part of the instruction encoding
-        LOGMAN_THROW_AA_FMT((OpNum & 0b11'000'000) == 0, "Only support mod field of zero in this path");
+        if ((OpNum & 0b11'000'000) != 0) {
+          InvalidTableEntry("Only support mod field of zero in this path", Info.Name);
+        }
         for (uint16_t mod = 0b00'000'000; mod < 0b11'000'000; mod += 0b01'000'000) {
           for (uint16_t rm = 0b000; rm < 0b1'000; ++rm) {
             FinalTable[(OpNum | mod | rm) + i] = Info;
+            FinalTable[(OpNum | mod | rm) + i].DispatchIndex = DispatchBase + (OpNum | mod | rm) + i;
           }
         }
       }
-#ifndef NDEBUG
-        ++Total;
-        if (Info.Type == TYPE_INST)
-          NumInsts++;
-#endif
     }
   }
 };
 
-void InitializeInfoTables(Context::OperatingMode Mode);
+#ifndef NDEBUG
+template<typename OpcodeType>
+consteval void GenerateDebugTable(X86InstInfo *FinalTable, std::tuple<OpcodeType, uint8_t, X86InstDebugInfo::Flags> const *LocalTable, size_t TableSize) {
+  for (size_t j = 0; j < TableSize; ++j) {
+    auto OpNum = std::get<0>(LocalTable[j]);
+    for (uint32_t i = 0; i < std::get<1>(LocalTable[j]); ++i) {
+      FinalTable[OpNum + i].DebugInfo = std::get<2>(LocalTable[j]);
+    }
+  }
+};
+#endif
 
 }
-
@@ -19,14 +19,17 @@ $end_info$
 
 #include <Interface/Context/Context.h>
 #include "FEXCore/Core/X86Enums.h"
+#include <atomic>
+#include <deque>
 #include <malloc.h>
 #include <mutex>
 #include <unordered_map>
 #include <memory>
-#include <shared_mutex>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #ifdef ENABLE_JEMALLOC
 #include "jemalloc/jemalloc.h"
@@ -109,12 +112,113 @@ namespace FEXCore {
       }
     };
 
+    using ThunkMap = std::unordered_map<IR::SHA256Sum, ThunkedFunction*, TruncatingSHA256Hash>;
+
+    /**
+     * @brief Thunk index of a single library, immutable once published
+     *
+     * Each library load publishes one of these in front of the previous ones, nothing already published is copied or freed.
+     * Lookups walk the list, which is as long as the number of thunked libraries.
+     */
+    struct LibraryThunkIndex {
+      // Empty for the builtin thunks and AppendThunkDefinitions
+      std::string Name;
+      ThunkMap Thunks;
+      const LibraryThunkIndex *Next;
+    };
+
+    /**
+     * @brief Insert-only hash map that readers access without taking any lock
+     *
+     * Open addressing over pointers to immutable entries. Writers serialize externally, a slot is filled with a
+     * release store once its entry is complete. Growing publishes a new table holding the same entry pointers.
+     * Readers might still be probing the old table, so it is retired instead of freed. Tables double in size,
+     * so the retired ones never add up to more than the current one.
+     */
+    template<typename K, typename V, typename Hash>
+    class InsertOnlyHashMap final {
+      public:
+        InsertOnlyHashMap() {
+          Current.store(AllocateTable(INITIAL_SIZE), std::memory_order_release);
+        }
+
+        const V* Find(const K &Key) const {
+          auto Table = Current.load(std::memory_order_acquire);
+          for (size_t i = Hash{}(Key) & Table->Mask;; i = (i + 1) & Table->Mask) {
+            auto Entry = Table->Slots[i].load(std::memory_order_acquire);
+            if (!Entry) {
+              return nullptr;
+            }
+            if (Entry->first == Key) {
+              return &Entry->second;
+            }
+          }
+        }
+
+        // Caller serializes writers and makes sure Key isn't in the map yet
+        void Insert(const K &Key, V Value) {
+          auto Table = Current.load(std::memory_order_relaxed);
+          if ((Count + 1) * 2 > Table->Mask + 1) {
+            Table = Grow(Table);
+          }
+
+          auto Entry = &Entries.emplace_back(Key, std::move(Value));
+          InsertSlot(Table, Entry);
+          ++Count;
+        }
+
+      private:
+        constexpr static size_t INITIAL_SIZE = 256;
+
+        struct Table {
+          size_t Mask;
+          std::unique_ptr<std::atomic<const std::pair<K, V>*>[]> Slots;
+        };
+
+        Table *AllocateTable(size_t Size) {
+          auto NewTable = &Tables.emplace_back(Table {
+            .Mask = Size - 1,
+            .Slots = std::make_unique<std::atomic<const std::pair<K, V>*>[]>(Size),
+          });
+          for (size_t i = 0; i < Size; ++i) {
+            NewTable->Slots[i].store(nullptr, std::memory_order_relaxed);
+          }
+          return NewTable;
+        }
+
+        static void InsertSlot(Table *Table, const std::pair<K, V> *Entry) {
+          size_t i = Hash{}(Entry->first) & Table->Mask;
+          while (Table->Slots[i].load(std::memory_order_relaxed)) {
+            i = (i + 1) & Table->Mask;
+          }
+          Table->Slots[i].store(Entry, std::memory_order_release);
+        }
+
+        Table *Grow(Table *Old) {
+          auto NewTable = AllocateTable((Old->Mask + 1) * 2);
+          for (auto &Entry : Entries) {
+            InsertSlot(NewTable, &Entry);
+          }
+          Current.store(NewTable, std::memory_order_release);
+          return NewTable;
+        }
+
+        std::atomic<Table*> Current{};
+        size_t Count{};
+        // Stable addresses, entries and tables live until destruction
+        std::deque<std::pair<K, V>> Entries;
+        std::deque<Table> Tables;
+    };
+
+    using GuestcallMap = InsertOnlyHashMap<GuestcallInfo, HostToGuestTrampolinePtr*, GuestcallInfoHash>;
+
     HostToGuestTrampolinePtr* MakeHostTrampolineForGuestFunction(void* HostPacker, uintptr_t GuestTarget, uintptr_t GuestUnpacker);
 
     struct ThunkHandler_impl final: public ThunkHandler {
-        std::shared_mutex ThunksMutex;
-
-        std::unordered_map<IR::SHA256Sum, ThunkedFunction*, TruncatingSHA256Hash> Thunks = {
+        // Builtin thunks, always at the end of the ThunkIndexes list
+        const LibraryThunkIndex BuiltinThunks {
+          .Name = {},
+          .Thunks = {
             {
                 // sha256(fex:loadlib)
                 { 0x27, 0x7e, 0xb7, 0x69, 0x5b, 0xe9, 0xab, 0x12, 0x6e, 0xf7, 0x85, 0x9d, 0x4b, 0xc9, 0xa2, 0x44, 0x46, 0xcf, 0xbd, 0xb5, 0x87, 0x43, 0xef, 0x28, 0xa2, 0x65, 0xba, 0xfc, 0x89, 0x0f, 0x77, 0x80 },
@@ -140,13 +244,41 @@ namespace FEXCore {
                 { 0x9b, 0xb2, 0xf4, 0xb4, 0x83, 0x7d, 0x28, 0x93, 0x40, 0xcb, 0xf4, 0x7a, 0x0b, 0x47, 0x85, 0x87, 0xf9, 0xbc, 0xb5, 0x27, 0xca, 0xa6, 0x93, 0xa5, 0xc0, 0x73, 0x27, 0x24, 0xae, 0xc8, 0xb8, 0x5a },
                 &AllocateHostTrampolineForGuestFunction
             },
+          },
+          .Next = nullptr,
         };
 
-        // Can't be a string_view. We need to keep a copy of the library name in-case string_view pointer goes away.
-        // Ideally we track when a library has been unloaded and remove it from this set before the memory backing goes away.
-        std::set<std::string> Libs;
+        // All thunks that are registered, newest first: loaded libraries, AppendThunkDefinitions and the builtins.
+        // The index keeps a copy of the library name in-case the guest's string goes away.
+        // Ideally we track when a library has been unloaded and remove its index before the memory backing goes away.
+        std::atomic<const LibraryThunkIndex*> ThunkIndexes {&BuiltinThunks};
+        // Serializes publishing new indexes, lookups don't take it.
+        std::mutex ThunkIndexMutex;
+
+        GuestcallMap GuestcallToHostTrampoline;
+        // Serializes creation of trampolines, lookups don't take it.
+        std::mutex TrampolineMutex;
+
+        ~ThunkHandler_impl() {
+          for (auto Index = ThunkIndexes.load(std::memory_order_relaxed); Index != &BuiltinThunks;) {
+            auto Next = Index->Next;
+            delete Index;
+            Index = Next;
+          }
+        }
 
-        std::unordered_map<GuestcallInfo, HostToGuestTrampolinePtr*, GuestcallInfoHash> GuestcallToHostTrampoline;
+        // Fn fills in the new index, it is published in front of the existing ones once complete
+        template<typename F>
+        void PublishThunkIndex(std::string_view Name, F &&Fn) {
+          std::lock_guard lk(ThunkIndexMutex);
+          auto Index = new LibraryThunkIndex {
+            .Name = std::string(Name),
+            .Thunks = {},
+            .Next = ThunkIndexes.load(std::memory_order_relaxed),
+          };
+          Fn(Index->Thunks);
+          ThunkIndexes.store(Index, std::memory_order_release);
+        }
 
         uint8_t *HostTrampolineInstanceDataPtr;
         size_t HostTrampolineInstanceDataAvailable = 0;
@@ -299,18 +431,17 @@ namespace FEXCore {
 
             auto That = reinterpret_cast<ThunkHandler_impl*>(CTX->ThunkHandler.get());
 
-            {
-                std::lock_guard lk(That->ThunksMutex);
-
-                That->Libs.insert(Name);
-
-                int i;
-                for (i = 0; Exports[i].sha256; i++) {
-                    That->Thunks[*reinterpret_cast<IR::SHA256Sum*>(Exports[i].sha256)] = Exports[i].Fn;
+            // Publish the whole export table of the library as its own index.
+            // Threads compiling or executing thunks keep walking the existing ones without waiting on us.
+            // The library is seen as loaded together with its thunks.
+            size_t NumSyms{};
+            That->PublishThunkIndex(Name, [Exports, &NumSyms](ThunkMap &Thunks) {
+                for (; Exports[NumSyms].sha256; NumSyms++) {
+                    Thunks[*reinterpret_cast<IR::SHA256Sum*>(Exports[NumSyms].sha256)] = Exports[NumSyms].Fn;
                 }
+            });
 
-                LogMan::Msg::DFmt("Loaded {} syms", i);
-            }
+            LogMan::Msg::DFmt("Loaded {} syms", NumSyms);
         }
 
         static void IsLibLoaded(void* ArgsRV) {
@@ -324,23 +455,25 @@ namespace FEXCore {
             auto CTX = Thread->CTX;
             auto That = reinterpret_cast<ThunkHandler_impl*>(CTX->ThunkHandler.get());
 
-            {
-                std::shared_lock lk(That->ThunksMutex);
-                rv = That->Libs.contains(Name);
+            rv = false;
+            for (auto Index = That->ThunkIndexes.load(std::memory_order_acquire); Index; Index = Index->Next) {
+                if (!Index->Name.empty() && Index->Name == Name) {
+                    rv = true;
+                    break;
+                }
             }
         }
 
         ThunkedFunction* LookupThunk(const IR::SHA256Sum &sha256) override {
-
-            std::shared_lock lk(ThunksMutex);
-
-            auto it = Thunks.find(sha256);
-
-            if (it != Thunks.end()) {
-                return it->second;
-            } else {
-                return nullptr;
+            // Newer indexes shadow older ones, like a later library load used to overwrite the entry
+            for (auto Index = ThunkIndexes.load(std::memory_order_acquire); Index; Index = Index->Next) {
+                auto it = Index->Thunks.find(sha256);
+                if (it != Index->Thunks.end()) {
+                    return it->second;
+                }
             }
+
+            return nullptr;
         }
 
         void RegisterTLSState(FEXCore::Core::InternalThreadState *Thread) override {
@@ -348,9 +481,14 @@ namespace FEXCore {
         }
 
         void AppendThunkDefinitions(std::vector<FEXCore::IR::ThunkDefinition> const& Definitions) override {
-          for (auto & Definition : Definitions) {
-            Thunks.emplace(Definition.Sum, Definition.ThunkFunction);
-          }
+          PublishThunkIndex({}, [this, &Definitions](ThunkMap &Thunks) {
+            for (auto & Definition : Definitions) {
+              // Already registered thunks take precedence
+              if (!LookupThunk(Definition.Sum)) {
+                Thunks.emplace(Definition.Sum, Definition.ThunkFunction);
+              }
+            }
+          });
         }
     };
 
@@ -390,24 +528,16 @@ namespace FEXCore {
 
       const GuestcallInfo gci = { GuestUnpacker, GuestTarget };
 
-      // Try first with shared_lock
-      {
-        std::shared_lock lk(ThunkHandler->ThunksMutex);
-
-        auto found = ThunkHandler->GuestcallToHostTrampoline.find(gci);
-        if (found != ThunkHandler->GuestcallToHostTrampoline.end()) {
-          return found->second;
-        }
+      // Try first without any lock
+      if (auto found = ThunkHandler->GuestcallToHostTrampoline.Find(gci)) {
+        return *found;
       }
 
-      std::lock_guard lk(ThunkHandler->ThunksMutex);
+      std::lock_guard lk(ThunkHandler->TrampolineMutex);
 
-      // Retry lookup with full lock before making a new trampoline to avoid double trampolines
-      {
-        auto found = ThunkHandler->GuestcallToHostTrampoline.find(gci);
-        if (found != ThunkHandler->GuestcallToHostTrampoline.end()) {
-          return found->second;
-        }
+      // Retry lookup with the lock held before making a new trampoline to avoid double trampolines
+      if (auto found = ThunkHandler->GuestcallToHostTrampoline.Find(gci)) {
+        return *found;
       }
 
       LogMan::Msg::DFmt("Thunks: Adding host trampoline for guest function {:#x} via unpacker {:#x}",
@@ -435,7 +565,7 @@ namespace FEXCore {
           .GuestTarget = GuestTarget
       };
 
-      ThunkHandler->GuestcallToHostTrampoline[gci] = HostTrampoline;
+      ThunkHandler->GuestcallToHostTrampoline.Insert(gci, HostTrampoline);
       return HostTrampoline;
     }
 
@@ -8,25 +8,29 @@
 #include <Interface/Core/LookupCache.h>
 #include <Interface/GDBJIT/GDBJIT.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <mutex>
+#include <pthread.h>
+#include <string_view>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <unordered_set>
+#include <vector>
 #include <xxhash.h>
 
+#ifndef MADV_POPULATE_READ
+#define MADV_POPULATE_READ 22
+#endif
 
 namespace FEXCore::IR {
-  AOTIRInlineEntry *AOTIRInlineIndex::GetInlineEntry(uint64_t DataOffset) {
-    uintptr_t This = (uintptr_t)this;
-
-    return (AOTIRInlineEntry*)(This + DataBase + DataOffset);
-  }
-
-  AOTIRInlineEntry *AOTIRInlineIndex::Find(uint64_t GuestStart) {
+  AOTIRInlineIndexEntry const *AOTIRInlineIndex::Find(uint64_t GuestStart) const {
     ssize_t l = 0;
     ssize_t r = Count - 1;
 
@@ -34,7 +38,7 @@ namespace FEXCore::IR {
       size_t m = l + (r - l) / 2;
 
       if (Entries[m].GuestStart == GuestStart)
-        return GetInlineEntry(Entries[m].DataOffset);
+        return &Entries[m];
       else if (Entries[m].GuestStart < GuestStart)
         l = m + 1;
       else
@@ -44,81 +48,148 @@ namespace FEXCore::IR {
     return nullptr;
   }
 
-  IR::RegisterAllocationData *AOTIRInlineEntry::GetRAData() {
-    return (IR::RegisterAllocationData *)InlineData;
+  AOTIRAccessRange const *AOTIRInlineIndex::GetProfile() const {
+    uintptr_t This = (uintptr_t)this;
+
+    return (AOTIRAccessRange const*)(This + ProfileBase);
+  }
+
+  AOTIRPoolView AOTIRInlineIndex::GetPool() const {
+    uintptr_t This = (uintptr_t)this;
+    auto Offsets = (uint32_t const*)(This + PoolBase);
+
+    return AOTIRPoolView {
+      .Offsets = Offsets,
+      .Count = PoolCount,
+      .Data = (uint8_t const*)&Offsets[PoolCount + 1],
+      .DataSize = PoolSize,
+    };
   }
 
-  IR::IRListView *AOTIRInlineEntry::GetIRData() {
-    auto RAData = GetRAData();
-    auto Offset = RAData->Size(RAData->MapCount);
+  bool AOTIRInlineIndex::Decode(AOTIRInlineIndexEntry const *Entry, IRListView **IRList, RegisterAllocationData::UniquePtr *RAData) const {
+    uintptr_t This = (uintptr_t)this;
+    auto Begin = (uint8_t const*)(This + DataBase + Entry->DataOffset);
+    // Entry data ends where the access profile starts
+    auto End = (uint8_t const*)GetProfile();
+    if (Begin >= End) {
+      return false;
+    }
 
-    return (IR::IRListView *)&InlineData[Offset];
+    return DecodeAOTIREntry(Begin, End, GetPool(), IRList, RAData);
   }
 
   void AOTIRCaptureCacheEntry::AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash, FEXCore::IR::IRListView *IRList, FEXCore::IR::RegisterAllocationData *RAData) {
-    auto Inserted = Index.emplace(GuestRIP, Stream->tellp());
+    if (Index.contains(GuestRIP)) {
+      return;
+    }
+
+    EncodeBuffer.clear();
+    EncodeAOTIREntry(EncodeBuffer, IRList, RAData, &Pool);
+
+    // Identical code reached from different entry points or mapped at different places encodes the same, store it once
+    const auto EncodedHash = XXH3_128bits(EncodeBuffer.data(), EncodeBuffer.size());
+    auto Data = EncodedData.try_emplace({EncodedHash.low64, EncodedHash.high64}, Stream->tellp());
+    if (Data.second) {
+      Stream->write(EncodeBuffer.data(), EncodeBuffer.size());
+    }
 
-    if (Inserted.second) {
-      //GuestHash
-      Stream->write((const char*)&Hash, sizeof(Hash));
+    Index.emplace(GuestRIP, AOTIRInlineIndexEntry {
+      .GuestStart = GuestRIP,
+      .DataOffset = Data.first->second,
+      .GuestHash = Hash,
+      .GuestLength = Length,
+    });
+  }
 
-      //GuestLength
-      Stream->write((const char*)&Length, sizeof(Length));
+  // Upper bound of what gets read ahead from the access profile of a single file
+  constexpr static size_t MAX_PREFETCH_SIZE = 64 * 1024 * 1024;
 
-      RAData->Serialize(*Stream);
+  // Faults a range of the file in, without waiting on the disk later when the JIT touches it
+  static void PopulateRange(char *FilePtr, size_t MapSize, uint64_t Offset, uint64_t Size) {
+    const uint64_t Begin = Offset & ~4095ULL;
+    const uint64_t End = std::min<uint64_t>((Offset + Size + 4095) & ~4095ULL, MapSize);
+    if (Begin >= End) {
+      return;
+    }
 
-      // IRData (inline)
-      IRList->Serialize(*Stream);
+    if (madvise(FilePtr + Begin, End - Begin, MADV_POPULATE_READ) != 0) {
+      // Older kernels only support starting readahead
+      madvise(FilePtr + Begin, End - Begin, MADV_WILLNEED);
     }
   }
 
-  static bool readAll(int fd, void *data, size_t size) {
-    int rv = read(fd, data, size);
+  static void PrefetchAOTIRCache(char *FilePtr, size_t MapSize, AOTIRInlineIndex *Array, uint64_t IndexOffset, uint64_t IndexSize) {
+    // Every lookup goes through the index and every decode through the pool
+    const uint64_t PoolOffset = IndexOffset + Array->PoolBase;
+    PopulateRange(FilePtr, MapSize, PoolOffset, IndexOffset + IndexSize - PoolOffset);
+
+    // Then the entries in the order the last run needed them, merging neighbours in to a single call
+    auto Profile = Array->GetProfile();
+    uint64_t Budget = MAX_PREFETCH_SIZE;
+    uint64_t RunBegin{}, RunEnd{};
+    for (size_t i = 0; i < Array->ProfileCount && Budget; ++i) {
+      const auto &Range = Profile[i];
+      if (Range.DataOffset > IndexOffset || Range.Size > IndexOffset - Range.DataOffset) {
+        // Corrupt profile
+        break;
+      }
 
-    if (rv != size)
-      return false;
-    else
-      return true;
+      const uint64_t Size = std::min(Range.Size, Budget);
+      Budget -= Size;
+
+      if (RunEnd != RunBegin && Range.DataOffset >= RunBegin && Range.DataOffset <= RunEnd + 4096) {
+        RunEnd = std::max(RunEnd, Range.DataOffset + Size);
+        continue;
+      }
+
+      PopulateRange(FilePtr, MapSize, RunBegin, RunEnd - RunBegin);
+      RunBegin = Range.DataOffset;
+      RunEnd = Range.DataOffset + Size;
+    }
+    PopulateRange(FilePtr, MapSize, RunBegin, RunEnd - RunBegin);
   }
 
-  static bool LoadAOTIRCache(AOTIRCacheEntry *Entry, int streamfd) {
+  // AnyVersion accepts a cache that was generated for another version of the file, each entry still checks its hash
+  static bool LoadAOTIRCache(AOTIRCacheEntry *Entry, int streamfd, bool AnyVersion) {
+    struct stat fileinfo;
+    if (fstat(streamfd, &fileinfo) < 0)
+      return false;
+    const uint64_t FileSize = fileinfo.st_size;
+
     uint64_t tag;
+    if (pread(streamfd, &tag, sizeof(tag), 0) != sizeof(tag) || tag != FEXCore::IR::AOTIR_COOKIE)
+      return false;
 
-    if (!readAll(streamfd, (char*)&tag, sizeof(tag)) || tag != FEXCore::IR::AOTIR_COOKIE)
+    // Trailer is IndexSize, Module, ModSize. Module is a file id, so a page always covers all of it.
+    std::array<char, 4096> Trailer;
+    const size_t TrailerSize = std::min<uint64_t>(FileSize, Trailer.size());
+    if (pread(streamfd, Trailer.data(), TrailerSize, FileSize - TrailerSize) != static_cast<ssize_t>(TrailerSize))
       return false;
 
-    std::string Module;
     uint64_t ModSize;
     uint64_t IndexSize;
-
-    lseek(streamfd, -sizeof(ModSize), SEEK_END);
-
-    if (!readAll(streamfd,  (char*)&ModSize, sizeof(ModSize)))
+    if (TrailerSize < sizeof(ModSize) + sizeof(IndexSize))
       return false;
 
-    Module.resize(ModSize);
-
-    lseek(streamfd, -sizeof(ModSize) - ModSize, SEEK_END);
-
-    if (!readAll(streamfd,  (char*)&Module[0], Module.size()))
+    const char *TrailerEnd = Trailer.data() + TrailerSize;
+    memcpy(&ModSize, TrailerEnd - sizeof(ModSize), sizeof(ModSize));
+    if (ModSize > TrailerSize - sizeof(ModSize) - sizeof(IndexSize))
       return false;
 
-    if (Entry->FileId != Module) {
+    std::string_view Module(TrailerEnd - sizeof(ModSize) - ModSize, ModSize);
+    if (!AnyVersion && Entry->FileId != Module) {
       return false;
     }
 
-    lseek(streamfd, -sizeof(ModSize) - ModSize - sizeof(IndexSize), SEEK_END);
-
-    if (!readAll(streamfd,  (char*)&IndexSize, sizeof(IndexSize)))
+    memcpy(&IndexSize, TrailerEnd - sizeof(ModSize) - ModSize - sizeof(IndexSize), sizeof(IndexSize));
+    if (IndexSize < sizeof(AOTIRInlineIndex) || IndexSize > FileSize - sizeof(ModSize) - ModSize - sizeof(IndexSize))
       return false;
 
-    struct stat fileinfo;
-    if (fstat(streamfd, &fileinfo) < 0)
-      return false;
-    size_t Size = (fileinfo.st_size + 4095) & ~4095;
+    size_t Size = (FileSize + 4095) & ~4095;
 
-    size_t IndexOffset = fileinfo.st_size - IndexSize -sizeof(ModSize) - ModSize - sizeof(IndexSize);
+    size_t IndexOffset = FileSize - IndexSize -sizeof(ModSize) - ModSize - sizeof(IndexSize);
 
+    // No MAP_POPULATE, that would read the whole file. Only what is likely needed soon is prefetched.
     void *FilePtr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ, MAP_SHARED, streamfd, 0);
 
     if (FilePtr == MAP_FAILED) {
@@ -126,20 +197,149 @@ namespace FEXCore::IR {
     }
 
     auto Array = (AOTIRInlineIndex *)((char*)FilePtr + IndexOffset);
+    const uint64_t ProfileOffset = IndexOffset + Array->ProfileBase;
+    const uint64_t PoolOffset = IndexOffset + Array->PoolBase;
+    if (Array->Count > (IndexSize - sizeof(AOTIRInlineIndex)) / sizeof(AOTIRInlineIndexEntry) ||
+        ProfileOffset > PoolOffset ||
+        Array->ProfileCount > (PoolOffset - ProfileOffset) / sizeof(AOTIRAccessRange) ||
+        PoolOffset > IndexOffset ||
+        Array->PoolCount >= (IndexOffset - PoolOffset) / sizeof(uint32_t) ||
+        Array->PoolSize > IndexOffset - PoolOffset - (Array->PoolCount + 1) * sizeof(uint32_t)) {
+      FEXCore::Allocator::munmap(FilePtr, Size);
+      return false;
+    }
+
+    PrefetchAOTIRCache((char*)FilePtr, Size, Array, IndexOffset, IndexSize);
 
     LOGMAN_THROW_AA_FMT(Entry->Array == nullptr && Entry->FilePtr == nullptr, "Entry must not be initialized here");
     Entry->Array = Array;
     Entry->FilePtr = FilePtr;
     Entry->Size = Size;
 
-    LogMan::Msg::DFmt("AOTIR: Module {} has {} functions", Module, Array->Count);
+    LogMan::Msg::DFmt("AOTIR: Module {} has {} functions, {} in its access profile", Module, Array->Count, Array->ProfileCount);
 
     return true;
   }
 
+  AOTIRCaptureCache::~AOTIRCaptureCache() {
+    if (!Loader) {
+      return;
+    }
+
+    {
+      std::lock_guard lk(Loader->QueueMutex);
+      Loader->ShuttingDown = true;
+    }
+    Loader->QueueCV.notify_all();
+
+    if (Loader->Thread->joinable()) {
+      Loader->Thread->join(nullptr);
+    }
+  }
+
+  void *AOTIRCaptureCache::LoaderThreadHandler(void *Arg) {
+    reinterpret_cast<AOTIRCaptureCache*>(Arg)->LoaderThread();
+    return nullptr;
+  }
+
+  void AOTIRCaptureCache::LoaderThread() {
+    // Set our thread name so we can see its relation
+    char ThreadName[16] = "AOTIRLoader\0";
+    pthread_setname_np(pthread_self(), ThreadName);
+
+    while (true) {
+      AOTIRCacheEntry *Entry;
+      {
+        std::unique_lock lk(Loader->QueueMutex);
+        Loader->QueueCV.wait(lk, [this] { return Loader->ShuttingDown || !Loader->Queue.empty(); });
+
+        // Anything still queued at shutdown is finished first so nobody is left waiting on it
+        if (Loader->Queue.empty()) {
+          break;
+        }
+
+        Entry = Loader->Queue.front();
+        Loader->Queue.pop();
+      }
+
+      LoadFile(Entry);
+
+      {
+        std::lock_guard lk(Loader->QueueMutex);
+        Entry->LoadPending.store(false, std::memory_order_release);
+      }
+      Loader->LoadedCV.notify_all();
+    }
+  }
+
+  void AOTIRCaptureCache::QueueLoad(AOTIRCacheEntry *Entry) {
+    if (!Loader) {
+      Loader = std::make_unique<AsyncLoaderState>();
+
+      uint64_t OldMask = FEXCore::Threads::SetSignalMask(~0ULL);
+      Loader->Thread = FEXCore::Threads::Thread::Create(LoaderThreadHandler, this);
+      FEXCore::Threads::SetSignalMask(OldMask);
+    }
+
+    {
+      std::lock_guard lk(Loader->QueueMutex);
+      // Anything trying to use the entry waits until it is loaded
+      Entry->LoadPending.store(true, std::memory_order_relaxed);
+      Loader->Queue.push(Entry);
+    }
+    Loader->QueueCV.notify_one();
+  }
+
+  void AOTIRCaptureCache::LoadFile(AOTIRCacheEntry *Entry) {
+    // Might have been loaded right before a fork
+    if (!Entry->Array) {
+      // Incremental generation reuses entries from wherever they ended up in the new version of the file
+      const bool Incremental = CTX->Config.AOTIRGenerate() && CTX->Config.AOTIRIncremental();
+      auto streamfd = AOTIRLoader(Entry->FileId);
+      if (streamfd != -1) {
+        FEXCore::IR::LoadAOTIRCache(Entry, streamfd, Incremental);
+        close(streamfd);
+      }
+
+      if (Incremental && Entry->Array) {
+        Entry->ContentIndex.reserve(Entry->Array->Count);
+        for (size_t i = 0; i < Entry->Array->Count; ++i) {
+          Entry->ContentIndex.emplace(Entry->Array->Entries[i].GuestHash, &Entry->Array->Entries[i]);
+        }
+      }
+    }
+  }
+
+  void AOTIRCaptureCache::WaitForLoad(AOTIRCacheEntry *Entry) {
+    if (!Entry->LoadPending.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    // Loader exists, only a queued entry can be pending
+    std::unique_lock lk(Loader->QueueMutex);
+    Loader->LoadedCV.wait(lk, [Entry] { return !Entry->LoadPending.load(std::memory_order_acquire); });
+  }
+
+  void AOTIRCaptureCache::CleanupAfterFork() {
+    // The loader thread didn't survive the fork and might have been holding its lock, leave the old state be
+    Loader.release();
+
+    // Nothing else is running now, finish what it didn't get to on this thread
+    for (auto &[FileId, Entry] : AOTIRCache) {
+      if (Entry.LoadPending) {
+        LoadFile(&Entry);
+        Entry.LoadPending.store(false, std::memory_order_release);
+      }
+    }
+  }
+
   void AOTIRCaptureCache::FinalizeAOTIRCache() {
     AOTIRCaptureCacheWriteoutQueue_Flush();
 
+    if (CTX->Config.AOTIRGenerate() && CTX->Config.AOTIRIncremental()) {
+      LogMan::Msg::IFmt("AOTIR: Reused {} unchanged entries", ReusedEntries.load());
+    }
+
     std::unique_lock lk(AOTIRCacheLock);
 
     for (auto& [String, Entry] : AOTIRCaptureCacheMap) {
@@ -150,30 +350,69 @@ namespace FEXCore::IR {
       const auto ModSize = String.size();
       auto &stream = Entry.Stream;
 
+      // Entry data is back to back, each one ends where the next one starts
+      std::vector<uint64_t> Offsets;
+      Offsets.reserve(Entry.EncodedData.size() + 1);
+      for (const auto& [Hash, DataOffset] : Entry.EncodedData) {
+        Offsets.emplace_back(DataOffset);
+      }
+      Offsets.emplace_back(stream->tellp());
+      std::sort(Offsets.begin(), Offsets.end());
+
+      std::vector<AOTIRAccessRange> Profile;
+      std::unordered_set<uint64_t> Profiled;
+      for (auto GuestStart : Entry.AccessOrder) {
+        auto it = Entry.Index.find(GuestStart);
+        if (it == Entry.Index.end() || !Profiled.insert(it->second.DataOffset).second) {
+          continue;
+        }
+
+        const auto DataOffset = it->second.DataOffset;
+        const auto End = *std::upper_bound(Offsets.begin(), Offsets.end(), DataOffset);
+        Profile.emplace_back(AOTIRAccessRange{DataOffset, End - DataOffset});
+      }
+
       // pad to 32 bytes
       constexpr char Zero = 0;
       while(stream->tellp() & 31)
         stream->write(&Zero, 1);
 
+      // AOTIRAccessRange
+      const uint64_t ProfileStart = stream->tellp();
+      stream->write((const char*)Profile.data(), Profile.size() * sizeof(AOTIRAccessRange));
+
+      // Pool
+      const uint64_t PoolStart = stream->tellp();
+      Entry.Pool.Serialize(*stream);
+      const uint64_t PoolSize = static_cast<uint64_t>(stream->tellp()) - PoolStart - (Entry.Pool.Count() + 1) * sizeof(uint32_t);
+
+      // pad to 32 bytes
+      while(stream->tellp() & 31)
+        stream->write(&Zero, 1);
+
       // AOTIRInlineIndex
       const auto FnCount = Entry.Index.size();
       const size_t DataBase = -stream->tellp();
+      const uint64_t ProfileCount = Profile.size();
+      const size_t ProfileBase = ProfileStart + DataBase;
+      const uint64_t PoolCount = Entry.Pool.Count();
+      const size_t PoolBase = PoolStart + DataBase;
 
       stream->write((const char*)&FnCount, sizeof(FnCount));
       stream->write((const char*)&DataBase, sizeof(DataBase));
+      stream->write((const char*)&ProfileCount, sizeof(ProfileCount));
+      stream->write((const char*)&ProfileBase, sizeof(ProfileBase));
+      stream->write((const char*)&PoolCount, sizeof(PoolCount));
+      stream->write((const char*)&PoolBase, sizeof(PoolBase));
+      stream->write((const char*)&PoolSize, sizeof(PoolSize));
 
-      for (const auto& [GuestStart, DataOffset] : Entry.Index) {
+      for (const auto& [GuestStart, IndexEntry] : Entry.Index) {
         //AOTIRInlineIndexEntry
-
-        // GuestStart
-        stream->write((const char*)&GuestStart, sizeof(GuestStart));
-
-        // DataOffset
-        stream->write((const char*)&DataOffset, sizeof(DataOffset));
+        stream->write((const char*)&IndexEntry, sizeof(IndexEntry));
       }
 
       // End of file header
-      const auto IndexSize = FnCount * sizeof(FEXCore::IR::AOTIRInlineIndexEntry) + sizeof(DataBase) + sizeof(FnCount);
+      const auto IndexSize = FnCount * sizeof(FEXCore::IR::AOTIRInlineIndexEntry) + sizeof(FEXCore::IR::AOTIRInlineIndex);
       stream->write((const char*)&IndexSize, sizeof(IndexSize));
       stream->write(String.c_str(), ModSize);
       stream->write((const char*)&ModSize, sizeof(ModSize));
@@ -242,6 +481,32 @@ namespace FEXCore::IR {
     }
   }
 
+  bool AOTIRCaptureCache::FetchByGuestHash(uint64_t GuestRIP, uint64_t Length, IRListView **IRList, RegisterAllocationData::UniquePtr *RAData) {
+    auto AOTIRCacheEntry = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
+
+    if (!AOTIRCacheEntry.Entry) {
+      return false;
+    }
+
+    WaitForLoad(AOTIRCacheEntry.Entry);
+    std::shared_lock lk(AOTIRCacheEntry.Entry->LoadMutex);
+    if (!AOTIRCacheEntry.Entry->Array) {
+      return false;
+    }
+
+    const auto Hash = XXH3_64bits((void*)GuestRIP, Length);
+    auto [Begin, End] = AOTIRCacheEntry.Entry->ContentIndex.equal_range(Hash);
+    for (auto it = Begin; it != End; ++it) {
+      if (it->second->GuestLength == Length &&
+          AOTIRCacheEntry.Entry->Array->Decode(it->second, IRList, RAData)) {
+        ReusedEntries.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   AOTIRCaptureCache::PreGenerateIRFetchResult AOTIRCaptureCache::PreGenerateIRFetch(uint64_t GuestRIP, FEXCore::IR::IRListView *IRList) {
     auto AOTIRCacheEntry = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
 
@@ -251,6 +516,9 @@ namespace FEXCore::IR {
       AOTIRCacheEntry.Entry->ContainsCode = true;
 
       if (IRList == nullptr && CTX->Config.AOTIRLoad()) {
+        // Waits for the loader thread if the file is still being mapped
+        WaitForLoad(AOTIRCacheEntry.Entry);
+        std::shared_lock lk(AOTIRCacheEntry.Entry->LoadMutex);
         auto Mod = AOTIRCacheEntry.Entry->Array;
 
         if (Mod != nullptr)
@@ -262,14 +530,16 @@ namespace FEXCore::IR {
             auto MappedStart = GuestRIP;
             auto hash = XXH3_64bits((void*)MappedStart, AOTEntry->GuestLength);
             if (hash == AOTEntry->GuestHash) {
-              Result.IRList = AOTEntry->GetIRData();
               //LogMan::Msg::DFmt("using {} + {:x} -> {:x}\n", file->second.fileid, AOTEntry->first, GuestRIP);
 
-              Result.RAData = AOTEntry->GetRAData()->CreateCopy();
-              Result.DebugData = new FEXCore::Core::DebugData();
-              Result.StartAddr = MappedStart;
-              Result.Length = AOTEntry->GuestLength;
-              Result.GeneratedIR = true;
+              if (Mod->Decode(AOTEntry, &Result.IRList, &Result.RAData)) {
+                Result.DebugData = new FEXCore::Core::DebugData();
+                Result.StartAddr = MappedStart;
+                Result.Length = AOTEntry->GuestLength;
+                Result.GeneratedIR = true;
+              } else {
+                LogMan::Msg::IFmt("AOTIR: corrupt entry {:x}\n", MappedStart);
+              }
             } else {
               LogMan::Msg::IFmt("AOTIR: hash check failed {:x}\n", MappedStart);
             }
@@ -300,8 +570,8 @@ namespace FEXCore::IR {
       auto AOTIRCacheEntry = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
 
       if (AOTIRCacheEntry.Entry) {
-        if (DebugData && CTX->Config.LibraryJITNaming()) {
-          CTX->Symbols.RegisterNamedRegion(CodePtr, DebugData->HostCodeSize, AOTIRCacheEntry.Entry->Filename);
+        if (DebugData && CTX->Config.LibraryJITNaming() && Thread->SymbolBuffer) {
+          CTX->Symbols.RegisterNamedRegion(Thread->SymbolBuffer.get(), CodePtr, DebugData->HostCodeSize, AOTIRCacheEntry.Entry->Filename);
         }
 
         if (CTX->Config.GDBSymbols()) {
@@ -309,7 +579,8 @@ namespace FEXCore::IR {
         }
 
         // Add to AOT cache if aot generation is enabled
-        if (GeneratedIR && RAData &&
+        // Entries are only ever looked up and validated from their entry point, blocks that start before it can't be used
+        if (GeneratedIR && RAData && StartAddr == GuestRIP &&
             (CTX->Config.AOTIRCapture() || CTX->Config.AOTIRGenerate())) {
 
           auto hash = XXH3_64bits((void*)StartAddr, Length);
@@ -336,6 +607,7 @@ namespace FEXCore::IR {
               AotFile->Stream->write((char*)&tag, sizeof(tag));
             }
             AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, IRListCopy, RADataCopy);
+            AotFile->AccessOrder.emplace_back(LocalRIP);
             RADataCopyDeleter(RADataCopy);
             delete IRListCopy;
           });
@@ -368,13 +640,20 @@ namespace FEXCore::IR {
     return false;
   }
 
-  AOTIRCacheEntry *AOTIRCaptureCache::LoadAOTIRCacheEntry(const std::string &filename) {
+  AOTIRCacheEntry *AOTIRCaptureCache::LoadAOTIRCacheEntry(const std::string &filename, const std::string &FileIdentity) {
     auto base_filename = std::filesystem::path(filename).filename().string();
 
     if (!base_filename.empty()) {
-      auto filename_hash = XXH3_64bits(filename.c_str(), filename.size());
-
-      auto fileid = base_filename + "-" + std::to_string(filename_hash) + "-";
+      std::string fileid = base_filename + "-";
+      if (!FileIdentity.empty()) {
+        // Content addressed, shared between every path that reaches the same code
+        fileid += FileIdentity + "-";
+      }
+      else {
+        // Not an ELF, best we can do is the path
+        auto filename_hash = XXH3_64bits(filename.c_str(), filename.size());
+        fileid += std::to_string(filename_hash) + "-";
+      }
 
       // append optimization flags to the fileid
       fileid += (CTX->Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) ? "S" : "s";
@@ -384,17 +663,23 @@ namespace FEXCore::IR {
 
       std::unique_lock lk(AOTIRCacheLock);
 
-      auto Inserted = AOTIRCache.insert({fileid, AOTIRCacheEntry { .FileId = fileid, .Filename = filename }});
+      auto Inserted = AOTIRCache.try_emplace(fileid);
       auto Entry = &(Inserted.first->second);
+      if (Inserted.second) {
+        Entry->FileId = fileid;
+        Entry->Filename = filename;
+      }
+
+      if (Entry->References++ != 0) {
+        // Same code mapped from another file, already loaded
+        return Entry;
+      }
 
       LOGMAN_THROW_AA_FMT(Entry->Array == nullptr, "Duplicate LoadAOTIRCacheEntry");
 
-      if (CTX->Config.AOTIRLoad && AOTIRLoader) {
-        auto streamfd = AOTIRLoader(fileid);
-        if (streamfd != -1) {
-          FEXCore::IR::LoadAOTIRCache(Entry, streamfd);
-          close(streamfd);
-        }
+      const bool LoadExisting = CTX->Config.AOTIRLoad() || (CTX->Config.AOTIRGenerate() && CTX->Config.AOTIRIncremental());
+      if (LoadExisting && AOTIRLoader) {
+        QueueLoad(Entry);
       }
       return Entry;
     }
@@ -405,8 +690,17 @@ namespace FEXCore::IR {
   void AOTIRCaptureCache::UnloadAOTIRCacheEntry(AOTIRCacheEntry *Entry) {
     LOGMAN_THROW_AA_FMT(Entry != nullptr, "Removing not existing entry");
 
+    std::unique_lock lk(AOTIRCacheLock);
+    LOGMAN_THROW_AA_FMT(Entry->References != 0, "Unbalanced UnloadAOTIRCacheEntry");
+    if (--Entry->References != 0) {
+      return;
+    }
+
+    WaitForLoad(Entry);
+    std::unique_lock lk2(Entry->LoadMutex);
     if (Entry->Array) {
       FEXCore::Allocator::munmap(Entry->FilePtr, Entry->Size);
+      Entry->ContentIndex.clear();
       Entry->Array = nullptr;
       Entry->FilePtr = nullptr;
       Entry->Size = 0;
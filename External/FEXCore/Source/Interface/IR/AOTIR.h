@@ -1,17 +1,23 @@
 #pragma once
 
 #include "FEXCore/IR/RegisterAllocationData.h"
+#include "Interface/IR/AOTIRCodec.h"
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/Threads.h>
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <fstream>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <shared_mutex>
 #include <queue>
+#include <utility>
+#include <vector>
 #include <FEXCore/HLE/SourcecodeResolver.h>
 
 namespace FEXCore::Core {
@@ -37,49 +43,85 @@ namespace FEXCore::IR {
 
     return Cookie;
   };
-  constexpr static uint32_t AOTIR_VERSION = 0x0000'00004;
+  constexpr static uint32_t AOTIR_VERSION = 0x0000'00008;
   constexpr static uint64_t AOTIR_COOKIE = COOKIE_VERSION("FEXI", AOTIR_VERSION);
 
-  struct AOTIRInlineEntry {
+  /**
+   * An AOTIR file is laid out as:
+   * | Cookie | Entry data | Access profile | Pool | AOTIRInlineIndex | IndexSize | FileId | FileId size |
+   *
+   * Entry data is the compact encoding from AOTIRCodec.h, decoded in to a regular IRListView when an entry gets used.
+   * Entries with identical IR point at the same data, entries sharing blocks share their bodies through the pool.
+   * GuestHash covers GuestLength bytes of guest code starting at GuestStart.
+   */
+  struct AOTIRInlineIndexEntry {
+    uint64_t GuestStart;
+    uint64_t DataOffset;
     uint64_t GuestHash;
     uint64_t GuestLength;
-
-    /* RAData followed by IRData */
-    uint8_t InlineData[0];
-
-    IR::RegisterAllocationData *GetRAData();
-    IR::IRListView *GetIRData();
   };
 
-  struct AOTIRInlineIndexEntry {
-    uint64_t GuestStart;
+  // File range of an entry in the access profile
+  struct AOTIRAccessRange {
     uint64_t DataOffset;
+    uint64_t Size;
   };
 
   struct AOTIRInlineIndex {
     uint64_t Count;
     uint64_t DataBase;
+    // Entries used by the run that wrote the file, in order of first use
+    uint64_t ProfileCount;
+    uint64_t ProfileBase;
+    // Op shapes and block bodies shared by the entries
+    uint64_t PoolCount;
+    uint64_t PoolBase;
+    uint64_t PoolSize;
     AOTIRInlineIndexEntry Entries[0];
 
-    AOTIRInlineEntry *Find(uint64_t GuestStart);
-    AOTIRInlineEntry *GetInlineEntry(uint64_t DataOffset);
+    AOTIRInlineIndexEntry const *Find(uint64_t GuestStart) const;
+    AOTIRAccessRange const *GetProfile() const;
+    AOTIRPoolView GetPool() const;
+
+    /**
+     * @brief Decodes the IR and RA data of an entry
+     *
+     * @return false if the entry is corrupt
+     */
+    bool Decode(AOTIRInlineIndexEntry const *Entry, IRListView **IRList, RegisterAllocationData::UniquePtr *RAData) const;
   };
 
   struct AOTIRCaptureCacheEntry {
     std::unique_ptr<std::ofstream> Stream;
-    std::map<uint64_t, uint64_t> Index;
+    std::map<uint64_t, AOTIRInlineIndexEntry> Index;
+    // Guest starts in the order they were first used, becomes the access profile of the file
+    std::vector<uint64_t> AccessOrder;
+
+    AOTIRPoolBuilder Pool;
+    // Hash of the encoded data to where it was written, for sharing it between entries
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> EncodedData;
+    std::string EncodeBuffer;
 
     void AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash, FEXCore::IR::IRListView *IRList, FEXCore::IR::RegisterAllocationData *RAData);
   };
 
   struct AOTIRCacheEntry {
-    AOTIRInlineIndex *Array;
-    void *FilePtr;
-    size_t Size;
+    AOTIRInlineIndex *Array{};
+    void *FilePtr{};
+    size_t Size{};
     std::unique_ptr<FEXCore::HLE::SourcecodeMap> SourcecodeMap;
     std::string FileId;
     std::string Filename;
-    bool ContainsCode;
+    bool ContainsCode{};
+    // Number of live mappings using this entry, files with the same identity share one
+    uint32_t References{};
+    // Entries by GuestHash, only built for incremental generation where Array can be from an older version of the file
+    std::unordered_multimap<uint64_t, AOTIRInlineIndexEntry const*> ContentIndex;
+
+    // Set while the file is queued for the loader thread, wait with WaitForLoad before using the entry.
+    std::atomic_bool LoadPending{};
+    // Keeps Array, FilePtr and Size alive while in use, taken exclusively to unload them.
+    std::shared_mutex LoadMutex;
   };
 
   using AOTCacheType = std::unordered_map<std::string, FEXCore::IR::AOTIRCacheEntry>;
@@ -88,6 +130,7 @@ namespace FEXCore::IR {
     public:
 
       AOTIRCaptureCache(FEXCore::Context::Context *ctx) : CTX {ctx} {}
+      ~AOTIRCaptureCache();
 
       void FinalizeAOTIRCache();
       void AOTIRCaptureCacheWriteoutQueue_Flush();
@@ -114,9 +157,26 @@ namespace FEXCore::IR {
         FEXCore::Core::DebugData *DebugData,
         bool GeneratedIR);
 
-      AOTIRCacheEntry *LoadAOTIRCacheEntry(const std::string &filename);
+      /**
+       * @brief Finds or creates the cache entry for a mapped file
+       *
+       * The cache file itself is mapped by the loader thread, this only queues it up.
+       */
+      AOTIRCacheEntry *LoadAOTIRCacheEntry(const std::string &filename, const std::string &FileIdentity);
       void UnloadAOTIRCacheEntry(AOTIRCacheEntry *Entry);
 
+      // Finishes the loads the loader thread didn't get to before the fork
+      void CleanupAfterFork();
+
+      /**
+       * @brief Finds an entry of the loaded cache with the same guest code, wherever it was in the file
+       *
+       * Used by incremental generation, IR only refers to guest code relative to its entry point so it can be moved.
+       *
+       * @return false if no entry matches the Length bytes at GuestRIP
+       */
+      bool FetchByGuestHash(uint64_t GuestRIP, uint64_t Length, IRListView **IRList, RegisterAllocationData::UniquePtr *RAData);
+
       // Callbacks
       void SetAOTIRLoader(std::function<int(const std::string&)> CacheReader) {
         AOTIRLoader = CacheReader;
@@ -131,11 +191,33 @@ namespace FEXCore::IR {
       }
 
     private:
+      struct AsyncLoaderState {
+        std::mutex QueueMutex;
+        std::condition_variable QueueCV;
+        std::queue<AOTIRCacheEntry*> Queue;
+        // Signalled under QueueMutex whenever an entry's LoadPending is cleared
+        std::condition_variable LoadedCV;
+        bool ShuttingDown{};
+        std::unique_ptr<FEXCore::Threads::Thread> Thread;
+      };
+
+      // AOTIRCacheLock must be held
+      void QueueLoad(AOTIRCacheEntry *Entry);
+      // Maps the file, the entry must still be pending so nothing else touches it
+      void LoadFile(AOTIRCacheEntry *Entry);
+      // Blocks until the loader thread is done with the entry
+      void WaitForLoad(AOTIRCacheEntry *Entry);
+
+      static void *LoaderThreadHandler(void *Arg);
+      void LoaderThread();
+
       FEXCore::Context::Context *CTX;
 
       std::shared_mutex AOTIRCacheLock;
       std::shared_mutex AOTIRCaptureCacheWriteoutLock;
       std::atomic<bool> AOTIRCaptureCacheWriteoutFlusing;
+      // Entries taken from an existing cache by incremental generation
+      std::atomic<uint64_t> ReusedEntries{};
 
       std::queue<std::function<void()>> AOTIRCaptureCacheWriteoutQueue;
 
@@ -145,5 +227,8 @@ namespace FEXCore::IR {
       std::function<std::unique_ptr<std::ofstream>(const std::string&)> AOTIRWriter;
       std::function<void(const std::string&)> AOTIRRenamer;
       std::unordered_map<std::string, FEXCore::IR::AOTIRCaptureCacheEntry> AOTIRCaptureCacheMap;
+
+      // Created with the first load
+      std::unique_ptr<AsyncLoaderState> Loader;
   };
 }
@@ -0,0 +1,618 @@
+/*
+$info$
+tags: ir|aotir
+desc: Compact encoding of AOTIR entries
+$end_info$
+*/
+
+#include "Interface/IR/AOTIRCodec.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace FEXCore::IR {
+namespace {
+  enum EntryKind : uint8_t {
+    KIND_RAW = 0,
+    KIND_COMPACT = 1,
+  };
+
+  // SSA arguments directly follow the header
+  static_assert(sizeof(IROp_Header) == 4);
+
+  // Anything claiming to be larger than this is corrupt, keeps a bad file from making us allocate gigabytes
+  constexpr uint64_t MAX_DECODED_SIZE = 64 * 1024 * 1024;
+
+  struct OpLocation {
+    uint32_t DataOffset;
+    // First node pointing at the op, arguments are relative to it
+    uint32_t NodeOffset;
+
+    bool operator<(OpLocation const &rhs) const {
+      return DataOffset < rhs.DataOffset || (DataOffset == rhs.DataOffset && NodeOffset < rhs.NodeOffset);
+    }
+  };
+
+  void SortOps(std::vector<OpLocation> &Ops) {
+    std::sort(Ops.begin(), Ops.end());
+    Ops.erase(std::unique(Ops.begin(), Ops.end(), [](auto const &lhs, auto const &rhs) {
+      return lhs.DataOffset == rhs.DataOffset;
+    }), Ops.end());
+  }
+
+  void WriteULEB128(std::string &Out, uint64_t Value) {
+    do {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      Out.push_back(Byte | (Value ? 0x80 : 0));
+    } while (Value);
+  }
+
+  void WriteSLEB128(std::string &Out, int64_t Value) {
+    while (true) {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      const bool Done = (Value == 0 && !(Byte & 0x40)) || (Value == -1 && (Byte & 0x40));
+      Out.push_back(Byte | (Done ? 0 : 0x80));
+      if (Done) {
+        return;
+      }
+    }
+  }
+
+  void WriteBytes(std::string &Out, void const *Data, size_t Size) {
+    Out.append(reinterpret_cast<char const*>(Data), Size);
+  }
+
+  // Bounds checked reads, once anything goes out of bounds every read after fails as well
+  class ByteReader final {
+  public:
+    ByteReader(uint8_t const *Begin, uint8_t const *End)
+      : Cursor {Begin}, End {End} {}
+
+    bool Failed() const {
+      return Cursor == nullptr;
+    }
+
+    bool AtEnd() const {
+      return Cursor == End;
+    }
+
+    uint64_t ReadULEB128() {
+      uint64_t Value{};
+      for (uint32_t Shift = 0; Cursor && Cursor != End && Shift < 64; Shift += 7) {
+        const uint8_t Byte = *Cursor++;
+        Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+        if (!(Byte & 0x80)) {
+          return Value;
+        }
+      }
+      Cursor = nullptr;
+      return 0;
+    }
+
+    int64_t ReadSLEB128() {
+      uint64_t Value{};
+      for (uint32_t Shift = 0; Cursor && Cursor != End && Shift < 64; Shift += 7) {
+        const uint8_t Byte = *Cursor++;
+        Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+        if (!(Byte & 0x80)) {
+          if (Shift + 7 < 64 && (Byte & 0x40)) {
+            // Sign extend
+            Value |= ~0ULL << (Shift + 7);
+          }
+          return static_cast<int64_t>(Value);
+        }
+      }
+      Cursor = nullptr;
+      return 0;
+    }
+
+    uint8_t const *ReadBytes(uint64_t Size) {
+      if (!Cursor || Size > static_cast<uint64_t>(End - Cursor)) {
+        Cursor = nullptr;
+        return nullptr;
+      }
+
+      auto Data = Cursor;
+      Cursor += Size;
+      return Data;
+    }
+
+  private:
+    uint8_t const *Cursor;
+    uint8_t const *End;
+  };
+
+  OrderedNode ReadNode(uintptr_t List, uint32_t NodeOffset) {
+    OrderedNode Node;
+    memcpy(&Node, reinterpret_cast<void const*>(List + NodeOffset), sizeof(Node));
+    return Node;
+  }
+
+  uint8_t GetNumArgs(void const *OpHeader) {
+    IROp_Header Header;
+    memcpy(&Header, OpHeader, sizeof(Header));
+    return Header.NumArgs;
+  }
+
+  IROps GetOp(void const *OpHeader) {
+    IROp_Header Header;
+    memcpy(&Header, OpHeader, sizeof(Header));
+    return Header.Op;
+  }
+
+  // Guest offset from the entry point carried by an op, blocks store it relative to their own start
+  struct EntryRelativeField {
+    size_t Offset;
+    size_t Size;
+  };
+
+  EntryRelativeField GetEntryRelativeField(IROps Op) {
+    switch (Op) {
+      case OP_GUESTOPCODE: return {offsetof(IROp_GuestOpcode, GuestEntryOffset), sizeof(uint32_t)};
+      case OP_ENTRYPOINTOFFSET: return {offsetof(IROp_EntrypointOffset, Offset), sizeof(int64_t)};
+      case OP_INLINEENTRYPOINTOFFSET: return {offsetof(IROp_InlineEntrypointOffset, Offset), sizeof(int64_t)};
+      case OP_VALIDATECODE: return {offsetof(IROp_ValidateCode, Offset), sizeof(int64_t)};
+      default: return {0, 0};
+    }
+  }
+
+  // Adds Delta to the entry relative field of a shape, wrapping like the guest address would
+  void RebaseShape(uint8_t *Shape, size_t ShapeSize, uint64_t Delta) {
+    const auto Field = GetEntryRelativeField(GetOp(Shape));
+    // Only ops without SSA arguments carry one, so the field is at the same place in the shape as in the op
+    if (Field.Size == 0 || GetNumArgs(Shape) != 0 || Field.Offset + Field.Size > ShapeSize) {
+      return;
+    }
+
+    if (Field.Size == sizeof(uint32_t)) {
+      uint32_t Value;
+      memcpy(&Value, Shape + Field.Offset, sizeof(Value));
+      Value += static_cast<uint32_t>(Delta);
+      memcpy(Shape + Field.Offset, &Value, sizeof(Value));
+    }
+    else {
+      uint64_t Value;
+      memcpy(&Value, Shape + Field.Offset, sizeof(Value));
+      Value += Delta;
+      memcpy(Shape + Field.Offset, &Value, sizeof(Value));
+    }
+  }
+
+  bool GetPoolItem(AOTIRPoolView const &Pool, uint64_t Index, uint8_t const **Item, size_t *Size) {
+    if (Index >= Pool.Count) {
+      return false;
+    }
+
+    uint32_t Begin, End;
+    memcpy(&Begin, &Pool.Offsets[Index], sizeof(Begin));
+    memcpy(&End, &Pool.Offsets[Index + 1], sizeof(End));
+    if (Begin > End || End > Pool.DataSize) {
+      return false;
+    }
+
+    *Item = Pool.Data + Begin;
+    *Size = End - Begin;
+    return true;
+  }
+
+  void EncodeRAData(std::string &Out, RegisterAllocationData const *RA) {
+    WriteULEB128(Out, RA->SpillSlotCount);
+    WriteULEB128(Out, RA->MapCount);
+
+    // Runs of {length, register}, most of the map is a handful of registers or invalid
+    for (uint32_t i = 0; i < RA->MapCount;) {
+      const auto Raw = RA->Map[i].Raw;
+      uint32_t Length = 1;
+      while (i + Length < RA->MapCount && RA->Map[i + Length].Raw == Raw) {
+        ++Length;
+      }
+
+      WriteULEB128(Out, Length);
+      Out.push_back(Raw);
+      i += Length;
+    }
+  }
+
+  bool DecodeRAData(ByteReader &Reader, RegisterAllocationData::UniquePtr *RA) {
+    const auto SpillSlotCount = Reader.ReadULEB128();
+    const auto MapCount = Reader.ReadULEB128();
+    if (Reader.Failed() || SpillSlotCount > UINT32_MAX || MapCount > MAX_DECODED_SIZE) {
+      return false;
+    }
+
+    auto Result = RegisterAllocationData::Create(MapCount);
+    Result->SpillSlotCount = SpillSlotCount;
+
+    for (uint64_t i = 0; i < MapCount;) {
+      const auto Length = Reader.ReadULEB128();
+      const auto Raw = Reader.ReadBytes(1);
+      if (!Raw || Length == 0 || Length > MapCount - i) {
+        return false;
+      }
+
+      memset(&Result->Map[i], *Raw, Length);
+      i += Length;
+    }
+
+    *RA = std::move(Result);
+    return true;
+  }
+
+  bool EncodeCompactIR(std::string &Out, IRListView const *IR, AOTIRPoolBuilder *Pool) {
+    const size_t DataSize = IR->GetDataSize();
+    const size_t ListSize = IR->GetListSize();
+    const auto Data = IR->GetData();
+    const auto List = IR->GetListData();
+
+    if (ListSize % sizeof(OrderedNode) != 0) {
+      return false;
+    }
+
+    const uint32_t NodeCount = ListSize / sizeof(OrderedNode);
+    std::vector<OpLocation> Ops;
+    Ops.reserve(NodeCount);
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+      const uint32_t NodeOffset = i * sizeof(OrderedNode);
+      const auto Value = ReadNode(List, NodeOffset).Header.Value.NodeOffset;
+      if (DataSize < sizeof(IROp_Header) || Value > DataSize - sizeof(IROp_Header)) {
+        return false;
+      }
+      Ops.emplace_back(OpLocation{Value, NodeOffset});
+    }
+    SortOps(Ops);
+
+    // Each op owns the bytes up to the next one, that covers any padding or orphaned ops in between
+    for (size_t i = 0; i < Ops.size(); ++i) {
+      const size_t Extent = (i + 1 < Ops.size() ? Ops[i + 1].DataOffset : DataSize) - Ops[i].DataOffset;
+      const auto NumArgs = GetNumArgs(reinterpret_cast<void const*>(Data + Ops[i].DataOffset));
+      if (Extent < sizeof(IROp_Header) + NumArgs * sizeof(OrderedNodeWrapper)) {
+        return false;
+      }
+    }
+
+    Out.push_back(KIND_COMPACT);
+    WriteULEB128(Out, DataSize);
+    WriteULEB128(Out, NodeCount);
+
+    uint32_t PreviousValue{};
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+      const int64_t NodeOffset = i * sizeof(OrderedNode);
+      const auto Node = ReadNode(List, NodeOffset);
+
+      // Nodes are mostly linked in allocation order with their ops allocated alongside them
+      WriteSLEB128(Out, static_cast<int64_t>(Node.Header.Next.NodeOffset) - (NodeOffset + static_cast<int64_t>(sizeof(OrderedNode))));
+      WriteSLEB128(Out, static_cast<int64_t>(Node.Header.Previous.NodeOffset) - (NodeOffset - static_cast<int64_t>(sizeof(OrderedNode))));
+      WriteULEB128(Out, Node.NumUses);
+      WriteSLEB128(Out, static_cast<int64_t>(Node.Header.Value.NodeOffset) - PreviousValue);
+      PreviousValue = Node.Header.Value.NodeOffset;
+    }
+
+    const size_t PrefixSize = Ops.empty() ? DataSize : Ops.front().DataOffset;
+    WriteULEB128(Out, PrefixSize);
+    WriteBytes(Out, reinterpret_cast<void const*>(Data), PrefixSize);
+
+    auto GetOpData = [Data, &Ops](size_t i) {
+      return reinterpret_cast<uint8_t const*>(Data + Ops[i].DataOffset);
+    };
+
+    // Blocks are referenced by their index, relative to the block using them
+    std::unordered_map<uint32_t, uint32_t> BlockIndices;
+    for (size_t i = 0; i < Ops.size(); ++i) {
+      if (GetOp(GetOpData(i)) == OP_CODEBLOCK) {
+        BlockIndices.emplace(Ops[i].NodeOffset, BlockIndices.size());
+      }
+    }
+
+    WriteULEB128(Out, BlockIndices.size());
+    int64_t PreviousBlock{};
+    for (size_t i = 0; i < Ops.size(); ++i) {
+      if (GetOp(GetOpData(i)) == OP_CODEBLOCK) {
+        WriteSLEB128(Out, static_cast<int64_t>(Ops[i].NodeOffset) - PreviousBlock);
+        PreviousBlock = Ops[i].NodeOffset;
+      }
+    }
+
+    // Ops are split in to segments at every BeginBlock and the segments go in to the pool.
+    // Overlapping entries of a multiblock function then share the bodies of the blocks they have in common.
+    std::vector<size_t> SegmentStarts;
+    for (size_t i = 0; i < Ops.size(); ++i) {
+      if (i == 0 || GetOp(GetOpData(i)) == OP_BEGINBLOCK) {
+        SegmentStarts.emplace_back(i);
+      }
+    }
+
+    WriteULEB128(Out, SegmentStarts.size());
+
+    std::string Body;
+    std::string Shape;
+    for (size_t Segment = 0; Segment < SegmentStarts.size(); ++Segment) {
+      const size_t Begin = SegmentStarts[Segment];
+      const size_t End = Segment + 1 < SegmentStarts.size() ? SegmentStarts[Segment + 1] : Ops.size();
+
+      // The block's own guest offset and index, everything in the body is relative to those
+      uint32_t Base{};
+      for (size_t i = Begin; i < End; ++i) {
+        if (GetOp(GetOpData(i)) == OP_GUESTOPCODE) {
+          IROp_GuestOpcode GuestOp;
+          memcpy(&GuestOp, GetOpData(i), sizeof(GuestOp));
+          Base = GuestOp.GuestEntryOffset;
+          break;
+        }
+      }
+
+      uint32_t CurrentBlock{};
+      if (GetOp(GetOpData(Begin)) == OP_BEGINBLOCK && GetNumArgs(GetOpData(Begin)) == 1) {
+        OrderedNodeWrapper Wrapper;
+        memcpy(&Wrapper, GetOpData(Begin) + sizeof(IROp_Header), sizeof(Wrapper));
+        auto it = BlockIndices.find(Wrapper.NodeOffset);
+        if (it != BlockIndices.end()) {
+          CurrentBlock = it->second;
+        }
+      }
+
+      Body.clear();
+      for (size_t i = Begin; i < End; ++i) {
+        const size_t Extent = (i + 1 < Ops.size() ? Ops[i + 1].DataOffset : DataSize) - Ops[i].DataOffset;
+        const auto Op = GetOpData(i);
+        const auto NumArgs = GetNumArgs(Op);
+        const size_t ArgsSize = NumArgs * sizeof(OrderedNodeWrapper);
+
+        Shape.assign(reinterpret_cast<char const*>(Op), sizeof(IROp_Header));
+        Shape.append(reinterpret_cast<char const*>(Op + sizeof(IROp_Header) + ArgsSize), Extent - sizeof(IROp_Header) - ArgsSize);
+        RebaseShape(reinterpret_cast<uint8_t*>(Shape.data()), Shape.size(), -static_cast<uint64_t>(Base));
+        WriteULEB128(Body, Pool->Intern(Shape));
+
+        // Low bit set: relative block index, clear: distance back from the node using it
+        for (size_t Arg = 0; Arg < NumArgs; ++Arg) {
+          OrderedNodeWrapper Wrapper;
+          memcpy(&Wrapper, Op + sizeof(IROp_Header) + Arg * sizeof(OrderedNodeWrapper), sizeof(Wrapper));
+
+          auto Block = BlockIndices.find(Wrapper.NodeOffset);
+          if (Block != BlockIndices.end()) {
+            WriteSLEB128(Body, (static_cast<int64_t>(Block->second) - CurrentBlock) * 2 + 1);
+          }
+          else {
+            WriteSLEB128(Body, (static_cast<int64_t>(Ops[i].NodeOffset) - static_cast<int64_t>(Wrapper.NodeOffset)) * 2);
+          }
+        }
+      }
+
+      WriteULEB128(Out, Pool->Intern(Body));
+      WriteULEB128(Out, Base);
+      WriteULEB128(Out, CurrentBlock);
+    }
+
+    return true;
+  }
+
+  bool DecodeCompactIR(ByteReader &Reader, AOTIRPoolView const &Pool, std::unique_ptr<IRListView> *IR) {
+    const auto DataSize = Reader.ReadULEB128();
+    const auto NodeCount = Reader.ReadULEB128();
+    if (Reader.Failed() || DataSize > MAX_DECODED_SIZE || NodeCount > MAX_DECODED_SIZE / sizeof(OrderedNode)) {
+      return false;
+    }
+
+    auto Result = std::make_unique<IRListView>(DataSize, NodeCount * sizeof(OrderedNode));
+    const auto Data = reinterpret_cast<uint8_t*>(Result->GetData());
+    const auto List = Result->GetListData();
+
+    std::vector<OpLocation> Ops;
+    Ops.reserve(NodeCount);
+    uint32_t PreviousValue{};
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+      const int64_t NodeOffset = i * sizeof(OrderedNode);
+
+      OrderedNode Node{};
+      Node.Header.Next.NodeOffset = static_cast<uint32_t>(Reader.ReadSLEB128() + NodeOffset + static_cast<int64_t>(sizeof(OrderedNode)));
+      Node.Header.Previous.NodeOffset = static_cast<uint32_t>(Reader.ReadSLEB128() + NodeOffset - static_cast<int64_t>(sizeof(OrderedNode)));
+      Node.NumUses = static_cast<uint32_t>(Reader.ReadULEB128());
+      Node.Header.Value.NodeOffset = static_cast<uint32_t>(Reader.ReadSLEB128() + PreviousValue);
+      PreviousValue = Node.Header.Value.NodeOffset;
+
+      if (Reader.Failed() || DataSize < sizeof(IROp_Header) || PreviousValue > DataSize - sizeof(IROp_Header)) {
+        return false;
+      }
+
+      memcpy(reinterpret_cast<void*>(List + NodeOffset), &Node, sizeof(Node));
+      Ops.emplace_back(OpLocation{PreviousValue, static_cast<uint32_t>(NodeOffset)});
+    }
+    SortOps(Ops);
+
+    const auto PrefixSize = Reader.ReadULEB128();
+    if (PrefixSize != (Ops.empty() ? DataSize : Ops.front().DataOffset)) {
+      return false;
+    }
+
+    auto Prefix = Reader.ReadBytes(PrefixSize);
+    if (!Prefix) {
+      return false;
+    }
+    memcpy(Data, Prefix, PrefixSize);
+
+    const auto BlockCount = Reader.ReadULEB128();
+    if (Reader.Failed() || BlockCount > NodeCount) {
+      return false;
+    }
+
+    std::vector<uint32_t> Blocks;
+    Blocks.reserve(BlockCount);
+    int64_t PreviousBlock{};
+    for (uint64_t i = 0; i < BlockCount; ++i) {
+      PreviousBlock += Reader.ReadSLEB128();
+      Blocks.emplace_back(static_cast<uint32_t>(PreviousBlock));
+    }
+
+    const auto SegmentCount = Reader.ReadULEB128();
+    if (Reader.Failed() || SegmentCount > Ops.size()) {
+      return false;
+    }
+
+    size_t i = 0;
+    for (uint64_t Segment = 0; Segment < SegmentCount; ++Segment) {
+      const auto BodyIndex = Reader.ReadULEB128();
+      const auto Base = Reader.ReadULEB128();
+      const auto CurrentBlock = Reader.ReadULEB128();
+
+      uint8_t const *BodyData;
+      size_t BodySize;
+      if (Reader.Failed() || Base > UINT32_MAX || !GetPoolItem(Pool, BodyIndex, &BodyData, &BodySize)) {
+        return false;
+      }
+
+      ByteReader Body(BodyData, BodyData + BodySize);
+      do {
+        if (i >= Ops.size()) {
+          return false;
+        }
+
+        const size_t Extent = (i + 1 < Ops.size() ? Ops[i + 1].DataOffset : DataSize) - Ops[i].DataOffset;
+        uint8_t const *Shape;
+        size_t ShapeSize;
+        if (!GetPoolItem(Pool, Body.ReadULEB128(), &Shape, &ShapeSize) || Body.Failed() || ShapeSize < sizeof(IROp_Header)) {
+          return false;
+        }
+
+        const auto NumArgs = GetNumArgs(Shape);
+        const size_t ArgsSize = NumArgs * sizeof(OrderedNodeWrapper);
+        if (ShapeSize + ArgsSize != Extent) {
+          return false;
+        }
+
+        auto Op = Data + Ops[i].DataOffset;
+        memcpy(Op, Shape, sizeof(IROp_Header));
+        for (size_t Arg = 0; Arg < NumArgs; ++Arg) {
+          const auto Value = Body.ReadSLEB128();
+
+          OrderedNodeWrapper Wrapper;
+          if (Value & 1) {
+            const auto Block = static_cast<int64_t>(CurrentBlock) + (Value >> 1);
+            if (Block < 0 || static_cast<uint64_t>(Block) >= Blocks.size()) {
+              return false;
+            }
+            Wrapper.NodeOffset = Blocks[Block];
+          }
+          else {
+            Wrapper.NodeOffset = static_cast<uint32_t>(Ops[i].NodeOffset - (Value >> 1));
+          }
+          memcpy(Op + sizeof(IROp_Header) + Arg * sizeof(OrderedNodeWrapper), &Wrapper, sizeof(Wrapper));
+        }
+        memcpy(Op + sizeof(IROp_Header) + ArgsSize, Shape + sizeof(IROp_Header), ShapeSize - sizeof(IROp_Header));
+        RebaseShape(Op, ShapeSize + ArgsSize, Base);
+
+        if (Body.Failed()) {
+          return false;
+        }
+        ++i;
+      } while (!Body.AtEnd());
+    }
+
+    if (i != Ops.size()) {
+      return false;
+    }
+
+    *IR = std::move(Result);
+    return true;
+  }
+
+  void EncodeRawIR(std::string &Out, IRListView const *IR) {
+    Out.push_back(KIND_RAW);
+    WriteULEB128(Out, IR->GetDataSize());
+    WriteULEB128(Out, IR->GetListSize());
+    WriteBytes(Out, reinterpret_cast<void const*>(IR->GetData()), IR->GetDataSize());
+    WriteBytes(Out, reinterpret_cast<void const*>(IR->GetListData()), IR->GetListSize());
+  }
+
+  bool DecodeRawIR(ByteReader &Reader, std::unique_ptr<IRListView> *IR) {
+    const auto DataSize = Reader.ReadULEB128();
+    const auto ListSize = Reader.ReadULEB128();
+    if (Reader.Failed() || DataSize > MAX_DECODED_SIZE || ListSize > MAX_DECODED_SIZE) {
+      return false;
+    }
+
+    auto Data = Reader.ReadBytes(DataSize);
+    auto List = Reader.ReadBytes(ListSize);
+    if (!Data || !List) {
+      return false;
+    }
+
+    auto Result = std::make_unique<IRListView>(DataSize, ListSize);
+    memcpy(reinterpret_cast<void*>(Result->GetData()), Data, DataSize);
+    memcpy(reinterpret_cast<void*>(Result->GetListData()), List, ListSize);
+    *IR = std::move(Result);
+    return true;
+  }
+}
+
+  uint32_t AOTIRPoolBuilder::Intern(std::string_view Shape) {
+    auto Inserted = Indices.try_emplace(std::string(Shape), Items.size());
+    if (Inserted.second) {
+      Items.emplace_back(Inserted.first->first);
+    }
+    return Inserted.first->second;
+  }
+
+  void AOTIRPoolBuilder::Serialize(std::ostream &stream) const {
+    uint32_t Offset{};
+    for (auto Item : Items) {
+      stream.write(reinterpret_cast<char const*>(&Offset), sizeof(Offset));
+      Offset += Item.size();
+    }
+    stream.write(reinterpret_cast<char const*>(&Offset), sizeof(Offset));
+
+    for (auto Item : Items) {
+      stream.write(Item.data(), Item.size());
+    }
+  }
+
+  void EncodeAOTIREntry(std::string &Out, IRListView const *IR, RegisterAllocationData const *RA, AOTIRPoolBuilder *Pool) {
+    EncodeRAData(Out, RA);
+
+    const auto Start = Out.size();
+    if (!EncodeCompactIR(Out, IR, Pool)) {
+      Out.resize(Start);
+      EncodeRawIR(Out, IR);
+    }
+  }
+
+  bool DecodeAOTIREntry(uint8_t const *Begin, uint8_t const *End, AOTIRPoolView const &Pool,
+                        IRListView **IR, RegisterAllocationData::UniquePtr *RA) {
+    ByteReader Reader(Begin, End);
+
+    RegisterAllocationData::UniquePtr DecodedRA;
+    if (!DecodeRAData(Reader, &DecodedRA)) {
+      return false;
+    }
+
+    std::unique_ptr<IRListView> DecodedIR;
+    auto Kind = Reader.ReadBytes(1);
+    if (!Kind) {
+      return false;
+    }
+
+    if (*Kind == KIND_COMPACT) {
+      if (!DecodeCompactIR(Reader, Pool, &DecodedIR)) {
+        return false;
+      }
+    }
+    else if (*Kind == KIND_RAW) {
+      if (!DecodeRawIR(Reader, &DecodedIR)) {
+        return false;
+      }
+    }
+    else {
+      return false;
+    }
+
+    *IR = DecodedIR.release();
+    *RA = std::move(DecodedRA);
+    return true;
+  }
+}
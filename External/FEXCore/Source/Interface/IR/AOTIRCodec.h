@@ -0,0 +1,74 @@
+#pragma once
+
+#include <FEXCore/IR/RegisterAllocationData.h>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore::IR {
+  class IRListView;
+
+  /**
+   * @brief Pool of op shapes and block bodies shared by every entry of an AOTIR file
+   *
+   * A shape is an op with its SSA arguments cut out: the op header followed by the non-SSA payload.
+   * Constants, flags and sizes repeat a lot, so entries only store an index in to the pool.
+   */
+  class AOTIRPoolBuilder final {
+  public:
+    uint32_t Intern(std::string_view Shape);
+
+    size_t Count() const {
+      return Items.size();
+    }
+
+    /**
+     * @brief Writes the pool as it is laid out in the file
+     *
+     * `uint32_t Offsets[Count + 1]` relative to the end of the table, followed by the shapes back to back.
+     */
+    void Serialize(std::ostream &stream) const;
+
+  private:
+    std::unordered_map<std::string, uint32_t> Indices;
+    // Views in to the keys of Indices
+    std::vector<std::string_view> Items;
+  };
+
+  struct AOTIRPoolView {
+    uint32_t const *Offsets;
+    uint64_t Count;
+    uint8_t const *Data;
+    uint64_t DataSize;
+  };
+
+  /**
+   * @brief Appends the encoded form of an entry's IR and RA data to Out
+   *
+   * Node IDs and everything that refers to them are kept as is, only the representation shrinks:
+   * - RA map is run length encoded
+   * - List links are LEB128 deltas from their neighbouring nodes
+   * - SSA arguments are LEB128 distances back from the node using them, so identical code encodes identically anywhere
+   * - Block arguments are block indices relative to the block using them
+   * - Op headers and payloads go in to the pool, with guest offsets from the entry point made relative to their block
+   * - Each block body goes in to the pool as well, entries overlapping the same blocks share them
+   *
+   * IR that doesn't fit these assumptions is stored raw.
+   */
+  void EncodeAOTIREntry(std::string &Out, IRListView const *IR, RegisterAllocationData const *RA, AOTIRPoolBuilder *Pool);
+
+  /**
+   * @brief Decodes an entry back in to the regular in-memory layout
+   *
+   * @param Begin Start of the encoded entry
+   * @param End Nothing past this is read, even for corrupt data
+   *
+   * @return false if the entry is corrupt
+   */
+  bool DecodeAOTIREntry(uint8_t const *Begin, uint8_t const *End, AOTIRPoolView const &Pool,
+                        IRListView **IR, RegisterAllocationData::UniquePtr *RA);
+}
@@ -91,6 +91,8 @@ static void PrintArg(std::stringstream *out, [[maybe_unused]] IRListView const*
     *out << "FPRFixed";
   else if (Arg == GPRPairClass.Val)
     *out << "GPRPair";
+  else if (Arg == FPRPairClass.Val)
+    *out << "FPRPair";
   else
     *out << "Unknown Registerclass " << Arg;
 }
@@ -112,6 +114,7 @@ static void PrintArg(std::stringstream *out, IRListView const* IR, OrderedNodeWr
         case FEXCore::IR::FPRClass.Val: *out << "(FPR"; break;
         case FEXCore::IR::FPRFixedClass.Val: *out << "(FPRFixed"; break;
         case FEXCore::IR::GPRPairClass.Val: *out << "(GPRPair"; break;
+        case FEXCore::IR::FPRPairClass.Val: *out << "(FPRPair"; break;
         case FEXCore::IR::ComplexClass.Val: *out << "(Complex"; break;
         case FEXCore::IR::InvalidClass.Val: *out << "(Invalid"; break;
         default: *out << "(Unknown"; break;
@@ -253,6 +256,7 @@ void Dump(std::stringstream *out, IRListView const* IR, IR::RegisterAllocationDa
               case FEXCore::IR::FPRClass.Val: *out << "(FPR"; break;
               case FEXCore::IR::FPRFixedClass.Val: *out << "(FPRFixed"; break;
               case FEXCore::IR::GPRPairClass.Val: *out << "(GPRPair"; break;
+              case FEXCore::IR::FPRPairClass.Val: *out << "(FPRPair"; break;
               case FEXCore::IR::ComplexClass.Val: *out << "(Complex"; break;
               case FEXCore::IR::InvalidClass.Val: *out << "(Invalid"; break;
               default: *out << "(Unknown"; break;
@@ -97,6 +97,7 @@ FEXCore::IR::RegisterClassType IREmitter::WalkFindRegClass(OrderedNode *Node) {
 
 void IREmitter::ResetWorkingList() {
   DualListData.Reset();
+  RemovedNodes = 0;
   CodeBlocks.clear();
   CurrentWriteCursor = nullptr;
   // This is necessary since we do "null" pointer checks
@@ -159,6 +160,7 @@ void IREmitter::Remove(OrderedNode *Node) {
   RemoveArgUses(Node);
 
   Node->Unlink(DualListData.ListBegin());
+  ++RemovedNodes;
 }
 
 IREmitter::IRPair<IROp_CodeBlock> IREmitter::CreateNewCodeBlockAfter(OrderedNode* insertAfter) {
@@ -171,6 +171,9 @@ class IRParser: public FEXCore::IR::IREmitter {
     else if (Arg == "GPRPair") {
       return {DecodeFailure::DECODE_OKAY, FEXCore::IR::GPRPairClass};
     }
+    else if (Arg == "FPRPair") {
+      return {DecodeFailure::DECODE_OKAY, FEXCore::IR::FPRPairClass};
+    }
     else if (Arg == "Complex") {
       return {DecodeFailure::DECODE_OKAY, FEXCore::IR::ComplexClass};
     }
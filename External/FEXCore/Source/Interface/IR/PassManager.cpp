@@ -10,10 +10,15 @@ $end_info$
 #include "Interface/IR/PassManager.h"
 #include "Interface/IR/Passes.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
+#include "Utils/ScratchArena.h"
 
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IREmitter.h>
 #include <FEXCore/Utils/Profiler.h>
 
+#include <chrono>
+
 namespace FEXCore::IR {
 class IREmitter;
 
@@ -21,22 +26,27 @@ void PassManager::AddDefaultPasses(FEXCore::Context::Context *ctx, bool InlineCo
   FEX_CONFIG_OPT(DisablePasses, O0);
 
   if (!DisablePasses()) {
-    InsertPass(CreateContextLoadStoreElimination(ctx->HostFeatures.SupportsAVX));
+    InsertPass(CreateContextLoadStoreElimination(ctx->HostFeatures.SupportsAVX), "RCLSE");
 
     if (Is64BitMode()) {
       // This needs to run after RCLSE
       // This only matters for 64-bit code since these instructions don't exist in 32-bit
-      InsertPass(CreateLongDivideEliminationPass());
+      InsertPass(CreateLongDivideEliminationPass(), "LongDivideElimination");
     }
 
-    InsertPass(CreateDeadStoreElimination(ctx->HostFeatures.SupportsAVX));
-    InsertPass(CreatePassDeadCodeElimination());
-    InsertPass(CreateConstProp(InlineConstants, ctx->HostFeatures.SupportsTSOImm9));
+    InsertPass(CreateDeadStoreElimination(ctx->HostFeatures.SupportsAVX), "DSE");
+    InsertPass(CreatePassDeadCodeElimination(), "DCE");
+    InsertPass(CreateConstProp(InlineConstants, ctx->HostFeatures.SupportsTSOImm9), "ConstProp");
 
     ////// InsertPass(CreateDeadFlagCalculationEliminination());
 
-    InsertPass(CreateSyscallOptimization());
-    InsertPass(CreatePassDeadCodeElimination());
+    InsertPass(CreateSyscallOptimization(), "SyscallOptimization");
+    InsertPass(CreatePassDeadCodeElimination(), "DCE2");
+
+    if (ctx->Config.TSOEnabled() && !ctx->Config.ParanoidTSO()) {
+      // Needs to run after DCE so removed nodes don't split up runs of TSO accesses
+      InsertPass(CreateTSOBarrierCoalescing(), "TSOBarrierCoalescing");
+    }
   }
 
   // If the IR is compacted post-RA then the node indexing gets messed up and the backend isn't able to find the register assigned to a node
@@ -53,16 +63,47 @@ void PassManager::AddDefaultValidationPasses() {
 #endif
 }
 
-void PassManager::InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAVX) {
-  InsertPass(IR::CreateRegisterAllocationPass(GetPass("Compaction"), OptimizeSRA, SupportsAVX), "RA");
+void PassManager::InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAVX, bool PairAVX) {
+  InsertPass(IR::CreateRegisterAllocationPass(GetPass("Compaction"), OptimizeSRA, SupportsAVX, PairAVX), "RA");
+}
+
+std::pmr::memory_resource *PassManager::GetScratchResource() const {
+  if (Scratch) {
+    return Scratch;
+  }
+
+  // Users without a compilation thread, fall back to the heap
+  return std::pmr::get_default_resource();
+}
+
+void PassManager::RegisterRuntimeStats(FEXCore::Core::RuntimeStats *_Stats) {
+  Stats = _Stats;
+  Stats->Passes = std::vector<FEXCore::Core::PassRuntimeStats>(Passes.size());
+  for (size_t i = 0; i < Passes.size(); ++i) {
+    Stats->Passes[i].Name = PassNames[i];
+  }
 }
 
 bool PassManager::Run(IREmitter *IREmit) {
   FEXCORE_PROFILE_SCOPED("PassManager::Run");
 
   bool Changed = false;
-  for (auto const &Pass : Passes) {
-    Changed |= Pass->Run(IREmit);
+  for (size_t i = 0; i < Passes.size(); ++i) {
+    if (!Stats) {
+      Changed |= Passes[i]->Run(IREmit);
+      continue;
+    }
+
+    const auto NodesIn = IREmit->GetLiveNodeCount();
+    const auto Begin = std::chrono::steady_clock::now();
+
+    Changed |= Passes[i]->Run(IREmit);
+
+    const auto Elapsed = std::chrono::steady_clock::now() - Begin;
+    auto &PassStats = Stats->Passes[i];
+    PassStats.TimeNS.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed).count(), std::memory_order_relaxed);
+    PassStats.NodesIn.fetch_add(NodesIn, std::memory_order_relaxed);
+    PassStats.NodesOut.fetch_add(IREmit->GetLiveNodeCount(), std::memory_order_relaxed);
   }
 
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
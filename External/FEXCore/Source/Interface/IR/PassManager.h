@@ -11,6 +11,8 @@ $end_info$
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -18,6 +20,14 @@ namespace FEXCore::HLE {
 class SyscallHandler;
 }
 
+namespace FEXCore::Core {
+struct RuntimeStats;
+}
+
+namespace FEXCore::Utils {
+class ScratchArena;
+}
+
 namespace FEXCore::IR {
 class PassManager;
 class IREmitter;
@@ -42,17 +52,19 @@ class PassManager final {
 public:
   void AddDefaultPasses(FEXCore::Context::Context *ctx, bool InlineConstants, bool StaticRegisterAllocation);
   void AddDefaultValidationPasses();
-  Pass* InsertPass(std::unique_ptr<Pass> Pass, std::string Name = "") {
+  /**
+   * @param Name Looks the pass up with GetPass and names it in the runtime stats
+   */
+  Pass* InsertPass(std::unique_ptr<Pass> Pass, std::string Name) {
     Pass->RegisterPassManager(this);
     auto PassPtr = Passes.emplace_back(std::move(Pass)).get();
+    PassNames.emplace_back(Name);
 
-    if (!Name.empty()) {
-      NameToPassMaping[Name] = PassPtr;
-    }
+    NameToPassMaping[std::move(Name)] = PassPtr;
     return PassPtr;
   }
 
-  void InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAVX);
+  void InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAVX, bool PairAVX);
 
   bool Run(IREmitter *IREmit);
 
@@ -77,12 +89,33 @@ public:
     SyscallHandler = Handler;
   }
 
+  void RegisterScratchArena(FEXCore::Utils::ScratchArena *Arena) {
+    Scratch = Arena;
+  }
+
+  /**
+   * @brief Accumulates the time and IR size of every pass in to Stats
+   *
+   * Needs to happen after the last pass is inserted.
+   */
+  void RegisterRuntimeStats(FEXCore::Core::RuntimeStats *Stats);
+
+  /**
+   * @brief Memory resource for pass data that doesn't outlive a single compilation
+   *
+   * Anything allocated from here needs to be released before the pass returns.
+   */
+  std::pmr::memory_resource *GetScratchResource() const;
+
 protected:
   ShouldExitHandler ExitHandler;
   FEXCore::HLE::SyscallHandler *SyscallHandler;
+  FEXCore::Utils::ScratchArena *Scratch{};
+  FEXCore::Core::RuntimeStats *Stats{};
 
 private:
   std::vector<std::unique_ptr<Pass>> Passes;
+  std::vector<std::string> PassNames;
   std::unordered_map<std::string, Pass*> NameToPassMaping;
 
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
@@ -20,8 +20,10 @@ std::unique_ptr<FEXCore::IR::Pass> CreatePassDeadCodeElimination();
 std::unique_ptr<FEXCore::IR::Pass> CreateIRCompaction(FEXCore::Utils::IntrusivePooledAllocator &Allocator);
 std::unique_ptr<FEXCore::IR::RegisterAllocationPass> CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass,
                                                                                   bool OptimizeSRA,
-                                                                                  bool SupportsAVX);
+                                                                                  bool SupportsAVX,
+                                                                                  bool PairAVX);
 std::unique_ptr<FEXCore::IR::Pass> CreateLongDivideEliminationPass();
+std::unique_ptr<FEXCore::IR::Pass> CreateTSOBarrierCoalescing();
 
 namespace Validation {
 std::unique_ptr<FEXCore::IR::Pass> CreateIRValidation();
@@ -26,6 +26,7 @@ $end_info$
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <string.h>
 #include <tuple>
 #include <unordered_map>
@@ -196,13 +197,12 @@ private:
       OrderedNode* CodeNode, IROp_Header* IROp);
   bool ConstantInlining(IREmitter *IREmit, const IRListView& CurrentIR);
 
-  std::unordered_map<uint64_t, OrderedNode*> ConstPool;
-  std::map<OrderedNode*, uint64_t> AddressgenConsts;
   bool SupportsTSOImm9{};
 };
 
 bool ConstProp::HandleConstantPools(IREmitter *IREmit, const IRListView& CurrentIR) {
   bool Changed = false;
+  std::pmr::unordered_map<uint64_t, OrderedNode*> ConstPool {Manager->GetScratchResource()};
 
   // constants are pooled per block
   for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
@@ -311,6 +311,8 @@ void ConstProp::FCMPOptimization(IREmitter *IREmit, const IRListView& CurrentIR)
 // LoadMem / StoreMem imm pooling
 // If imms are close by, use address gen to generate the values instead of using a new imm
 void ConstProp::LoadMemStoreMemImmediatePooling(IREmitter *IREmit, const IRListView& CurrentIR) {
+  std::pmr::map<OrderedNode*, uint64_t> AddressgenConsts {Manager->GetScratchResource()};
+
   for (auto [BlockNode, BlockIROp] : CurrentIR.GetBlocks()) {
     for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
       if (IROp->Op == OP_LOADMEM || IROp->Op == OP_STOREMEM) {
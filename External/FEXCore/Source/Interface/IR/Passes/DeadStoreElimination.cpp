@@ -15,6 +15,7 @@ $end_info$
 #include <FEXCore/Utils/Profiler.h>
 
 #include <memory>
+#include <memory_resource>
 #include <stddef.h>
 #include <stdint.h>
 #include <unordered_map>
@@ -157,7 +158,7 @@ struct Info {
 bool DeadStoreElimination::Run(IREmitter *IREmit) {
   FEXCORE_PROFILE_SCOPED("PassManager::DSE");
 
-  std::unordered_map<OrderedNode*, Info> InfoMap;
+  std::pmr::unordered_map<OrderedNode*, Info> InfoMap {Manager->GetScratchResource()};
 
   bool Changed = false;
   auto CurrentIR = IREmit->ViewIR();
@@ -27,6 +27,7 @@ struct RegState {
   // 2. If the GPRFixed class is used, there will be 16 GPRs and 16 FixedGPRs max
   // 3. Same with FPRFixed
   // 4. If the GPRPairClass is used, it is assumed each GPRPair N will map onto GPRs N*2 and N*2 + 1
+  // 5. Same with FPRPairClass and FPRs
 
   // These assumptions were all true for the state of the arm64 and x86 jits at the time this was written
 
@@ -59,6 +60,13 @@ struct RegState {
         return true;
       }
       break;
+    case FPRPairClass:
+      if (Reg.Reg < 16) {
+        FPRs[Reg.Reg*2] = ssa;
+        FPRs[Reg.Reg*2 + 1] = ssa;
+        return true;
+      }
+      break;
     }
     return false;
   }
@@ -90,6 +98,14 @@ struct RegState {
         return GPRs[Reg.Reg*2];
       }
       return CorruptedPair;
+    case FPRPairClass:
+      if (Reg.Reg >= 16)
+        break;
+
+      if (FPRs[Reg.Reg*2] == FPRs[Reg.Reg*2 + 1]) {
+        return FPRs[Reg.Reg*2];
+      }
+      return CorruptedPair;
     }
     return InvalidReg;
   }
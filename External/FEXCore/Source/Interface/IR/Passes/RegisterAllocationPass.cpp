@@ -6,6 +6,8 @@ $end_info$
 
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/Passes.h"
+#include "Interface/IR/PassManager.h"
+#include "Utils/ScratchArena.h"
 #include <FEXCore/Core/CoreState.h>
 #include <FEXCore/Core/SignalDelegator.h>
 #include <FEXCore/IR/IR.h>
@@ -23,6 +25,7 @@ $end_info$
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <strings.h>
@@ -96,14 +99,19 @@ namespace {
     std::vector<RegisterNode> Nodes{};
     uint32_t NodeCount{};
     std::vector<SpillStackUnit> SpillStack;
-    std::unordered_map<IR::NodeID, std::unordered_set<IR::NodeID>> BlockPredecessors;
-    std::unordered_map<IR::NodeID, std::unordered_set<IR::NodeID>> VisitedNodePredecessors;
+    // Pulled from the compilation scratch arena, released at the end of each run
+    using PredecessorMap = std::pmr::unordered_map<IR::NodeID, std::pmr::unordered_set<IR::NodeID>>;
+    PredecessorMap BlockPredecessors;
+    PredecessorMap VisitedNodePredecessors;
   };
 
   void ResetRegisterGraph(RegisterGraph *Graph, uint64_t NodeCount);
 
-  RegisterGraph *AllocateRegisterGraph(uint32_t ClassCount) {
-    RegisterGraph *Graph = new RegisterGraph{};
+  RegisterGraph *AllocateRegisterGraph(uint32_t ClassCount, std::pmr::memory_resource *Scratch) {
+    RegisterGraph *Graph = new RegisterGraph{
+      .BlockPredecessors = RegisterGraph::PredecessorMap(Scratch),
+      .VisitedNodePredecessors = RegisterGraph::PredecessorMap(Scratch),
+    };
 
     // Allocate the register set
     Graph->Set.ClassCount = ClassCount;
@@ -269,7 +277,7 @@ namespace {
 
   class ConstrainedRAPass final : public RegisterAllocationPass {
     public:
-      ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool OptimizeSRA, bool SupportsAVX);
+      ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool OptimizeSRA, bool SupportsAVX, bool PairAVX);
       ~ConstrainedRAPass();
       bool Run(IREmitter *IREmit) override;
 
@@ -296,6 +304,11 @@ namespace {
       FEXCore::IR::Pass* CompactionPass;
       bool OptimizeSRA;
       bool SupportsAVX;
+      // 256-bit vectors live in pairs of 128-bit host registers
+      bool PairAVX;
+
+      // Nodes of 256-bit vectors that get a FPRPair, indexed by SSA id
+      std::vector<bool> PairedNodes;
 
       std::vector<LiveRange> LiveRanges;
 
@@ -317,6 +330,9 @@ namespace {
 
       void SpillOne(FEXCore::IR::IREmitter *IREmit);
 
+      void FindPairedNodes(FEXCore::IR::IRListView *IR);
+      FEXCore::IR::RegisterClassType GetNodeRegClass(FEXCore::IR::IRListView *IR, IR::NodeID Node);
+
       void CalculateLiveRange(FEXCore::IR::IRListView *IR);
       void OptimizeStaticRegisters(FEXCore::IR::IRListView *IR);
       void CalculateBlockInterferences(FEXCore::IR::IRListView *IR);
@@ -327,8 +343,8 @@ namespace {
       void RecursiveLiveRangeExpansion(FEXCore::IR::IRListView *IR,
                                        IR::NodeID Node, IR::NodeID DefiningBlockID,
                                        LiveRange *LiveRange,
-                                       const std::unordered_set<IR::NodeID> &Predecessors,
-                                       std::unordered_set<IR::NodeID> &VisitedPredecessors);
+                                       const std::pmr::unordered_set<IR::NodeID> &Predecessors,
+                                       std::pmr::unordered_set<IR::NodeID> &VisitedPredecessors);
 
       FEXCore::IR::AllNodesIterator FindFirstUse(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End);
       FEXCore::IR::AllNodesIterator FindLastUseBefore(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End);
@@ -343,8 +359,8 @@ namespace {
       bool RunAllocateVirtualRegisters(IREmitter *IREmit);
   };
 
-  ConstrainedRAPass::ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool _OptimizeSRA, bool _SupportsAVX)
-    : CompactionPass {_CompactionPass}, OptimizeSRA(_OptimizeSRA), SupportsAVX{_SupportsAVX} {
+  ConstrainedRAPass::ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool _OptimizeSRA, bool _SupportsAVX, bool _PairAVX)
+    : CompactionPass {_CompactionPass}, OptimizeSRA(_OptimizeSRA), SupportsAVX{_SupportsAVX}, PairAVX{_PairAVX} {
   }
 
   ConstrainedRAPass::~ConstrainedRAPass() {
@@ -355,7 +371,7 @@ namespace {
     LOGMAN_THROW_AA_FMT(RegisterCount <= INVALID_REG, "Up to {} regs supported", INVALID_REG);
     LOGMAN_THROW_AA_FMT(ClassCount <= INVALID_CLASS, "Up to {} classes supported", INVALID_CLASS);
 
-    Graph = AllocateRegisterGraph(ClassCount);
+    Graph = AllocateRegisterGraph(ClassCount, Manager->GetScratchResource());
 
     // Add identity conflicts
     for (uint32_t Class = 0; Class < INVALID_CLASS; Class++) {
@@ -386,8 +402,8 @@ namespace {
   void ConstrainedRAPass::RecursiveLiveRangeExpansion(IR::IRListView *IR,
                                                       IR::NodeID Node, IR::NodeID DefiningBlockID,
                                                       LiveRange *LiveRange,
-                                                      const std::unordered_set<IR::NodeID> &Predecessors,
-                                                      std::unordered_set<IR::NodeID> &VisitedPredecessors) {
+                                                      const std::pmr::unordered_set<IR::NodeID> &Predecessors,
+                                                      std::pmr::unordered_set<IR::NodeID> &VisitedPredecessors) {
     for (auto PredecessorId: Predecessors) {
       if (DefiningBlockID != PredecessorId && !VisitedPredecessors.contains(PredecessorId)) {
         // do the magic
@@ -557,14 +573,16 @@ namespace {
     };
 
     // Is an OP_LOADREGISTER eligible to read directly from the SRA reg?
-    auto IsAliasable = [](uint8_t Size, RegisterClassType StaticClass, uint32_t Offset) {
+    auto IsAliasable = [this](IR::NodeID Node, uint8_t Size, RegisterClassType StaticClass, uint32_t Offset) {
       LOGMAN_THROW_A_FMT(StaticClass == GPRFixedClass || StaticClass == FPRFixedClass, "Unexpected static class {}", StaticClass);
       if (StaticClass == GPRFixedClass) {
         // We need more meta info to support not-size-of-reg
         return (Size == 8 /*|| Size == 4*/) && ((Offset & 7) == 0);
       } else if (StaticClass == FPRFixedClass) {
+        // With paired AVX the SRA reg holds the lower half, 256-bit reads that never use the upper half can alias it
+        const bool LowerHalfOnly = PairAVX && Size == Core::CPUState::XMM_AVX_REG_SIZE && !PairedNodes[Node.Value];
         // We need more meta info to support not-size-of-reg
-        return (Size == 16 /*|| Size == 8 || Size == 4*/) && ((Offset & 15) == 0);
+        return (Size == 16 || LowerHalfOnly /*|| Size == 8 || Size == 4*/) && ((Offset & 15) == 0);
       }
       return false; // Unknown
     };
@@ -703,8 +721,7 @@ namespace {
           if (ArgNodeLiveRange.Written) {
             SRA_DEBUG("Demoting ssa{} because accessed after write in ssa{}\n", ArgNode, Node);
             ArgNodeLiveRange.PrefferedRegister = PhysicalRegister::Invalid();
-            auto ArgNodeNode = IR->GetNode(Arg);
-            SetNodeClass(Graph, ArgNode, GetRegClassFromNode(IR, ArgNodeNode->Op(IR->GetData())));
+            SetNodeClass(Graph, ArgNode, GetNodeRegClass(IR, ArgNode));
           }
         }
 
@@ -739,13 +756,13 @@ namespace {
                         ID, Node, -1 /*vreg*/);
               (*StaticMap)->PrefferedRegister = PhysicalRegister::Invalid();
               (*StaticMap)->PreWritten.Invalidate();
-              SetNodeClass(Graph, ID, Op->Class);
+              SetNodeClass(Graph, ID, GetNodeRegClass(IR, ID));
             }
 
             // if not sra-allocated and full size, sra-allocate
             if (!NodeLiveRange.Global && NodeLiveRange.PrefferedRegister.IsInvalid()) {
               // only full size reads can be aliased
-              if (IsAliasable(IROp->Size, Op->StaticClass, Op->Offset)) {
+              if (IsAliasable(Node, IROp->Size, Op->StaticClass, Op->Offset)) {
                 // We can only track a single active span.
                 // Marking here as written is overly agressive, but
                 // there might be write(s) later on the instruction stream
@@ -903,6 +920,8 @@ namespace {
     const auto GetClass = [](PhysicalRegister PhyReg) {
       if (PhyReg.Class == IR::GPRPairClass.Val)
         return IR::GPRClass.Val;
+      else if (PhyReg.Class == IR::FPRPairClass.Val)
+        return IR::FPRClass.Val;
       else
         return (uint32_t)PhyReg.Class;
     };
@@ -1288,7 +1307,7 @@ namespace {
     // Heuristics failed to spill ?
     if (InterferenceIdToSpill.IsInvalid()) {
       // Panic spill: Spill any value not used by the current op
-      std::set<IR::NodeID> CurrentNodes;
+      std::pmr::set<IR::NodeID> CurrentNodes {Manager->GetScratchResource()};
 
       // Get all used nodes for current IR op
       {
@@ -1412,7 +1431,11 @@ namespace {
       // If we didn't remat a constant then we need to do some real spilling
       if (!Spilled) {
         if (const auto InterferenceNode = FindNodeToSpill(IREmit, CurrentNode, Node, OpLiveRange)) {
-          const auto InterferenceRegClass = IR::RegisterClassType{Graph->AllocData->Map[InterferenceNode->Value].Class};
+          auto InterferenceRegClass = IR::RegisterClassType{Graph->AllocData->Map[InterferenceNode->Value].Class};
+          if (InterferenceRegClass == IR::FPRPairClass) {
+            // Pairs are an allocation detail, the spill and fill carry the 256-bit size instead
+            InterferenceRegClass = IR::FPRClass;
+          }
           const uint32_t SpillSlot = FindSpillSlot(*InterferenceNode, InterferenceRegClass);
 
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
@@ -1478,6 +1501,68 @@ namespace {
     }
   }
 
+  void ConstrainedRAPass::FindPairedNodes(FEXCore::IR::IRListView *IR) {
+    // A 256-bit value only needs both halves if something reads its upper half.
+    // Loads that are only ever consumed as 128-bit stay in a single register and skip loading the upper half.
+    std::vector<bool> NeedsUpper(IR->GetSSACount());
+
+    for (auto [CodeNode, IROp] : IR->GetAllCode()) {
+      bool ReadsUpper = IROp->Size == Core::CPUState::XMM_AVX_REG_SIZE;
+      if (IROp->Op == OP_VEXTRACTTOGPR) {
+        auto Op = IROp->C<IR::IROp_VExtractToGPR>();
+        ReadsUpper = (Op->Header.ElementSize * Op->Index) >= Core::CPUState::XMM_SSE_REG_SIZE;
+      }
+
+      if (!ReadsUpper) {
+        continue;
+      }
+
+      const uint8_t NumArgs = IR::GetArgs(IROp->Op);
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        if (!IROp->Args[i].IsInvalid()) {
+          NeedsUpper[IROp->Args[i].ID().Value] = true;
+        }
+      }
+    }
+
+    PairedNodes.assign(IR->GetSSACount(), false);
+
+    for (auto [CodeNode, IROp] : IR->GetAllCode()) {
+      const auto ID = IR->GetID(CodeNode);
+      if (!IROp->HasDest ||
+          IROp->Size != Core::CPUState::XMM_AVX_REG_SIZE ||
+          Graph->AllocData->Map[ID.Value].Class != FPRClass.Val) {
+        continue;
+      }
+
+      switch (IROp->Op) {
+        case OP_LOADREGISTER:
+        case OP_LOADCONTEXT:
+        case OP_LOADCONTEXTINDEXED:
+        case OP_LOADMEM:
+        case OP_LOADMEMTSO:
+        case OP_FILLREGISTER:
+          if (!NeedsUpper[ID.Value]) {
+            continue;
+          }
+          break;
+        default: break;
+      }
+
+      PairedNodes[ID.Value] = true;
+      SetNodeClass(Graph, ID, FPRPairClass);
+    }
+  }
+
+  FEXCore::IR::RegisterClassType ConstrainedRAPass::GetNodeRegClass(FEXCore::IR::IRListView *IR, IR::NodeID Node) {
+    if (PairAVX && PairedNodes[Node.Value]) {
+      return FPRPairClass;
+    }
+
+    auto [CodeNode, IROp] = IR->at(Node)();
+    return GetRegClassFromNode(IR, IROp);
+  }
+
   bool ConstrainedRAPass::RunAllocateVirtualRegisters(FEXCore::IR::IREmitter *IREmit) {
     using namespace FEXCore;
     bool Changed = false;
@@ -1491,6 +1576,8 @@ namespace {
 
     ResetRegisterGraph(Graph, SSACount);
     FindNodeClasses(Graph, &IR);
+    if (PairAVX)
+      FindPairedNodes(&IR);
     CalculateLiveRange(&IR);
     if (OptimizeSRA)
       OptimizeStaticRegisters(&IR);
@@ -1557,10 +1644,14 @@ namespace {
 
     Graph->AllocData->SpillSlotCount = Graph->SpillStack.size();
 
+    // Drop the scratch allocations before the arena gets reset
+    FEXCore::Utils::ReleaseScratch(Graph->BlockPredecessors);
+    FEXCore::Utils::ReleaseScratch(Graph->VisitedNodePredecessors);
+
     return Changed;
   }
 
-  std::unique_ptr<FEXCore::IR::RegisterAllocationPass> CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA, bool SupportsAVX) {
-    return std::make_unique<ConstrainedRAPass>(CompactionPass, OptimizeSRA, SupportsAVX);
+  std::unique_ptr<FEXCore::IR::RegisterAllocationPass> CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA, bool SupportsAVX, bool PairAVX) {
+    return std::make_unique<ConstrainedRAPass>(CompactionPass, OptimizeSRA, SupportsAVX, PairAVX);
   }
 }
@@ -0,0 +1,152 @@
+/*
+$info$
+tags: ir|opts
+desc: Merges and weakens the barriers between adjacent TSO vector memory accesses
+$end_info$
+*/
+
+#include "Interface/IR/PassManager.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IREmitter.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/Utils/Profiler.h>
+
+#include <memory>
+#include <stdint.h>
+
+namespace FEXCore::IR {
+
+/**
+ * @brief Removes redundant barriers from runs of TSO accesses that the backend wraps in DMBs
+ *
+ * Without a host instruction giving TSO semantics the backend emits `dmb ish` before and after
+ * every access. Two adjacent accesses then end up with two back to back full barriers between
+ * them, and x86-TSO only needs a fraction of that:
+ *  - load -> load and load -> store must stay ordered: `dmb ishld` orders all prior loads.
+ *  - store -> store must stay ordered: `dmb ishst` orders all prior stores against later stores.
+ *  - store -> load may be reordered, no barrier needed.
+ *
+ * The barrier picked between two accesses has to order every earlier access in the run that is
+ * still unordered against the next one, not only its direct neighbour.
+ * eg: `store; load; store` needs a full barrier before the second store for the two stores.
+ *
+ * The leading barrier of the first access and the trailing barrier of the last access in a run
+ * are left alone, so ordering against everything outside of the run is unchanged.
+ */
+class TSOBarrierCoalescing final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+
+private:
+  // Accesses that the backend implements with explicit barriers
+  static bool IsFencedAccess(IROp_Header const *IROp);
+  // Anything that can touch guest memory or order memory ends a run
+  static bool EndsRun(IROp_Header const *IROp);
+};
+
+bool TSOBarrierCoalescing::IsFencedAccess(IROp_Header const *IROp) {
+  switch (IROp->Op) {
+    case OP_LOADMEMTSO:
+      return IROp->C<IROp_LoadMemTSO>()->Class != GPRClass;
+    case OP_STOREMEMTSO:
+      return IROp->C<IROp_StoreMemTSO>()->Class != GPRClass;
+    default:
+      return false;
+  }
+}
+
+bool TSOBarrierCoalescing::EndsRun(IROp_Header const *IROp) {
+  switch (IROp->Op) {
+    // Host private state, never visible to other guest threads
+    case OP_STORECONTEXT:
+    case OP_STORECONTEXTINDEXED:
+    case OP_STOREREGISTER:
+    case OP_STOREFLAG:
+    case OP_SPILLREGISTER:
+    case OP_GUESTOPCODE:
+      return false;
+    // Guest memory loads without side effects
+    case OP_LOADMEM:
+    case OP_LOADMEMTSO:
+      return true;
+    default:
+      return HasSideEffects(IROp->Op);
+  }
+}
+
+bool TSOBarrierCoalescing::Run(IREmitter *IREmit) {
+  FEXCORE_PROFILE_SCOPED("PassManager::TSOBarrierCoalescing");
+
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+
+  for (auto [BlockNode, BlockIROp] : CurrentIR.GetBlocks()) {
+    IROp_Header *Previous{};
+    // Earlier accesses in the run that no barrier has ordered yet
+    bool PendingLoads{};
+    bool PendingStores{};
+
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      if (!IsFencedAccess(IROp)) {
+        if (EndsRun(IROp)) {
+          Previous = nullptr;
+        }
+        continue;
+      }
+
+      const bool IsStore = IROp->Op == OP_STOREMEMTSO;
+
+      if (Previous) {
+        uint8_t Barrier = TSO_BARRIER_NONE;
+        if (PendingLoads) {
+          Barrier |= TSO_BARRIER_LOAD;
+        }
+        if (IsStore && PendingStores) {
+          Barrier |= TSO_BARRIER_STORE;
+        }
+
+        // The trailing barrier of the previous access gets folded in to the leading barrier of this one
+        if (Previous->Op == OP_LOADMEMTSO) {
+          Previous->CW<IROp_LoadMemTSO>()->BarrierAfter = TSO_BARRIER_NONE;
+        }
+        else {
+          Previous->CW<IROp_StoreMemTSO>()->BarrierAfter = TSO_BARRIER_NONE;
+        }
+
+        if (IsStore) {
+          IROp->CW<IROp_StoreMemTSO>()->BarrierBefore = Barrier;
+        }
+        else {
+          IROp->CW<IROp_LoadMemTSO>()->BarrierBefore = Barrier;
+        }
+
+        if (Barrier & TSO_BARRIER_LOAD) {
+          PendingLoads = false;
+        }
+        if (Barrier & TSO_BARRIER_STORE) {
+          PendingStores = false;
+        }
+
+        Changed = true;
+      }
+      else {
+        // Start of a run, the leading barrier orders everything before it
+        PendingLoads = false;
+        PendingStores = false;
+      }
+
+      PendingLoads |= !IsStore;
+      PendingStores |= IsStore;
+      Previous = IROp;
+    }
+  }
+
+  return Changed;
+}
+
+std::unique_ptr<FEXCore::IR::Pass> CreateTSOBarrierCoalescing() {
+  return std::make_unique<TSOBarrierCoalescing>();
+}
+
+}
@@ -18,6 +18,8 @@
 #include <memory>
 #include <mutex>
 #include <new>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <sys/mman.h>
 #include <sys/utsname.h>
@@ -68,14 +70,22 @@ namespace Alloc::OSAllocator {
 
       struct LiveVMARegion {
         ReservedVMARegion *SlabInfo;
+        // Guards everything below along with the host mappings in this region.
+        // Only taken while holding AllocationMutex, which has already masked signals.
+        std::mutex *RegionMutex;
         uint64_t FreeSpace{};
         uint64_t NumManagedPages{};
         uint32_t LastPageAllocation{};
         bool HadMunmap{};
 
+        using FlexBitElementType = uint64_t;
+
+        // Summary of UsedPages, one bit per element that has all of its pages used.
+        // Lives in the tracking data right after UsedPages.
+        FEXCore::FlexBitSet<FlexBitElementType> *FullElements;
+
         // Align UsedPages so it pads to the next page.
         // Necessary to take advantage of madvise zero page pooling.
-        using FlexBitElementType = uint64_t;
         alignas(4096) FEXCore::FlexBitSet<FlexBitElementType> UsedPages;
 
         // This returns the size of the LiveVMARegion in addition to the flex set that tracks the used data
@@ -88,8 +98,14 @@ namespace Alloc::OSAllocator {
           // 0x100'0000 Pages
           // 1 bit per page for tracking means 0x20'0000 (Pages / 8) bytes of flex space
           // Which is 2MB of tracking
+          // Plus 1 bit per 64 pages for the summary, 32KB
+          return sizeof(LiveVMARegion) + GetUsedPagesSize(Size) +
+            FEXCore::FlexBitSet<FlexBitElementType>::SummarySize(Size >> FHU::FEX_PAGE_SHIFT);
+        }
+
+        static size_t GetUsedPagesSize(size_t Size) {
           uint64_t NumElements = (Size >> FHU::FEX_PAGE_SHIFT) * sizeof(FlexBitElementType);
-          return sizeof(LiveVMARegion) + FEXCore::FlexBitSet<FlexBitElementType>::Size(NumElements);
+          return FEXCore::FlexBitSet<FlexBitElementType>::Size(NumElements);
         }
 
         static void InitializeVMARegionUsed(LiveVMARegion *Region, size_t AdditionalSize) {
@@ -109,8 +125,11 @@ namespace Alloc::OSAllocator {
           // Improves performance of the following MemClear by not doing a page level fault dance for data necessary to track >170TB of used pages.
           ::madvise(Region->UsedPages.Memory, ManagedSize, MADV_WILLNEED);
 
+          Region->FullElements = reinterpret_cast<FEXCore::FlexBitSet<FlexBitElementType>*>(
+            reinterpret_cast<uint8_t*>(Region->UsedPages.Memory) + GetUsedPagesSize(Region->SlabInfo->RegionSize));
+
           // Set our reserved pages
-          Region->UsedPages.MemSet(NumManagedPages);
+          Region->UsedPages.SetRange(0, NumManagedPages, Region->FullElements);
           Region->LastPageAllocation = NumManagedPages;
           Region->NumManagedPages = NumManagedPages;
         }
@@ -127,7 +146,9 @@ namespace Alloc::OSAllocator {
       LiveRegionListType *LiveRegions{};
 
       Alloc::ForwardOnlyIntrusiveArenaAllocator *ObjectAlloc{};
-      std::mutex AllocationMutex{};
+      // Unique while the region lists change, which only happens when a reserved region goes live.
+      // Everything else walks the lists with it shared and takes the region's own mutex.
+      std::shared_mutex AllocationMutex{};
       void DetermineVASize();
 
       LiveVMARegion *MakeRegionActive(ReservedRegionListType::iterator ReservedIterator, uint64_t UsedSize) {
@@ -147,6 +168,7 @@ namespace Alloc::OSAllocator {
 
         // Copy over the reserved data
         LiveRange->SlabInfo = ReservedRegion;
+        LiveRange->RegionMutex = ObjectAlloc->new_construct<std::mutex>();
 
         // Initialize VMA
         LiveVMARegion::InitializeVMARegionUsed(LiveRange, UsedSize);
@@ -160,7 +182,12 @@ namespace Alloc::OSAllocator {
       std::vector<FEXCore::Allocator::MemoryRegion> Steal32BitIfOldKernel();
 
       void AllocateMemoryRegions(std::vector<FEXCore::Allocator::MemoryRegion> const &Ranges);
-      LiveVMARegion *FindLiveRegionForAddress(uintptr_t Addr, uintptr_t AddrEnd);
+      LiveVMARegion *FindLiveRegionForAddress(uintptr_t Addr);
+      ReservedRegionListType::iterator FindReservedRegionForAddress(uintptr_t Addr, uintptr_t AddrEnd);
+
+      void *MapInRegion(LiveVMARegion *Region, size_t length, int prot, int flags, int fd, off_t offset, uintptr_t RequiredAddr = 0);
+      std::optional<void*> MmapInLiveRegions(uintptr_t Addr, size_t length, int prot, int flags, int fd, off_t offset);
+      bool MakeRegionActiveFor(uintptr_t Addr, size_t length, size_t SeenLiveRegions);
   };
 
 void OSAllocator_64Bit::DetermineVASize() {
@@ -176,9 +203,7 @@ void OSAllocator_64Bit::DetermineVASize() {
   UPPER_BOUND_PAGE = UPPER_BOUND / FHU::FEX_PAGE_SIZE;
 }
 
-OSAllocator_64Bit::LiveVMARegion *OSAllocator_64Bit::FindLiveRegionForAddress(uintptr_t Addr, uintptr_t AddrEnd) {
-  LiveVMARegion *LiveRegion{};
-
+OSAllocator_64Bit::LiveVMARegion *OSAllocator_64Bit::FindLiveRegionForAddress(uintptr_t Addr) {
   // Check active slabs to see if we can fit this
   for (auto it = LiveRegions->begin(); it != LiveRegions->end(); ++it) {
     uintptr_t RegionBegin = (*it)->SlabInfo->Base;
@@ -186,228 +211,239 @@ OSAllocator_64Bit::LiveVMARegion *OSAllocator_64Bit::FindLiveRegionForAddress(ui
 
     if (Addr >= RegionBegin &&
         Addr < RegionEnd) {
-      LiveRegion = *it;
-      // Leave our loop
-      break;
+      return *it;
     }
   }
 
-  // Couldn't find an active region that fit
-  // Check reserved regions
-  if (!LiveRegion) {
-    // Didn't have a slab that fit this range
-    // Check our reserved regions to see if we have one that fits
-    for (auto it = ReservedRegions->begin(); it != ReservedRegions->end(); ++it) {
-      ReservedVMARegion *ReservedRegion = *it;
-      uintptr_t RegionEnd = ReservedRegion->Base + ReservedRegion->RegionSize;
-      if (Addr >= ReservedRegion->Base &&
-          AddrEnd < RegionEnd) {
-        // Found one, let's make it active
-        LiveRegion = MakeRegionActive(it, 0);
-        break;
-      }
-    }
-  }
+  return nullptr;
+}
 
-  return LiveRegion;
+OSAllocator_64Bit::ReservedRegionListType::iterator OSAllocator_64Bit::FindReservedRegionForAddress(uintptr_t Addr, uintptr_t AddrEnd) {
+  return std::find_if(ReservedRegions->begin(), ReservedRegions->end(), [Addr, AddrEnd](ReservedVMARegion *ReservedRegion) {
+    uintptr_t RegionEnd = ReservedRegion->Base + ReservedRegion->RegionSize;
+    return Addr >= ReservedRegion->Base &&
+           AddrEnd < RegionEnd;
+  });
 }
 
-void *OSAllocator_64Bit::Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) {
-  if (addr != 0 &&
-      addr < reinterpret_cast<void*>(LOWER_BOUND)) {
-    // If we are asked to allocate something outside of the 64-bit space
-    // Then we need to just hand this to the OS
-    return ::mmap(addr, length, prot, flags, fd, offset);
-  }
+void *OSAllocator_64Bit::MapInRegion(LiveVMARegion *Region, size_t length, int prot, int flags, int fd, off_t offset, uintptr_t RequiredAddr) {
+  std::lock_guard lk(*Region->RegionMutex);
 
-  uint64_t Addr = reinterpret_cast<uint64_t>(addr);
-  // Addr must be page aligned
-  if (Addr & ~FHU::FEX_PAGE_MASK) {
-    return reinterpret_cast<void*>(-EINVAL);
+  if (Region->FreeSpace < length) {
+    return nullptr;
   }
 
-  // If FD is provided then offset must also be page aligned
-  if (fd != -1 &&
-      offset & ~FHU::FEX_PAGE_MASK) {
-    return reinterpret_cast<void*>(-EINVAL);
-  }
+  uint64_t AllocatedPage{~0ULL};
+  uint64_t NumberOfPages = length >> FHU::FEX_PAGE_SHIFT;
+  size_t RegionNumberOfPages = Region->SlabInfo->RegionSize >> FHU::FEX_PAGE_SHIFT;
 
-  // 64bit address overflow
-  if (Addr + length < Addr) {
-    return reinterpret_cast<void*>(-EOVERFLOW);
+  if (RequiredAddr) {
+    // Only the range at the address will do, limit the scan so it doesn't look past it
+    uint64_t RequiredPage = (RequiredAddr - Region->SlabInfo->Base) >> FHU::FEX_PAGE_SHIFT;
+    auto SearchResult = Region->UsedPages.ForwardScanForRange<true>(RequiredPage, NumberOfPages,
+      std::min<size_t>(RequiredPage + NumberOfPages + 1, RegionNumberOfPages));
+    AllocatedPage = SearchResult.FoundElement;
   }
+  else {
+    uint64_t LastAllocation = Region->LastPageAllocation;
 
-  bool Fixed = (flags & MAP_FIXED) || (flags & MAP_FIXED_NOREPLACE);
-  length = FEXCore::AlignUp(length, FHU::FEX_PAGE_SIZE);
+    if (Region->HadMunmap) {
+      // Backward scan
+      // We need to do a backward scan first to fill any holes
+      // Otherwise we will very quickly run out of VMA regions (65k maximum)
+      auto SearchResult = Region->UsedPages.BackwardScanForRange<true>(LastAllocation, NumberOfPages, Region->NumManagedPages, Region->FullElements);
 
-  uint64_t AddrEnd = Addr + length;
-  size_t NumberOfPages = length / FHU::FEX_PAGE_SIZE;
+      AllocatedPage = SearchResult.FoundElement;
 
-  // This needs a mutex to be thread safe
-  FHU::ScopedSignalMaskWithMutex lk(AllocationMutex);
+      // If we didn't even have a one page free in the backward search, then unclaim HadMunmap.
+      // Switching over to default forward search.
+      if (SearchResult.FoundElement == ~0ULL && !SearchResult.FoundHole) {
+        Region->HadMunmap = false;
+      }
+    }
 
-  uint64_t AllocatedOffset{};
-  LiveVMARegion *LiveRegion{};
+    // Foward Scan
+    if (AllocatedPage == ~0ULL) {
+      auto SearchResult = Region->UsedPages.ForwardScanForRange<true>(LastAllocation, NumberOfPages, RegionNumberOfPages, Region->FullElements);
+      AllocatedPage = SearchResult.FoundElement;
+    }
+  }
 
-  if (Fixed || Addr != 0) {
-    LiveRegion = FindLiveRegionForAddress(Addr, AddrEnd);
+  if (AllocatedPage == ~0ULL) {
+    return nullptr;
   }
 
-  again:
+  uintptr_t AllocatedOffset = Region->SlabInfo->Base + AllocatedPage * FHU::FEX_PAGE_SIZE;
 
-  auto CheckIfRangeFits = [&AllocatedOffset](LiveVMARegion *Region, uint64_t length, int prot, int flags, int fd, off_t offset, uint64_t StartingPosition = 0) -> std::pair<LiveVMARegion*, void*> {
-    uint64_t AllocatedPage{~0ULL};
-    uint64_t NumberOfPages = length >> FHU::FEX_PAGE_SHIFT;
+  // We need to setup protections for this
+  void *MMapResult = ::mmap(reinterpret_cast<void*>(AllocatedOffset),
+    length,
+    prot,
+    (flags & ~MAP_FIXED_NOREPLACE) | MAP_FIXED,
+    fd, offset);
 
-    if (Region->FreeSpace >= length) {
-      uint64_t LastAllocation =
-        StartingPosition ?
-        (StartingPosition - Region->SlabInfo->Base) >> FHU::FEX_PAGE_SHIFT
-        : Region->LastPageAllocation;
-      size_t RegionNumberOfPages = Region->SlabInfo->RegionSize >> FHU::FEX_PAGE_SHIFT;
+  if (MMapResult == MAP_FAILED) {
+    return reinterpret_cast<void*>(-errno);
+  }
 
+  // Mark the pages as used
+  Region->UsedPages.SetRange(AllocatedPage, NumberOfPages, Region->FullElements);
 
-      if (Region->HadMunmap) {
-        // Backward scan
-        // We need to do a backward scan first to fill any holes
-        // Otherwise we will very quickly run out of VMA regions (65k maximum)
-        auto SearchResult = Region->UsedPages.BackwardScanForRange<true>(LastAllocation, NumberOfPages, Region->NumManagedPages);
+  // Change our last allocation region
+  Region->LastPageAllocation = AllocatedPage + NumberOfPages;
+  Region->FreeSpace -= length;
 
-        AllocatedPage = SearchResult.FoundElement;
+  return MMapResult;
+}
 
-        // If we didn't even have a one page free in the backward search, then unclaim HadMunmap.
-        // Switching over to default forward search.
-        if (SearchResult.FoundElement == ~0ULL && !SearchResult.FoundHole) {
-          Region->HadMunmap = false;
-        }
-      }
+// Needs AllocationMutex shared
+// @return The result of the mmap, or nothing if a reserved region needs to go live first
+std::optional<void*> OSAllocator_64Bit::MmapInLiveRegions(uintptr_t Addr, size_t length, int prot, int flags, int fd, off_t offset) {
+  bool Fixed = (flags & MAP_FIXED) || (flags & MAP_FIXED_NOREPLACE);
+  uintptr_t AddrEnd = Addr + length;
 
-      // Foward Scan
-      if (AllocatedPage == ~0ULL) {
-        auto SearchResult = Region->UsedPages.ForwardScanForRange<true>(LastAllocation, NumberOfPages, RegionNumberOfPages);
-        AllocatedPage = SearchResult.FoundElement;
-      }
+  LiveVMARegion *LiveRegion{};
+  if (Fixed || Addr != 0) {
+    LiveRegion = FindLiveRegionForAddress(Addr);
 
-      if (AllocatedPage != ~0ULL) {
-        AllocatedOffset = Region->SlabInfo->Base + AllocatedPage * FHU::FEX_PAGE_SIZE;
+    if (!LiveRegion && FindReservedRegionForAddress(Addr, AddrEnd) != ReservedRegions->end()) {
+      return std::nullopt;
+    }
+  }
 
-        // We need to setup protections for this
-        void *MMapResult = ::mmap(reinterpret_cast<void*>(AllocatedOffset),
-          length,
-          prot,
-          (flags & ~MAP_FIXED_NOREPLACE) | MAP_FIXED,
-          fd, offset);
+  if (Fixed) {
+    if (!LiveRegion) {
+      return reinterpret_cast<void*>(-ENOMEM);
+    }
 
-        if (MMapResult == MAP_FAILED) {
-          return std::make_pair(Region, reinterpret_cast<void*>(-errno));
-        }
-        return std::make_pair(Region, MMapResult);
+    if (flags & MAP_FIXED_NOREPLACE) {
+      auto Result = MapInRegion(LiveRegion, length, prot, flags, fd, offset, Addr);
+      if (!Result) {
+        // Intersected with something that already existed
+        return reinterpret_cast<void*>(-EEXIST);
       }
+      return Result;
     }
 
-    return std::make_pair(nullptr, nullptr);
-  };
+    std::lock_guard lk(*LiveRegion->RegionMutex);
 
-  if (Fixed) {
-    // Found a region let's allocate to it
-    if (LiveRegion) {
-      // Found a slab that fits this
-      if (flags & MAP_FIXED_NOREPLACE) {
-        auto Fits = CheckIfRangeFits(LiveRegion, length, prot, flags, fd, offset, Addr);
-        if (Fits.first && Fits.second == reinterpret_cast<void*>(Addr)) {
-          // We fit correctly
-          AllocatedOffset = Addr;
-        }
-        else {
-          // Intersected with something that already existed
-          return reinterpret_cast<void*>(-EEXIST);
-        }
-      }
-      else {
-        // We need to mmap the file to this location
-        void *MMapResult = ::mmap(reinterpret_cast<void*>(Addr),
-          length,
-          prot,
-          (flags & ~MAP_FIXED_NOREPLACE) | MAP_FIXED,
-          fd, offset);
-
-        if (MMapResult == MAP_FAILED) {
-          return reinterpret_cast<void*>(-errno);
-        }
+    // We need to mmap the file to this location
+    void *MMapResult = ::mmap(reinterpret_cast<void*>(Addr),
+      length,
+      prot,
+      (flags & ~MAP_FIXED_NOREPLACE) | MAP_FIXED,
+      fd, offset);
 
-        AllocatedOffset = Addr;
-      }
-      // Fall through to live region tracking
+    if (MMapResult == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
     }
+
+    // Mark the pages as used
+    uint64_t MappedBegin = (Addr - LiveRegion->SlabInfo->Base) >> FHU::FEX_PAGE_SHIFT;
+    LiveRegion->UsedPages.SetRange(MappedBegin, length >> FHU::FEX_PAGE_SHIFT, LiveRegion->FullElements);
+
+    // Change our last allocation region
+    LiveRegion->LastPageAllocation = MappedBegin + (length >> FHU::FEX_PAGE_SHIFT);
+    LiveRegion->FreeSpace -= length;
+    return MMapResult;
   }
-  else {
-    // Check our active slabs to see if we can fit the allocation
-    // Slightly different than fixed since it doesn't need exact placement
-    if (LiveRegion && Addr != 0) {
-      // We found a LiveRegion that could hold this address. Let's try to place it
-      // Check if this area is free
-      auto Fits = CheckIfRangeFits(LiveRegion, length, prot, flags, fd, offset, Addr);
-      if (Fits.first && Fits.second == reinterpret_cast<void*>(Addr)) {
-        // We fit correctly
-        AllocatedOffset = Addr;
-      }
-      else {
-        // Couldn't fit
-        // We can continue past this point still
-        LiveRegion = nullptr;
-      }
+
+  // Check our active slabs to see if we can fit the allocation
+  // Slightly different than fixed since it doesn't need exact placement
+  if (LiveRegion) {
+    // We found a LiveRegion that could hold this address. Let's try to place it
+    // Couldn't fit, we can continue past this point still
+    if (auto Result = MapInRegion(LiveRegion, length, prot, flags, fd, offset, Addr)) {
+      return Result;
     }
+  }
 
-    if (!LiveRegion) {
-      for (auto it = LiveRegions->begin(); it != LiveRegions->end(); ++it) {
-        auto Fits = CheckIfRangeFits(*it, length, prot, flags, fd, offset);
-        if (Fits.first && Fits.second == reinterpret_cast<void*>(AllocatedOffset)) {
-          // We fit correctly
-          LiveRegion = Fits.first;
-          break;
-        }
+  for (auto it = LiveRegions->begin(); it != LiveRegions->end(); ++it) {
+    // Either fit or mmap gave us an error
+    // nullptr means no error and couldn't fit
+    if (auto Result = MapInRegion(*it, length, prot, flags, fd, offset)) {
+      return Result;
+    }
+  }
 
-        // Couldn't fit but mmap gave us an error
-        if (!Fits.first && Fits.second) {
-          return Fits.second;
-        }
+  return std::nullopt;
+}
 
-        // nullptr on both means no error and couldn't fit
-      }
+// Needs AllocationMutex unique
+// @return If the mmap should be tried again
+bool OSAllocator_64Bit::MakeRegionActiveFor(uintptr_t Addr, size_t length, size_t SeenLiveRegions) {
+  if (LiveRegions->size() != SeenLiveRegions) {
+    // Another thread made a region live in the mean time, that might be enough
+    return true;
+  }
+
+  if (Addr != 0) {
+    auto it = FindReservedRegionForAddress(Addr, Addr + length);
+    if (it != ReservedRegions->end()) {
+      // Found one, let's make it active
+      MakeRegionActive(it, 0);
+      return true;
     }
+  }
 
-    if (!LiveRegion) {
-      // Couldn't find a fit in the live regions
-      // Allocate a new reserved region
-      size_t lengthOfLiveRegion = FEXCore::AlignUp(LiveVMARegion::GetSizeWithFlexSet(length), FHU::FEX_PAGE_SIZE);
-      size_t lengthPlusManagedData = length + lengthOfLiveRegion;
-      for (auto it = ReservedRegions->begin(); it != ReservedRegions->end(); ++it) {
-        if ((*it)->RegionSize >= lengthPlusManagedData) {
-          MakeRegionActive(it, 0);
-          goto again;
-        }
-      }
+  // Couldn't find a fit in the live regions
+  // Allocate a new reserved region
+  size_t lengthOfLiveRegion = FEXCore::AlignUp(LiveVMARegion::GetSizeWithFlexSet(length), FHU::FEX_PAGE_SIZE);
+  size_t lengthPlusManagedData = length + lengthOfLiveRegion;
+  for (auto it = ReservedRegions->begin(); it != ReservedRegions->end(); ++it) {
+    if ((*it)->RegionSize >= lengthPlusManagedData) {
+      MakeRegionActive(it, 0);
+      return true;
     }
   }
 
-  if (LiveRegion) {
-    // Mark the pages as used
-    uintptr_t RegionBegin = LiveRegion->SlabInfo->Base;
-    uintptr_t MappedBegin = (AllocatedOffset - RegionBegin) >> FHU::FEX_PAGE_SHIFT;
+  return false;
+}
 
-    for (size_t i = 0; i < NumberOfPages; ++i) {
-      LiveRegion->UsedPages.Set(MappedBegin + i);
-    }
+void *OSAllocator_64Bit::Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) {
+  if (addr != 0 &&
+      addr < reinterpret_cast<void*>(LOWER_BOUND)) {
+    // If we are asked to allocate something outside of the 64-bit space
+    // Then we need to just hand this to the OS
+    return ::mmap(addr, length, prot, flags, fd, offset);
+  }
 
-    // Change our last allocation region
-    LiveRegion->LastPageAllocation = MappedBegin + NumberOfPages;
-    LiveRegion->FreeSpace -= length;
+  uint64_t Addr = reinterpret_cast<uint64_t>(addr);
+  // Addr must be page aligned
+  if (Addr & ~FHU::FEX_PAGE_MASK) {
+    return reinterpret_cast<void*>(-EINVAL);
   }
 
-  if (!AllocatedOffset) {
-    AllocatedOffset = -ENOMEM;
+  // If FD is provided then offset must also be page aligned
+  if (fd != -1 &&
+      offset & ~FHU::FEX_PAGE_MASK) {
+    return reinterpret_cast<void*>(-EINVAL);
+  }
+
+  // 64bit address overflow
+  if (Addr + length < Addr) {
+    return reinterpret_cast<void*>(-EOVERFLOW);
+  }
+
+  length = FEXCore::AlignUp(length, FHU::FEX_PAGE_SIZE);
+
+  for (;;) {
+    size_t SeenLiveRegions{};
+    {
+      // Mappings in different live regions only contend on the shared lock
+      FHU::ScopedSignalMaskWithSharedLock lk(AllocationMutex);
+      if (auto Result = MmapInLiveRegions(Addr, length, prot, flags, fd, offset)) {
+        return *Result;
+      }
+      SeenLiveRegions = LiveRegions->size();
+    }
+
+    // Making a region live changes the lists
+    FHU::ScopedSignalMaskWithUniqueLock lk(AllocationMutex);
+    if (!MakeRegionActiveFor(Addr, length, SeenLiveRegions)) {
+      return reinterpret_cast<void*>(-ENOMEM);
+    }
   }
-  return reinterpret_cast<void*>(AllocatedOffset);
 }
 
 int OSAllocator_64Bit::Munmap(void *addr, size_t length) {
@@ -431,8 +467,8 @@ int OSAllocator_64Bit::Munmap(void *addr, size_t length) {
     return -EOVERFLOW;
   }
 
-  // This needs a mutex to be thread safe
-  FHU::ScopedSignalMaskWithMutex lk(AllocationMutex);
+  // The region list only needs to be stable, the region itself is locked below
+  FHU::ScopedSignalMaskWithSharedLock lk(AllocationMutex);
 
   length = FEXCore::AlignUp(length, FHU::FEX_PAGE_SIZE);
 
@@ -446,14 +482,12 @@ int OSAllocator_64Bit::Munmap(void *addr, size_t length) {
     if (RegionBegin <= PtrBegin &&
         RegionEnd > PtrEnd) {
       // Live region fully encompasses slab range
+      std::lock_guard RegionLock(*(*it)->RegionMutex);
 
-      uint64_t FreedPages{};
       uint32_t SlabPageBegin = (PtrBegin - RegionBegin) >> FHU::FEX_PAGE_SHIFT;
       uint64_t PagesToFree = length >> FHU::FEX_PAGE_SHIFT;
 
-      for (size_t i = 0; i < PagesToFree; ++i) {
-        FreedPages += (*it)->UsedPages.TestAndClear(SlabPageBegin + i) ? 1 : 0;
-      }
+      uint64_t FreedPages = (*it)->UsedPages.TestAndClearRange(SlabPageBegin, PagesToFree, (*it)->FullElements);
 
       if (FreedPages != 0)
       {
@@ -465,7 +499,7 @@ int OSAllocator_64Bit::Munmap(void *addr, size_t length) {
         ::mmap(addr, length, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
       }
 
-      (*it)->FreeSpace += FreedPages * 4096;
+      (*it)->FreeSpace += FreedPages * FHU::FEX_PAGE_SIZE;
 
       // Set the last allocated page to the minimum of last page allocation or this slab
       // This will let us more quickly fill holes
@@ -557,7 +591,7 @@ OSAllocator_64Bit::OSAllocator_64Bit() {
 
 OSAllocator_64Bit::~OSAllocator_64Bit() {
   // This needs a mutex to be thread safe
-  FHU::ScopedSignalMaskWithMutex lk(AllocationMutex);
+  FHU::ScopedSignalMaskWithUniqueLock lk(AllocationMutex);
 
   // Walk the pages and deallocate
   // First walk the live regions
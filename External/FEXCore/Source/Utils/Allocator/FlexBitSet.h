@@ -3,6 +3,8 @@
 #include <FEXCore/Utils/MathUtils.h>
 #include <FEXCore/Utils/LogManager.h>
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -47,16 +49,16 @@ struct FlexBitSet final {
     bool FoundHole;
   };
 
-  // TODO: Make {Forward,Backward}ScanForRange faster
-  // Currently these functions test a single bit at a time, which is fairly costly.
-  // The compiler emits a full element load per iteration, wasting a bunch of time on loads.
-  // If we change these functions to have a pre-amble and post-amble to align the primary loop to the element size then this can go significantly
-  // faster.
-  //
-  // Once the element scanning is aligned to the element size, we can then use native count leading zero(CLZ) and count trailing zero(CTZ)
-  // instructions on a full element to scan uint64_t elements per loop iteration.
-
   // Implementation details:
+  // Both scans work on whole elements at a time, using count leading zero(CLZ) and count trailing zero(CTZ)
+  // to skip over runs of bits instead of testing a single bit per iteration.
+  // Each scan walks the range as alternating runs of wanted and unwanted bits, so every element is only loaded once.
+  //
+  // Summary level:
+  // `Full` is an optional second set with one bit per backing element of this set, set while every bit of that element is set.
+  // SetRange and TestAndClearRange keep it up to date when they are passed it, single element updates don't.
+  // Scans for unset ranges use it to step over full elements a whole summary element at a time.
+  //
   // Template argument WantUnset
   // Used to determine if the desired range is for set or unset ranges.
   // Typically `WantUnset` should be true. Used for finding a unset range inside of a range will set elements.
@@ -64,37 +66,32 @@ struct FlexBitSet final {
   // @param BeginningElement - The first element in the set to start scanning from.
   // @param ElementCount - How many elements to find a range for fitting.
   // @param MinimumElement - Minimum element in the set to search to
+  // @param Full - Optional summary of this set
   //
   // @return The scan results
   template<bool WantUnset>
-  BitsetScanResults BackwardScanForRange(size_t BeginningElement, size_t ElementCount, size_t MinimumElement) {
+  BitsetScanResults BackwardScanForRange(size_t BeginningElement, size_t ElementCount, size_t MinimumElement, FlexBitSet const *Full = nullptr) const {
     bool FoundHole {};
-    for (size_t CurrentPage = BeginningElement;
-         CurrentPage >= (MinimumElement + ElementCount);) {
-      size_t Remaining = ElementCount;
-      LOGMAN_THROW_AA_FMT(Remaining <= CurrentPage, "Scanning less than available range");
-
-      while (Remaining) {
-        if (this->Get(CurrentPage - Remaining) == WantUnset) {
-          // Has an intersecting range
-          break;
-        }
-        --Remaining;
-      }
-
-      if (Remaining) {
-        // If we found at least one Element hole then track that
-        if (Remaining != ElementCount) {
-          FoundHole = true;
-        }
+    const size_t LowestEnd = MinimumElement + ElementCount;
 
-        // Didn't find a slab range
-        CurrentPage -= Remaining;
+    for (size_t CurrentElement = BeginningElement;
+         CurrentElement >= LowestEnd;) {
+      // Find the top of the next run of wanted elements.
+      const size_t RunEnd = FindLastEnd(!WantUnset, LowestEnd - 1, CurrentElement, WantUnset ? Full : nullptr);
+      if (RunEnd < LowestEnd) {
+        break;
       }
-      else {
+
+      // Find the bottom of that run, only looking as far as we need to fit.
+      const size_t RunBegin = FindLastEnd(WantUnset, RunEnd - ElementCount, RunEnd);
+      if (RunBegin == (RunEnd - ElementCount)) {
         // We have a slab range
-        return BitsetScanResults{CurrentPage - ElementCount, FoundHole};
+        return BitsetScanResults {RunBegin, FoundHole};
       }
+
+      // Found a hole that didn't fit, continue below the intersecting element
+      FoundHole = true;
+      CurrentElement = RunBegin - 1;
     }
 
     return BitsetScanResults {~0ULL, FoundHole};
@@ -103,45 +100,66 @@ struct FlexBitSet final {
   // @param BeginningElement - The first element in the set to start scanning from.
   // @param ElementCount - How many elements to find a range for fitting.
   // @param ElementsInSet - How many elements are in the full set.
+  // @param Full - Optional summary of this set
   //
   // @return The scan results
   template<bool WantUnset>
-  BitsetScanResults ForwardScanForRange(size_t BeginningElement, size_t ElementCount, size_t ElementsInSet) {
+  BitsetScanResults ForwardScanForRange(size_t BeginningElement, size_t ElementCount, size_t ElementsInSet, FlexBitSet const *Full = nullptr) const {
     bool FoundHole {};
+    if (ElementCount >= ElementsInSet) {
+      return BitsetScanResults {~0ULL, FoundHole};
+    }
 
-    for (size_t CurrentElement = BeginningElement;
-         CurrentElement < (ElementsInSet - ElementCount);) {
-      // If we have enough free space, check if we have enough free pages that are contiguous
-      size_t Remaining = ElementCount;
-
-      LOGMAN_THROW_AA_FMT((CurrentElement + Remaining - 1) < ElementsInSet, "Scanning less than available range");
+    // The range is never allowed to cover the final element in the set.
+    const size_t HighestBegin = ElementsInSet - ElementCount - 1;
 
-      while (Remaining) {
-        if (this->Get(CurrentElement + Remaining - 1) == WantUnset) {
-          // Has an intersecting range
-          break;
-        }
-        --Remaining;
+    for (size_t CurrentElement = BeginningElement;
+         CurrentElement <= HighestBegin;) {
+      // Find the start of the next run of wanted elements.
+      const size_t RunBegin = FindFirst(!WantUnset, CurrentElement, HighestBegin + 1, WantUnset ? Full : nullptr);
+      if (RunBegin > HighestBegin) {
+        break;
       }
 
-      if (Remaining) {
-        // If we found at least one Element hole then track that
-        if (Remaining != ElementCount) {
-          FoundHole = true;
-        }
-
-        // Didn't find a slab range
-        CurrentElement += Remaining;
-      }
-      else {
+      // Find the end of that run, only looking as far as we need to fit.
+      const size_t RunEnd = FindFirst(WantUnset, RunBegin, RunBegin + ElementCount);
+      if (RunEnd == (RunBegin + ElementCount)) {
         // We have a slab range
-        return BitsetScanResults {CurrentElement, FoundHole};
+        return BitsetScanResults {RunBegin, FoundHole};
       }
+
+      // Found a hole that didn't fit, continue past the intersecting element
+      FoundHole = true;
+      CurrentElement = RunEnd + 1;
     }
 
     return BitsetScanResults {~0ULL, FoundHole};
   }
 
+  // Sets `Count` elements starting at `BeginningElement`.
+  void SetRange(size_t BeginningElement, size_t Count, FlexBitSet *Full = nullptr) {
+    ForEachMaskedElement(BeginningElement, Count, [Full](T &Element, T Mask, size_t Index) {
+      Element |= Mask;
+      if (Full && Element == AllBits) {
+        Full->Set(Index);
+      }
+    });
+  }
+
+  // Clears `Count` elements starting at `BeginningElement`.
+  // @return How many of those elements were previously set.
+  size_t TestAndClearRange(size_t BeginningElement, size_t Count, FlexBitSet *Full = nullptr) {
+    size_t Cleared{};
+    ForEachMaskedElement(BeginningElement, Count, [&Cleared, Full](T &Element, T Mask, size_t Index) {
+      Cleared += std::popcount(static_cast<T>(Element & Mask));
+      Element &= ~Mask;
+      if (Full) {
+        Full->Clear(Index);
+      }
+    });
+    return Cleared;
+  }
+
   // This very explicitly doesn't let you take an address
   // Is only a getter
   bool operator[](size_t Element) const {
@@ -151,6 +169,100 @@ struct FlexBitSet final {
   static size_t Size(uint64_t Elements) {
     return FEXCore::AlignUp(Elements / MinimumSizeBits, MinimumSizeBits);
   }
+
+  // Size in bytes of the summary for a set of `Elements` elements.
+  static size_t SummarySize(uint64_t Elements) {
+    const uint64_t BackingElements = FEXCore::AlignUp(Elements, MinimumSizeBits) / MinimumSizeBits;
+    return FEXCore::AlignUp(BackingElements, MinimumSizeBits) / 8;
+  }
+
+private:
+  constexpr static T AllBits = static_cast<T>(~T{0});
+
+  // Returns the first element in [Begin, End) that matches `Value`, or `End` if there isn't one.
+  // `Full` is only valid when looking for unset elements, full elements can't have any.
+  size_t FindFirst(bool Value, size_t Begin, size_t End, FlexBitSet const *Full = nullptr) const {
+    if (Begin >= End) {
+      return End;
+    }
+
+    const T Invert = Value ? T{0} : AllBits;
+    size_t Index = Begin / MinimumSizeBits;
+    const size_t LastIndex = (End - 1) / MinimumSizeBits;
+    T Bits = static_cast<T>((Memory[Index] ^ Invert) & (AllBits << (Begin % MinimumSizeBits)));
+
+    while (!Bits) {
+      if (Index == LastIndex) {
+        return End;
+      }
+
+      if (Full) {
+        Index = Full->FindFirst(false, Index + 1, LastIndex + 1);
+        if (Index > LastIndex) {
+          return End;
+        }
+      }
+      else {
+        ++Index;
+      }
+      Bits = static_cast<T>(Memory[Index] ^ Invert);
+    }
+
+    return std::min<size_t>(Index * MinimumSizeBits + std::countr_zero(Bits), End);
+  }
+
+  // Returns one past the last element in [Begin, End) that matches `Value`, or `Begin` if there isn't one.
+  // `Full` is only valid when looking for unset elements, full elements can't have any.
+  size_t FindLastEnd(bool Value, size_t Begin, size_t End, FlexBitSet const *Full = nullptr) const {
+    if (Begin >= End) {
+      return Begin;
+    }
+
+    const T Invert = Value ? T{0} : AllBits;
+    size_t Index = (End - 1) / MinimumSizeBits;
+    const size_t FirstIndex = Begin / MinimumSizeBits;
+    T Bits = static_cast<T>(Memory[Index] ^ Invert);
+    if (End % MinimumSizeBits) {
+      Bits &= static_cast<T>((T{1} << (End % MinimumSizeBits)) - 1);
+    }
+
+    while (!Bits) {
+      if (Index == FirstIndex) {
+        return Begin;
+      }
+
+      if (Full) {
+        const size_t NotFullEnd = Full->FindLastEnd(false, FirstIndex, Index);
+        if (NotFullEnd == FirstIndex) {
+          return Begin;
+        }
+        Index = NotFullEnd - 1;
+      }
+      else {
+        --Index;
+      }
+      Bits = static_cast<T>(Memory[Index] ^ Invert);
+    }
+
+    return std::max<size_t>(Index * MinimumSizeBits + MinimumSizeBits - std::countl_zero(Bits), Begin);
+  }
+
+  // Calls `Func(Element, Mask, Index)` for each backing element that the range covers.
+  template<typename Func>
+  void ForEachMaskedElement(size_t Begin, size_t Count, Func &&Fn) {
+    const size_t End = Begin + Count;
+    while (Begin < End) {
+      const size_t Index = Begin / MinimumSizeBits;
+      const size_t ElementBase = Index * MinimumSizeBits;
+      const size_t High = std::min<size_t>(End - ElementBase, MinimumSizeBits);
+      T Mask = static_cast<T>(AllBits << (Begin - ElementBase));
+      if (High != MinimumSizeBits) {
+        Mask &= static_cast<T>((T{1} << High) - 1);
+      }
+      Fn(Memory[Index], Mask, Index);
+      Begin = ElementBase + MinimumSizeBits;
+    }
+  }
 };
 
 static_assert(sizeof(FlexBitSet<uint64_t>) == 0, "This needs to be a flex member");
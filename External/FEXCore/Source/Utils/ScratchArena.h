@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace FEXCore::Utils {
+/**
+ * @brief Per-thread bump allocator for memory that only lives for a single block compilation
+ *
+ * The frontend and IR passes pull their temporary containers from this arena instead of the heap.
+ * Deallocation is a no-op and everything is released together with `Reset` once the compilation is done.
+ *
+ * Users must have released everything they allocated from the arena before the next `Reset`.
+ * `clear()` isn't enough for containers that live across compilations, see `ReleaseScratch`.
+ *
+ * If a compilation spills out of the initial buffer then the buffer is grown on the next reset,
+ * so steady state compilation ends up living inside of a single allocation.
+ */
+class ScratchArena final : public std::pmr::memory_resource {
+public:
+  struct Stats {
+    // Allocations served by the arena.
+    uint64_t Allocations;
+    // Allocations that had to fall back to the heap because the buffer was full.
+    uint64_t HeapAllocations;
+  };
+
+  explicit ScratchArena(size_t InitialSize = DefaultSize) {
+    AllocateBuffer(InitialSize);
+  }
+
+  ScratchArena(ScratchArena const&) = delete;
+  ScratchArena& operator=(ScratchArena const&) = delete;
+
+  /**
+   * @brief Releases everything allocated from the arena
+   */
+  void Reset() {
+    if (HeapBytes) {
+      // Last compilation didn't fit. Grow so the next one does.
+      const size_t NewSize = std::min(std::max(BufferSize * 2, BufferSize + HeapBytes), MaximumSize);
+      HeapBytes = 0;
+      if (NewSize != BufferSize) {
+        AllocateBuffer(NewSize);
+        return;
+      }
+    }
+
+    Resource->release();
+  }
+
+  Stats GetStats() const {
+    return CurrentStats;
+  }
+
+private:
+  constexpr static size_t DefaultSize = 256 * 1024;
+  constexpr static size_t MaximumSize = 16 * 1024 * 1024;
+
+  // Upstream of the monotonic buffer once the initial buffer is exhausted.
+  class HeapResource final : public std::pmr::memory_resource {
+  public:
+    explicit HeapResource(ScratchArena *_Arena)
+      : Arena {_Arena} {}
+
+  private:
+    void* do_allocate(size_t Bytes, size_t Alignment) override {
+      ++Arena->CurrentStats.HeapAllocations;
+      Arena->HeapBytes += Bytes;
+      return std::pmr::new_delete_resource()->allocate(Bytes, Alignment);
+    }
+
+    void do_deallocate(void* Ptr, size_t Bytes, size_t Alignment) override {
+      std::pmr::new_delete_resource()->deallocate(Ptr, Bytes, Alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    ScratchArena *Arena;
+  };
+
+  void AllocateBuffer(size_t Size) {
+    Resource.reset();
+    BufferSize = Size;
+    Buffer = std::make_unique_for_overwrite<std::byte[]>(BufferSize);
+    Resource.emplace(Buffer.get(), BufferSize, &Upstream);
+  }
+
+  void* do_allocate(size_t Bytes, size_t Alignment) override {
+    ++CurrentStats.Allocations;
+    return Resource->allocate(Bytes, Alignment);
+  }
+
+  void do_deallocate(void* Ptr, size_t Bytes, size_t Alignment) override {
+    // Memory is only given back on reset.
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  Stats CurrentStats{};
+  size_t HeapBytes{};
+  size_t BufferSize{};
+  std::unique_ptr<std::byte[]> Buffer;
+  HeapResource Upstream {this};
+  std::optional<std::pmr::monotonic_buffer_resource> Resource;
+};
+
+/**
+ * @brief Drops every allocation a scratch container is holding on to
+ *
+ * `clear()` keeps bucket arrays and vector capacity around, which would dangle once the arena is reset.
+ */
+template<typename T>
+void ReleaseScratch(T &Container) {
+  T(Container.get_allocator()).swap(Container);
+}
+}
@@ -10,8 +10,10 @@ $end_info$
 #include <FEXCore/Utils/CompilerDefs.h>
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace FEXCore {
@@ -35,6 +37,8 @@ namespace CodeSerialize {
 namespace CPU {
   struct CPUBackendFeatures {
     bool SupportsStaticRegisterAllocation = false;
+    // Backend can hold 256-bit vectors in pairs of 128-bit registers
+    bool SupportsFPRPairs = false;
   };
   
   class CPUBackend {
@@ -42,6 +46,8 @@ namespace CPU {
     struct CodeBuffer {
       uint8_t *Ptr;
       size_t Size;
+      // Blocks in the index that grows down from the end of the buffer
+      uint32_t NumBlocks;
     };
 
     /**
@@ -119,8 +125,28 @@ namespace CPU {
      */
     virtual void ClearRelocations() {}
 
+    /**
+     * @brief Drops all compiled code and returns the backing pages of the code buffer to the kernel
+     *
+     * Used when the thread state is parked for reuse. The initial code buffer stays mapped
+     * and is picked up again at its current size by the next ClearCache.
+     */
+    void ReleaseCodeBuffers();
+
     bool IsAddressInCodeBuffer(uintptr_t Address) const;
 
+    /**
+     * @brief Maps a host PC inside of a compiled block back to the guest instruction it belongs to
+     *
+     * Uses the PC map that is stored after every block in the code buffer.
+     * Safe to call from a signal handler on the owning thread, unless the code buffers are being replaced.
+     *
+     * @param BlockRIP Receives the guest entry of the block HostPC is in, if non-null
+     *
+     * @return The guest RIP, or nullopt if HostPC isn't inside of a compiled block
+     */
+    std::optional<uint64_t> GetGuestRIPForHostPC(uintptr_t HostPC, uint64_t *BlockRIP = nullptr) const;
+
   protected:
     // Max spill slot size in bytes. We need at most 32 bytes
     // to be able to handle a 256-bit vector store to a slot.
@@ -134,6 +160,40 @@ namespace CPU {
     // This is the current code buffer that we are tracking
     CodeBuffer *CurrentCodeBuffer{};
 
+    /**
+     * @return Offset in the current code buffer that code and block tails must stay below
+     */
+    size_t GetCodeBufferLimit() const;
+
+    /**
+     * @brief Upper bound of the block tail size for a block with this many IR nodes
+     */
+    static size_t MaxBlockTailSize(uint32_t SSACount);
+
+    /**
+     * @brief Marks the start of a guest instruction in the block that is being compiled
+     *
+     * @param HostOffset Offset of the instruction's host code from the block entry
+     * @param GuestOffset Offset of the guest instruction from the block's guest RIP
+     */
+    void AddPCMapEntry(uint32_t HostOffset, int32_t GuestOffset) {
+      PendingPCMap.emplace_back(HostOffset, GuestOffset);
+    }
+
+    /**
+     * @brief Writes the tail of the block that was just compiled and adds it to the code buffer's index
+     *
+     * The tail holds the guest RIP, the host code size and the delta encoded PC map of the block.
+     *
+     * @param Entry Guest RIP of the block
+     * @param HostEntry Start of the block's host code in the current code buffer
+     * @param HostCodeSize Size of the block's host code
+     * @param Tail Where to write the tail, directly after the host code
+     *
+     * @return Size of the tail in bytes
+     */
+    size_t EmitBlockTail(uint64_t Entry, uint8_t const *HostEntry, uint32_t HostCodeSize, uint8_t *Tail);
+
   private:
     CodeBuffer AllocateNewCodeBuffer(size_t Size);
     void FreeCodeBuffer(CodeBuffer Buffer);
@@ -145,6 +205,12 @@ namespace CPU {
     // This is the array of code buffers. Unless signals force us to keep more than
     // buffer, there will be only one entry here
     std::vector<CodeBuffer> CodeBuffers{};
+
+    // Set by ReleaseCodeBuffers, the next empty code buffer reuses the released one without growing it
+    bool CodeBuffersReleased{};
+
+    // {host offset, guest offset} of each instruction in the block being compiled, reused between blocks
+    std::vector<std::pair<uint32_t, int32_t>> PendingPCMap;
   };
 
 }
@@ -24,6 +24,8 @@ class HostFeatures final {
     bool Supports3DNow{};
     bool SupportsSSE4A{};
     bool SupportsAVX{};
+    // Host vector registers are at least 256-bit, otherwise AVX registers are split in to 128-bit pairs
+    bool SupportsSVE256{};
     bool SupportsSHA{};
     bool SupportsBMI1{};
     bool SupportsBMI2{};
@@ -16,6 +16,28 @@ namespace Debug {
 
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP);
 
+  /**
+   * @brief Recompiles RIP on the parent thread and reports the time spent in each compile stage
+   *
+   * @return false if the block couldn't be compiled
+   */
+  bool CompileRIPWithStats(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::Core::CompileStageStats *Stats);
+
+  struct DecodeRangeStats {
+    uint64_t Blocks;
+    uint64_t Instructions;
+    uint64_t InvalidInstructions;
+    uint64_t Bytes; ///< Guest code covered by the decoded instructions
+  };
+
+  /**
+   * @brief Runs the frontend over [Start, Start + Length) one block after another on the parent thread, without compiling anything
+   *
+   * Invalid instructions are skipped a byte at a time. Multiblock doesn't follow branches out of the range.
+   * Meant for measuring decode throughput, the code only needs to be readable.
+   */
+  void DecodeRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length, DecodeRangeStats *Stats);
+
   uint64_t GetThreadCount(FEXCore::Context::Context *CTX);
   FEXCore::Core::RuntimeStats *GetRuntimeStatsForThread(FEXCore::Context::Context *CTX, uint64_t Thread);
 
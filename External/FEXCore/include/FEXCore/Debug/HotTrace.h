@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+
+namespace FEXCore::HotTrace {
+  /**
+   * @brief File format of the hot block traces written by the guest profiler
+   *
+   * Layout:
+   * - FileHeader
+   * - FileHeader::NumBlocks times:
+   *   - BlockHeader
+   *   - `char Filename[BlockHeader::FilenameLength]`
+   *   - `uint8_t Code[BlockHeader::CodeSize]`, guest memory starting at BlockHeader::CodeStart
+   *
+   * Blocks are sorted hottest first.
+   */
+  constexpr static uint64_t COOKIE = 0x4543'4152'5448'5846ULL; // "FXHTRACE"
+  constexpr static uint32_t VERSION = 2;
+
+  /**
+   * @brief State the blocks were compiled under
+   *
+   * Replaying the blocks with the same settings makes the frontend and passes take the same paths.
+   */
+  struct CompileState {
+    uint8_t Is64BitMode;
+    uint8_t Multiblock;
+    uint8_t TSOEnabled;
+    uint8_t ParanoidTSO;
+    uint8_t ABILocalFlags;
+    uint8_t ABINoPF;
+    uint8_t x87ReducedPrecision;
+    uint8_t SMCChecks;
+    int32_t MaxInstPerBlock;
+    uint8_t StackTSOElision;
+    uint8_t FramePointerTSOElision;
+    uint8_t Pad[2];
+  };
+
+  struct FileHeader {
+    uint64_t Cookie;
+    uint32_t Version;
+    uint32_t NumBlocks;
+    uint64_t TotalSamples;
+    CompileState State;
+  };
+
+  struct BlockHeader {
+    uint64_t GuestRIP;
+    // Range of guest code the frontend decoded for the block, multiblock can reach before GuestRIP
+    uint64_t DecodedStart;
+    uint64_t DecodedLength;
+    // Captured guest memory, the decoded range plus the tail the frontend might peek at
+    uint64_t CodeStart;
+    uint64_t CodeSize;
+    uint64_t Samples;
+    // Offset of GuestRIP in Filename
+    uint64_t FileOffset;
+    uint32_t FilenameLength;
+    uint32_t Pad;
+  };
+}
@@ -11,10 +11,14 @@
 #include <tsl/robin_map.h>
 
 #include <shared_mutex>
+#include <string>
+#include <vector>
 
 namespace FEXCore {
   class LookupCache;
   class CompileService;
+  class JITSymbolBuffer;
+  class GuestProfileThread;
 }
 
 namespace FEXCore::Context {
@@ -34,11 +38,60 @@ namespace FEXCore::IR{
   class PassManager;
 }
 
+namespace FEXCore::Utils {
+  class ScratchArena;
+}
+
 namespace FEXCore::Core {
 
+  /**
+   * @brief Totals of a single PassManager pass over every compilation on a thread
+   */
+  struct PassRuntimeStats {
+    std::string Name;
+    std::atomic_uint64_t TimeNS;
+    // Live IR nodes going in to and coming out of the pass
+    std::atomic_uint64_t NodesIn;
+    std::atomic_uint64_t NodesOut;
+  };
+
   struct RuntimeStats {
     std::atomic_uint64_t InstructionsExecuted;
     std::atomic_uint64_t BlocksCompiled;
+
+    // Totals of CompileStageStats over every compilation on the thread
+    std::atomic_uint64_t DecodeNS;
+    std::atomic_uint64_t DispatchNS;
+    std::atomic_uint64_t PassesNS;
+    std::atomic_uint64_t BackendNS;
+    std::atomic_uint64_t RelocationNS;
+    std::atomic_uint64_t GuestInstructionsCompiled;
+    std::atomic_uint64_t HostCodeSize;
+    // Blocks that came from the code object cache instead of being compiled
+    std::atomic_uint64_t BlocksRelocated;
+    // Guest instructions the frontend took from its decode cache, and the decode time that is estimated to have saved
+    std::atomic_uint64_t DecodeCacheHits;
+    std::atomic_uint64_t DecodeCacheNSSaved;
+
+    // One per pass in the order they run, sized once the thread's compiler is set up
+    std::vector<PassRuntimeStats> Passes;
+  };
+
+  /**
+   * @brief Where the time of a single block compilation went
+   *
+   * Stages that didn't run, like the frontend for blocks coming from the AOT IR cache, stay zero.
+   */
+  struct CompileStageStats {
+    uint64_t DecodeNS;     ///< Frontend::Decoder
+    uint64_t DispatchNS;   ///< OpcodeDispatcher turning the decoded instructions in to IR
+    uint64_t PassesNS;     ///< PassManager, including RA
+    uint64_t BackendNS;    ///< Host code emission
+    uint64_t RelocationNS; ///< Fixing up code from the code object cache, instead of all of the above
+    uint64_t GuestInstructions;
+    uint64_t IRNodes;      ///< Nodes left after the passes
+    uint64_t HostCodeSize;
+    uint64_t DecodeCacheHits; ///< Guest instructions that didn't need decoding
   };
 
   struct DebugDataSubblock {
@@ -105,9 +158,17 @@ namespace FEXCore::Core {
 
     std::unique_ptr<FEXCore::Frontend::Decoder> FrontendDecoder;
     std::unique_ptr<FEXCore::IR::PassManager> PassManager;
+    // Scratch memory for the frontend and passes, reset on every compilation
+    std::unique_ptr<FEXCore::Utils::ScratchArena> CompileScratch;
+    // Batches up perf symbol output, only allocated when symbol output is enabled
+    std::unique_ptr<FEXCore::JITSymbolBuffer> SymbolBuffer;
+    // Guest profiler samples and block map, only allocated when the profiler is enabled
+    std::unique_ptr<FEXCore::GuestProfileThread> ProfileData;
     FEXCore::HLE::ThreadManagement ThreadManager;
 
     RuntimeStats Stats{};
+    // Stats of the most recent compilation on this thread
+    CompileStageStats LastCompile{};
 
     int StatusCode{};
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
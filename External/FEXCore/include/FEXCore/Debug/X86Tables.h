@@ -421,20 +421,28 @@ constexpr uint64_t FLAGS_DIVIDE         = (1 << 6);
 struct Flags {
   uint64_t DebugFlags;
 };
-void InstallDebugInfo();
 }
 
 #endif
 
+// Longest instruction name plus the terminator, rounded up to keep X86InstInfo packed
+constexpr size_t MAX_INST_NAME_SIZE = 20;
+
+/**
+ * @brief One entry of the decode tables
+ *
+ * The tables are generated at compile time and only ever read, so this must stay free of pointers.
+ * Anything needing a relocation would move the tables out of .rodata and in to per process pages.
+ */
 struct X86InstInfo {
-  char const *Name;
+  char Name[MAX_INST_NAME_SIZE];
   InstType Type;
   InstFlags::InstFlagType Flags; ///< Must be larger than InstFlags enum
   uint8_t MoreBytes;
-  OpDispatchPtr OpcodeDispatcher;
+  // Where the opcode dispatcher finds the handler of this entry, see DispatchIndex
+  uint16_t DispatchIndex;
 #ifndef NDEBUG
   X86InstDebugInfo::Flags DebugInfo;
-  uint32_t NumUnitTestsGenerated;
 #endif
 
   bool operator==(const X86InstInfo &b) const {
@@ -444,7 +452,7 @@ struct X86InstInfo {
         MoreBytes != b.MoreBytes)
       return false;
 
-    // We don't care if the opcode dispatcher differs
+    // We don't care if the dispatch index differs
     return true;
   }
   bool operator!=(const X86InstInfo &b) const {
@@ -487,30 +495,71 @@ constexpr size_t MAX_XOP_GROUP_TABLE_SIZE = (1 << 6);
 
 constexpr size_t MAX_EVEX_TABLE_SIZE = 256;
 
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps;
+/**
+ * @brief Ranges of X86InstInfo::DispatchIndex handed out to each table
+ *
+ * Every table entry gets `<Table range> + <Table index>`, the opcode dispatcher maps that index to its handler.
+ * Tables whose handlers differ between 32-bit and 64-bit get a range per mode.
+ * x87 has a second range for the reduced precision handlers, which the dispatcher redirects to.
+ * Index 0 is reserved for entries without a handler, like the XOP tables.
+ */
+namespace DispatchIndex {
+constexpr uint32_t NONE                   = 0;
+constexpr uint32_t BASE_OPS_32            = 1;
+constexpr uint32_t BASE_OPS_64            = BASE_OPS_32 + MAX_PRIMARY_TABLE_SIZE;
+constexpr uint32_t SECOND_BASE_OPS_32     = BASE_OPS_64 + MAX_PRIMARY_TABLE_SIZE;
+constexpr uint32_t SECOND_BASE_OPS_64     = SECOND_BASE_OPS_32 + MAX_SECOND_TABLE_SIZE;
+constexpr uint32_t REP_MOD_OPS            = SECOND_BASE_OPS_64 + MAX_SECOND_TABLE_SIZE;
+constexpr uint32_t REPNE_MOD_OPS          = REP_MOD_OPS + MAX_REP_MOD_TABLE_SIZE;
+constexpr uint32_t OPSIZE_MOD_OPS         = REPNE_MOD_OPS + MAX_REPNE_MOD_TABLE_SIZE;
+constexpr uint32_t PRIMARY_INST_GROUP_OPS = OPSIZE_MOD_OPS + MAX_OPSIZE_MOD_TABLE_SIZE;
+constexpr uint32_t SECOND_INST_GROUP_OPS  = PRIMARY_INST_GROUP_OPS + MAX_INST_GROUP_TABLE_SIZE;
+constexpr uint32_t SECOND_MODRM_TABLE_OPS = SECOND_INST_GROUP_OPS + MAX_INST_SECOND_GROUP_TABLE_SIZE;
+constexpr uint32_t X87_OPS                = SECOND_MODRM_TABLE_OPS + MAX_SECOND_MODRM_TABLE_SIZE;
+constexpr uint32_t X87_F64_OPS            = X87_OPS + MAX_X87_TABLE_SIZE;
+constexpr uint32_t DDDNOW_OPS             = X87_F64_OPS + MAX_X87_TABLE_SIZE;
+constexpr uint32_t H0F38_TABLE_OPS        = DDDNOW_OPS + MAX_3DNOW_TABLE_SIZE;
+constexpr uint32_t H0F3A_TABLE_OPS        = H0F38_TABLE_OPS + MAX_0F_38_TABLE_SIZE;
+constexpr uint32_t VEX_TABLE_OPS          = H0F3A_TABLE_OPS + MAX_0F_3A_TABLE_SIZE;
+constexpr uint32_t VEX_TABLE_GROUP_OPS    = VEX_TABLE_OPS + MAX_VEX_TABLE_SIZE;
+constexpr uint32_t EVEX_TABLE_OPS         = VEX_TABLE_GROUP_OPS + MAX_VEX_GROUP_TABLE_SIZE;
+constexpr uint32_t MAX                    = EVEX_TABLE_OPS + MAX_EVEX_TABLE_SIZE;
+
+static_assert(MAX <= UINT16_MAX, "DispatchIndex needs to fit in X86InstInfo");
+}
 
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_INST_SECOND_GROUP_TABLE_SIZE> SecondInstGroupOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_SECOND_MODRM_TABLE_SIZE> SecondModRMTableOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_3DNOW_TABLE_SIZE> DDDNowOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_0F_38_TABLE_SIZE> H0F38TableOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_0F_3A_TABLE_SIZE> H0F3ATableOps;
+// Tables that differ between 32-bit and 64-bit guests, the frontend picks the set for the context's mode
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_64;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_0F_3A_TABLE_SIZE> H0F3ATableOps_32;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_0F_3A_TABLE_SIZE> H0F3ATableOps_64;
+
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_INST_SECOND_GROUP_TABLE_SIZE> SecondInstGroupOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_SECOND_MODRM_TABLE_SIZE> SecondModRMTableOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_3DNOW_TABLE_SIZE> DDDNowOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_0F_38_TABLE_SIZE> H0F38TableOps;
 
 // VEX
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_VEX_TABLE_SIZE> VEXTableOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_VEX_GROUP_TABLE_SIZE> VEXTableGroupOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_VEX_TABLE_SIZE> VEXTableOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_VEX_GROUP_TABLE_SIZE> VEXTableGroupOps;
 
 // XOP
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> XOPTableOps;
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> XOPTableGroupOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> XOPTableOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> XOPTableGroupOps;
 
 // EVEX
-extern FEX_DEFAULT_VISIBILITY std::array<X86InstInfo, MAX_EVEX_TABLE_SIZE> EVEXTableOps;
+extern FEX_DEFAULT_VISIBILITY const std::array<X86InstInfo, MAX_EVEX_TABLE_SIZE> EVEXTableOps;
 }
 
 template <>
@@ -92,5 +92,14 @@ private:
 class SourcecodeResolver {
 public:
   virtual std::unique_ptr<SourcecodeMap> GenerateMap(const std::string_view& GuestBinaryFile, const std::string_view& GuestBinaryFileId) = 0;
+
+  /**
+   * @brief Cheaper version of GenerateMap that only fills in SortedSymbolMappings
+   *
+   * Used to name JIT blocks after the guest function they belong to.
+   */
+  virtual std::unique_ptr<SourcecodeMap> GenerateSymbolMap(const std::string_view& GuestBinaryFile) {
+    return {};
+  }
 };
 }
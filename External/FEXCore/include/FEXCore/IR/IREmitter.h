@@ -38,6 +38,11 @@ friend class FEXCore::IR::PassManager;
     IRListView *CreateIRCopy() { return new IRListView(&DualListData, true); }
     void ResetWorkingList();
 
+    // Nodes still linked in to the IR, constant time unlike walking it
+    size_t GetLiveNodeCount() const {
+      return DualListData.ListSize() / sizeof(OrderedNode) - RemovedNodes;
+    }
+
   /**
    * @name IR allocation routines
    *
@@ -249,6 +254,7 @@ friend class FEXCore::IR::PassManager;
     DualListData.CopyData(rhs.DualListData);
     InvalidNode = rhs.InvalidNode->Wrapped(rhs.DualListData.ListBegin()).GetNode(DualListData.ListBegin());
     CurrentWriteCursor = rhs.CurrentWriteCursor;
+    RemovedNodes = rhs.RemovedNodes;
     CodeBlocks = rhs.CodeBlocks;
     for (auto& CodeBlock: CodeBlocks) {
       CodeBlock = CodeBlock->Wrapped(rhs.DualListData.ListBegin()).GetNode(DualListData.ListBegin());
@@ -357,6 +363,8 @@ friend class FEXCore::IR::PassManager;
 
     OrderedNode *InvalidNode;
     OrderedNode *CurrentCodeBlock{};
+    // Nodes unlinked by Remove, their list slots stay allocated until the IR is compacted
+    size_t RemovedNodes{};
     std::vector<OrderedNode*> CodeBlocks;
     uint64_t Entry;
 };
@@ -163,6 +163,17 @@ public:
     }
   }
 
+  /**
+   * @brief Allocates an owned view with uninitialized IR and list data for a decoder to fill in
+   */
+  IRListView(size_t _DataSize, size_t _ListSize) {
+    SetCopy(true);
+    DataSize = _DataSize;
+    ListSize = _ListSize;
+    IRDataInternal = malloc(DataSize + ListSize);
+    ListDataInternal = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(IRDataInternal) + DataSize);
+  }
+
   ~IRListView() {
     if (IsCopy()) {
       free (IRDataInternal);
@@ -61,6 +61,13 @@ public:
     return DidSignal;
   }
 
+  /**
+   * @brief Drops a pending notification, only safe while nothing can be waiting on the event
+   */
+  void Reset() {
+    FlagObject.TestAndClear();
+  }
+
 private:
   Flag FlagObject;
   std::mutex MutexObject;
@@ -63,6 +63,11 @@ namespace FEXCore {
         DoNotify(INT_MAX);
       }
 
+      // Drops a pending notification, only safe while nothing can be waiting on it
+      void Reset() {
+        Mutex.store(UNSIGNALED);
+      }
+
     private:
       std::atomic<uint32_t> Mutex{};
       constexpr static uint32_t SIGNALED = 1;
@@ -1,10 +1,12 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/Config.h"
+#include "Common/StartupSnapshot.h"
 
 #include <FEXCore/Config/Config.h>
 
 #include <cstring>
 #include <filesystem>
+#include <functional>
 #include <fstream>
 #include <map>
 #include <list>
@@ -40,6 +42,59 @@ namespace FEX::Config {
     }
   }
 
+  /**
+   * @brief A config file layer that was parsed up front, either now or by an earlier launch
+   */
+  class ParsedFileLayer final : public FEXCore::Config::Layer {
+  public:
+    ParsedFileLayer(FEXCore::Config::LayerType Type, FEXCore::Config::LayerOptions Options)
+      : FEXCore::Config::Layer(Type) {
+      OptionMap = std::move(Options);
+    }
+    void Load() override {}
+  };
+
+  static std::unique_ptr<FEXCore::Config::Layer> LoadFileLayer(
+    FEXCore::Config::LayerType Type,
+    std::string const &Path,
+    std::function<std::unique_ptr<FEXCore::Config::Layer>()> CreateLoadedLayer) {
+    const auto Key = "ConfigLayer:" + Path;
+    FEXCore::Config::LayerOptions Options;
+
+    // Stored as pairs of option number and value, the snapshot is dropped when FEX changes so the numbers are stable
+    if (auto Cached = FEX::StartupSnapshot::Get(Key, {Path}); Cached && Cached->size() % 2 == 0) {
+      for (size_t i = 0; i < Cached->size(); i += 2) {
+        auto Option = static_cast<FEXCore::Config::ConfigOption>(std::stoul(Cached->at(i)));
+        Options[Option].emplace_back(std::move(Cached->at(i + 1)));
+      }
+      return std::make_unique<ParsedFileLayer>(Type, std::move(Options));
+    }
+
+    auto Stamp = FEX::StartupSnapshot::Stamp(Path);
+    auto Layer = CreateLoadedLayer();
+    Options = Layer->GetOptionMap();
+
+    std::vector<std::string> Values;
+    for (auto &[Option, Value] : Options) {
+      for (auto &Var : Value) {
+        Values.emplace_back(std::to_string(static_cast<uint32_t>(Option)));
+        Values.emplace_back(Var);
+      }
+    }
+    FEX::StartupSnapshot::Put(Key, {std::move(Stamp)}, std::move(Values));
+
+    return std::make_unique<ParsedFileLayer>(Type, std::move(Options));
+  }
+
+  static std::unique_ptr<FEXCore::Config::Layer> LoadAppLayer(std::string const &Filename, FEXCore::Config::LayerType Type) {
+    const bool Global = Type == FEXCore::Config::LayerType::LAYER_GLOBAL_STEAM_APP ||
+                        Type == FEXCore::Config::LayerType::LAYER_GLOBAL_APP;
+    // App layers load as soon as they are created
+    return LoadFileLayer(Type, FEXCore::Config::GetApplicationConfig(Filename, Global), [&]() {
+      return FEXCore::Config::CreateAppLayer(Filename, Type);
+    });
+  }
+
   std::pair<std::string, std::string> LoadConfig(
     bool NoFEXArguments,
     bool LoadProgramConfig,
@@ -47,6 +102,7 @@ namespace FEX::Config {
     char **argv,
     char **const envp) {
     FEXCore::Config::Initialize();
+    // The main configs are where the StartupSnapshot option comes from, so they are always parsed
     FEXCore::Config::AddLayer(FEXCore::Config::CreateGlobalMainLayer());
     FEXCore::Config::AddLayer(FEXCore::Config::CreateMainLayer());
 
@@ -109,16 +165,19 @@ namespace FEX::Config {
         }
       }
 
-      FEXCore::Config::AddLayer(FEXCore::Config::CreateAppLayer(ProgramName, FEXCore::Config::LayerType::LAYER_GLOBAL_APP));
-      FEXCore::Config::AddLayer(FEXCore::Config::CreateAppLayer(ProgramName, FEXCore::Config::LayerType::LAYER_LOCAL_APP));
+      // LoadAppLayer needs the StartupSnapshot option from the layers so far, the caller reloads once more after the app layers
+      FEXCore::Config::ReloadMetaLayer();
+
+      FEXCore::Config::AddLayer(LoadAppLayer(ProgramName, FEXCore::Config::LayerType::LAYER_GLOBAL_APP));
+      FEXCore::Config::AddLayer(LoadAppLayer(ProgramName, FEXCore::Config::LayerType::LAYER_LOCAL_APP));
 
       auto SteamID = getenv("SteamAppId");
       if (SteamID) {
         // If a SteamID exists then let's search for Steam application configs as well.
         // We want to key off both the SteamAppId number /and/ the executable since we may not want to thunk all binaries.
         auto SteamAppName = fmt::format("Steam_{}_{}", SteamID, ProgramName.string());
-        FEXCore::Config::AddLayer(FEXCore::Config::CreateAppLayer(SteamAppName, FEXCore::Config::LayerType::LAYER_GLOBAL_STEAM_APP));
-        FEXCore::Config::AddLayer(FEXCore::Config::CreateAppLayer(SteamAppName, FEXCore::Config::LayerType::LAYER_LOCAL_STEAM_APP));
+        FEXCore::Config::AddLayer(LoadAppLayer(SteamAppName, FEXCore::Config::LayerType::LAYER_GLOBAL_STEAM_APP));
+        FEXCore::Config::AddLayer(LoadAppLayer(SteamAppName, FEXCore::Config::LayerType::LAYER_LOCAL_STEAM_APP));
       }
 
       return std::make_pair(Program, ProgramName);
@@ -0,0 +1,295 @@
+#include "Common/StartupSnapshot.h"
+
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace FEX::StartupSnapshot {
+  constexpr static uint64_t COOKIE = 0x5041'4E53'5452'5446ULL; // "FTRTSNAP"
+  constexpr static uint32_t VERSION = 1;
+
+  // Oldest entries get dropped past this, keeps the file small for users running lots of different applications
+  constexpr size_t MAX_ENTRIES = 256;
+
+  struct Entry {
+    std::string Key;
+    std::vector<FileStamp> Inputs;
+    std::vector<std::string> Values;
+  };
+
+  static bool Loaded{};
+  static bool Dirty{};
+  static std::vector<Entry> Entries;
+
+  // Checked on every access, the option can only be known once the layers defining it are loaded
+  static bool Enabled() {
+    FEX_CONFIG_OPT(StartupSnapshot, STARTUPSNAPSHOT);
+    return StartupSnapshot();
+  }
+
+  static std::string GetSnapshotPath() {
+    return FEXCore::Config::GetDataDirectory() + "StartupSnapshot.bin";
+  }
+
+  FileStamp Stamp(std::string const &Path) {
+    struct stat Stat{};
+    if (::stat(Path.c_str(), &Stat) != 0) {
+      return FileStamp {
+        .Path = Path,
+        .Exists = false,
+        .MTimeNS = 0,
+        .Size = 0,
+        .Inode = 0,
+      };
+    }
+
+    return FileStamp {
+      .Path = Path,
+      .Exists = true,
+      .MTimeNS = Stat.st_mtim.tv_sec * 1'000'000'000LL + Stat.st_mtim.tv_nsec,
+      .Size = static_cast<uint64_t>(Stat.st_size),
+      .Inode = static_cast<uint64_t>(Stat.st_ino),
+    };
+  }
+
+  // A FEX update can change what the cached values mean
+  static FileStamp StampSelf() {
+    return Stamp("/proc/self/exe");
+  }
+
+  namespace Serialization {
+    static void Write(std::string &Out, uint64_t Value) {
+      Out.append(reinterpret_cast<char const*>(&Value), sizeof(Value));
+    }
+
+    static void Write(std::string &Out, std::string_view Value) {
+      Write(Out, static_cast<uint64_t>(Value.size()));
+      Out.append(Value);
+    }
+
+    static void Write(std::string &Out, FileStamp const &Stamp) {
+      Write(Out, Stamp.Path);
+      Write(Out, static_cast<uint64_t>(Stamp.Exists));
+      Write(Out, static_cast<uint64_t>(Stamp.MTimeNS));
+      Write(Out, Stamp.Size);
+      Write(Out, Stamp.Inode);
+    }
+
+    class Reader final {
+    public:
+      explicit Reader(std::string_view Data)
+        : Data {Data} {}
+
+      bool Read(uint64_t *Value) {
+        if (Data.size() - Offset < sizeof(*Value)) {
+          return false;
+        }
+        memcpy(Value, Data.data() + Offset, sizeof(*Value));
+        Offset += sizeof(*Value);
+        return true;
+      }
+
+      bool Read(std::string *Value) {
+        uint64_t Size;
+        if (!Read(&Size) || Data.size() - Offset < Size) {
+          return false;
+        }
+        Value->assign(Data.data() + Offset, Size);
+        Offset += Size;
+        return true;
+      }
+
+      bool Read(FileStamp *Stamp) {
+        uint64_t Exists, MTimeNS;
+        if (!Read(&Stamp->Path) || !Read(&Exists) || !Read(&MTimeNS) || !Read(&Stamp->Size) || !Read(&Stamp->Inode)) {
+          return false;
+        }
+        Stamp->Exists = Exists != 0;
+        Stamp->MTimeNS = static_cast<int64_t>(MTimeNS);
+        return true;
+      }
+
+    private:
+      std::string_view Data;
+      size_t Offset{};
+    };
+  }
+
+  static bool ReadFile(std::string const &Path, std::string *Data) {
+    int FD = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FD == -1) {
+      return false;
+    }
+
+    struct stat Stat{};
+    if (::fstat(FD, &Stat) != 0) {
+      ::close(FD);
+      return false;
+    }
+
+    Data->resize(Stat.st_size);
+    const bool Result = ::read(FD, Data->data(), Data->size()) == static_cast<ssize_t>(Data->size());
+    ::close(FD);
+    return Result;
+  }
+
+  static void Load() {
+    if (Loaded || !Enabled()) {
+      return;
+    }
+    Loaded = true;
+
+    std::string Data;
+    if (!ReadFile(GetSnapshotPath(), &Data)) {
+      return;
+    }
+
+    Serialization::Reader Reader{Data};
+    uint64_t Cookie, Version, NumEntries;
+    FileStamp Self;
+    if (!Reader.Read(&Cookie) || Cookie != COOKIE ||
+        !Reader.Read(&Version) || Version != VERSION ||
+        !Reader.Read(&Self) || Self != StampSelf() ||
+        !Reader.Read(&NumEntries)) {
+      return;
+    }
+
+    std::vector<Entry> LoadedEntries;
+    for (uint64_t i = 0; i < NumEntries; ++i) {
+      Entry &Entry = LoadedEntries.emplace_back();
+      uint64_t NumInputs, NumValues;
+      if (!Reader.Read(&Entry.Key) || !Reader.Read(&NumInputs)) {
+        return;
+      }
+
+      for (uint64_t j = 0; j < NumInputs; ++j) {
+        if (!Reader.Read(&Entry.Inputs.emplace_back())) {
+          return;
+        }
+      }
+
+      if (!Reader.Read(&NumValues)) {
+        return;
+      }
+
+      for (uint64_t j = 0; j < NumValues; ++j) {
+        if (!Reader.Read(&Entry.Values.emplace_back())) {
+          return;
+        }
+      }
+    }
+
+    // Only use the snapshot if it was complete
+    Entries = std::move(LoadedEntries);
+  }
+
+  std::optional<std::vector<std::string>> Get(std::string_view Key, std::vector<std::string> const &Inputs) {
+    if (!Enabled()) {
+      return std::nullopt;
+    }
+
+    Load();
+
+    auto it = std::find_if(Entries.begin(), Entries.end(), [Key](Entry const &Entry) {
+      return Entry.Key == Key;
+    });
+
+    if (it == Entries.end() || it->Inputs.size() != Inputs.size()) {
+      return std::nullopt;
+    }
+
+    for (size_t i = 0; i < Inputs.size(); ++i) {
+      if (it->Inputs[i].Path != Inputs[i] || it->Inputs[i] != Stamp(Inputs[i])) {
+        return std::nullopt;
+      }
+    }
+
+    return it->Values;
+  }
+
+  void Put(std::string_view Key, std::vector<FileStamp> Inputs, std::vector<std::string> Values) {
+    if (!Enabled()) {
+      return;
+    }
+
+    Load();
+
+    auto it = std::find_if(Entries.begin(), Entries.end(), [Key](Entry const &Entry) {
+      return Entry.Key == Key;
+    });
+
+    if (it != Entries.end()) {
+      if (it->Inputs == Inputs && it->Values == Values) {
+        return;
+      }
+      Entries.erase(it);
+    }
+    else if (Entries.size() == MAX_ENTRIES) {
+      Entries.erase(Entries.begin());
+    }
+
+    Entries.emplace_back(Entry {
+      .Key = std::string(Key),
+      .Inputs = std::move(Inputs),
+      .Values = std::move(Values),
+    });
+    Dirty = true;
+  }
+
+  void Save() {
+    if (!Dirty || !Enabled()) {
+      return;
+    }
+
+    std::string Data;
+    Serialization::Write(Data, COOKIE);
+    Serialization::Write(Data, static_cast<uint64_t>(VERSION));
+    Serialization::Write(Data, StampSelf());
+    Serialization::Write(Data, static_cast<uint64_t>(Entries.size()));
+    for (auto const &Entry : Entries) {
+      Serialization::Write(Data, Entry.Key);
+      Serialization::Write(Data, static_cast<uint64_t>(Entry.Inputs.size()));
+      for (auto const &Input : Entry.Inputs) {
+        Serialization::Write(Data, Input);
+      }
+      Serialization::Write(Data, static_cast<uint64_t>(Entry.Values.size()));
+      for (auto const &Value : Entry.Values) {
+        Serialization::Write(Data, Value);
+      }
+    }
+
+    const auto Path = GetSnapshotPath();
+    std::error_code ec{};
+    std::filesystem::create_directories(std::filesystem::path(Path).parent_path(), ec);
+
+    // Other processes can be starting up at the same time, replace the file in one go
+    const auto TmpPath = Path + "." + std::to_string(::getpid()) + ".tmp";
+    int FD = ::open(TmpPath.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+    if (FD == -1) {
+      return;
+    }
+
+    const bool Written = ::write(FD, Data.data(), Data.size()) == static_cast<ssize_t>(Data.size());
+    ::close(FD);
+
+    if (!Written || ::rename(TmpPath.c_str(), Path.c_str()) != 0) {
+      LogMan::Msg::DFmt("Couldn't write startup snapshot '{}'", Path);
+      ::unlink(TmpPath.c_str());
+      return;
+    }
+
+    Dirty = false;
+  }
+}
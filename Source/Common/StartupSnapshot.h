@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Cache of startup work that only depends on a couple of files, shared between launches
+ *
+ * Each entry stores a list of strings along with the stat data of every file the strings were built from.
+ * An entry is only handed out while all of those files are unchanged, including ones that didn't exist.
+ * The whole snapshot is dropped when the FEX binary changes.
+ *
+ * Nothing is read or written unless the StartupSnapshot option is enabled, Get misses and Put does nothing otherwise.
+ */
+namespace FEX::StartupSnapshot {
+  struct FileStamp {
+    std::string Path;
+    bool Exists;
+    int64_t MTimeNS;
+    uint64_t Size;
+    uint64_t Inode;
+
+    bool operator==(FileStamp const&) const = default;
+  };
+
+  /**
+   * @brief Gets the current stamp of a file, directories work the same way
+   */
+  FileStamp Stamp(std::string const &Path);
+
+  /**
+   * @brief Gets the cached values of an entry if none of its input files changed
+   *
+   * @param Key Unique name of the entry, needs to contain everything besides the files that the values depend on
+   * @param Inputs The files the values depend on, need to be in the same order as when the entry was stored
+   */
+  std::optional<std::vector<std::string>> Get(std::string_view Key, std::vector<std::string> const &Inputs);
+
+  /**
+   * @brief Stores an entry, replacing any existing one with the same key
+   *
+   * @param Inputs Stamps of the input files taken before they were read
+   */
+  void Put(std::string_view Key, std::vector<FileStamp> Inputs, std::vector<std::string> Values);
+
+  /**
+   * @brief Writes the snapshot back to disk if any entries changed
+   */
+  void Save();
+}
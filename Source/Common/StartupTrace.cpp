@@ -0,0 +1,107 @@
+#include "Common/StartupTrace.h"
+
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXHeaderUtils/Syscalls.h>
+
+#include <array>
+#include <cstdint>
+#include <fcntl.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace FEX::StartupTrace {
+  struct Phase {
+    char const *Name;
+    uint64_t BeginNS;
+    uint64_t EndNS;
+  };
+
+  // Startup only has a couple dozen phases, anything past this is dropped
+  constexpr size_t MAX_PHASES = 128;
+  static std::array<Phase, MAX_PHASES> Phases;
+  static size_t NumPhases{};
+  static std::array<size_t, MAX_PHASES> OpenPhases;
+  static size_t NumOpenPhases{};
+  static size_t DroppedPhases{};
+
+  static uint64_t GetTime() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1'000'000'000ULL + ts.tv_nsec;
+  }
+
+  void Begin(char const *Name) {
+    if (NumPhases == MAX_PHASES) {
+      ++DroppedPhases;
+      return;
+    }
+
+    Phases[NumPhases] = Phase {
+      .Name = Name,
+      .BeginNS = GetTime(),
+      .EndNS = 0,
+    };
+    OpenPhases[NumOpenPhases++] = NumPhases++;
+  }
+
+  void End() {
+    if (DroppedPhases) {
+      // Matches a Begin that didn't fit
+      --DroppedPhases;
+      return;
+    }
+
+    if (NumOpenPhases == 0) {
+      return;
+    }
+
+    Phases[OpenPhases[--NumOpenPhases]].EndNS = GetTime();
+  }
+
+  void Write(std::string Filename) {
+    if (Filename.empty()) {
+      return;
+    }
+
+    const auto PID = ::getpid();
+    const auto TID = FHU::Syscalls::gettid();
+
+    auto PIDPos = Filename.find("%p");
+    if (PIDPos != std::string::npos) {
+      Filename.replace(PIDPos, 2, std::to_string(PID));
+    }
+
+    std::string Output = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool First = true;
+    for (size_t i = 0; i < NumPhases; ++i) {
+      auto const &Phase = Phases[i];
+      if (Phase.EndNS == 0) {
+        // Still running, only write complete phases
+        continue;
+      }
+
+      // Chrome trace timestamps are in microseconds
+      Output += fmt::format("{}{{\"name\":\"{}\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+        First ? "" : ",",
+        Phase.Name, PID, TID,
+        Phase.BeginNS / 1000.0,
+        (Phase.EndNS - Phase.BeginNS) / 1000.0);
+      First = false;
+    }
+    Output += "]}\n";
+
+    int FD = ::open(Filename.c_str(), O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+    if (FD == -1) {
+      LogMan::Msg::EFmt("Couldn't open startup trace file '{}'", Filename);
+      return;
+    }
+
+    if (::write(FD, Output.data(), Output.size()) != static_cast<ssize_t>(Output.size())) {
+      LogMan::Msg::EFmt("Couldn't write startup trace file '{}'", Filename);
+    }
+    ::close(FD);
+  }
+}
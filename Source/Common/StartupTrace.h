@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+
+/**
+ * @brief Timestamps of the frontend's startup phases
+ *
+ * Recording is always on since it is only a couple of clock reads per phase.
+ * The trace is written out in Chrome's trace event JSON format when the StartupTrace option names a file.
+ *
+ * Only meant to be used from the main thread while the frontend is starting up.
+ */
+namespace FEX::StartupTrace {
+  /**
+   * @brief Starts a phase, phases started before this one is ended nest inside of it
+   *
+   * @param Name Phase name, needs to outlive the trace
+   */
+  void Begin(char const *Name);
+
+  /**
+   * @brief Ends the most recently started phase
+   */
+  void End();
+
+  class ScopedPhase final {
+  public:
+    explicit ScopedPhase(char const *Name) {
+      Begin(Name);
+    }
+
+    ~ScopedPhase() {
+      End();
+    }
+  };
+
+  /**
+   * @brief Writes all finished phases to a Chrome trace JSON file
+   *
+   * @param Filename The file to write, `%p` is replaced with the process ID
+   */
+  void Write(std::string Filename);
+}
@@ -0,0 +1,222 @@
+/*
+$info$
+tags: glue|elf-parsing
+desc: Content based identity for ELF files, used to name the AOTIR caches
+$end_info$
+*/
+
+#include "Linux/Utils/ELFFileIdentity.h"
+
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <elf.h>
+#include <fmt/format.h>
+#include <mutex>
+#include <optional>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#include <xxhash.h>
+
+namespace ELFLoader {
+namespace {
+  // Notes and the build-id are tiny, anything bigger than this is malformed
+  constexpr size_t MAX_NOTE_SIZE = 64 * 1024;
+  constexpr size_t HASH_CHUNK_SIZE = 64 * 1024;
+
+  struct Segment {
+    uint32_t Type;
+    uint32_t Flags;
+    uint64_t Offset;
+    uint64_t FileSize;
+  };
+
+  template<typename Ehdr, typename Phdr>
+  std::optional<std::vector<Segment>> ReadSegments(int fd, off_t FileSize) {
+    Ehdr Header;
+    if (pread(fd, &Header, sizeof(Header), 0) != sizeof(Header) ||
+        Header.e_phentsize != sizeof(Phdr) ||
+        Header.e_phnum == 0 ||
+        Header.e_phoff + uint64_t(Header.e_phnum) * sizeof(Phdr) > uint64_t(FileSize)) {
+      return std::nullopt;
+    }
+
+    std::vector<Phdr> phdrs(Header.e_phnum);
+    const size_t Size = sizeof(Phdr) * phdrs.size();
+    if (pread(fd, phdrs.data(), Size, Header.e_phoff) != ssize_t(Size)) {
+      return std::nullopt;
+    }
+
+    std::vector<Segment> Segments;
+    Segments.reserve(phdrs.size());
+    for (auto const &phdr : phdrs) {
+      if (phdr.p_offset + uint64_t(phdr.p_filesz) > uint64_t(FileSize)) {
+        continue;
+      }
+      Segments.emplace_back(Segment {phdr.p_type, phdr.p_flags, phdr.p_offset, phdr.p_filesz});
+    }
+    return Segments;
+  }
+
+  std::optional<std::vector<Segment>> ReadSegments(int fd, off_t FileSize) {
+    std::array<uint8_t, EI_NIDENT> Ident;
+    if (pread(fd, Ident.data(), Ident.size(), 0) != ssize_t(Ident.size()) ||
+        Ident[EI_MAG0] != ELFMAG0 || Ident[EI_MAG1] != ELFMAG1 ||
+        Ident[EI_MAG2] != ELFMAG2 || Ident[EI_MAG3] != ELFMAG3) {
+      return std::nullopt;
+    }
+
+    if (Ident[EI_CLASS] == ELFCLASS32) {
+      return ReadSegments<Elf32_Ehdr, Elf32_Phdr>(fd, FileSize);
+    }
+    else if (Ident[EI_CLASS] == ELFCLASS64) {
+      return ReadSegments<Elf64_Ehdr, Elf64_Phdr>(fd, FileSize);
+    }
+
+    return std::nullopt;
+  }
+
+  std::string FindBuildID(int fd, std::vector<Segment> const &Segments) {
+    std::vector<uint8_t> Note;
+    for (auto const &Seg : Segments) {
+      if (Seg.Type != PT_NOTE || Seg.FileSize > MAX_NOTE_SIZE) {
+        continue;
+      }
+
+      Note.resize(Seg.FileSize);
+      if (pread(fd, Note.data(), Note.size(), Seg.Offset) != ssize_t(Note.size())) {
+        continue;
+      }
+
+      // Elf32_Nhdr and Elf64_Nhdr have the same layout, entries are 4 byte aligned in both cases
+      size_t Offset{};
+      while (Offset + sizeof(Elf64_Nhdr) <= Note.size()) {
+        Elf64_Nhdr Header;
+        memcpy(&Header, &Note[Offset], sizeof(Header));
+        Offset += sizeof(Header);
+
+        const size_t NameSize = (uint64_t(Header.n_namesz) + 3) & ~3ULL;
+        const size_t DescSize = (uint64_t(Header.n_descsz) + 3) & ~3ULL;
+        if (NameSize > Note.size() - Offset || DescSize > Note.size() - Offset - NameSize) {
+          break;
+        }
+
+        if (Header.n_type == NT_GNU_BUILD_ID &&
+            Header.n_namesz == sizeof(ELF_NOTE_GNU) &&
+            memcmp(&Note[Offset], ELF_NOTE_GNU, sizeof(ELF_NOTE_GNU)) == 0 &&
+            Header.n_descsz != 0) {
+          std::string BuildID;
+          BuildID.reserve(Header.n_descsz * 2);
+          for (size_t i = 0; i < Header.n_descsz; ++i) {
+            BuildID += fmt::format("{:02x}", Note[Offset + NameSize + i]);
+          }
+          return BuildID;
+        }
+
+        Offset += NameSize + DescSize;
+      }
+    }
+
+    return {};
+  }
+
+  std::string HashExecutableSegments(int fd, std::vector<Segment> const &Segments) {
+    XXH3_state_t *State = XXH3_createState();
+    XXH3_64bits_reset(State);
+
+    std::vector<uint8_t> Buffer(HASH_CHUNK_SIZE);
+    bool HashedAny{};
+    for (auto const &Seg : Segments) {
+      if (Seg.Type != PT_LOAD || !(Seg.Flags & PF_X)) {
+        continue;
+      }
+
+      // Include the segment placement so relinking the same code differently changes the identity
+      XXH3_64bits_update(State, &Seg.Offset, sizeof(Seg.Offset));
+      XXH3_64bits_update(State, &Seg.FileSize, sizeof(Seg.FileSize));
+
+      for (uint64_t Offset = 0; Offset < Seg.FileSize;) {
+        const size_t Size = std::min<uint64_t>(Buffer.size(), Seg.FileSize - Offset);
+        const ssize_t Read = pread(fd, Buffer.data(), Size, Seg.Offset + Offset);
+        if (Read <= 0) {
+          XXH3_freeState(State);
+          return {};
+        }
+        XXH3_64bits_update(State, Buffer.data(), Read);
+        Offset += Read;
+      }
+      HashedAny = true;
+    }
+
+    const uint64_t Hash = XXH3_64bits_digest(State);
+    XXH3_freeState(State);
+
+    if (!HashedAny) {
+      return {};
+    }
+
+    // Prefixed so it can never collide with a build-id
+    return fmt::format("x{:016x}", Hash);
+  }
+
+  struct FileKey {
+    dev_t Dev;
+    ino_t Ino;
+    int64_t MTimeSec;
+    int64_t MTimeNSec;
+    off_t Size;
+
+    bool operator==(FileKey const &rhs) const = default;
+  };
+
+  struct FileKeyHash {
+    size_t operator()(FileKey const &Key) const {
+      return XXH3_64bits(&Key, sizeof(Key));
+    }
+  };
+
+  std::mutex ContentHashCacheMutex;
+  std::unordered_map<FileKey, std::string, FileKeyHash> ContentHashCache;
+}
+
+std::string GetFileIdentity(int fd, struct stat64 const &Stat) {
+  if (!S_ISREG(Stat.st_mode)) {
+    return {};
+  }
+
+  auto Segments = ReadSegments(fd, Stat.st_size);
+  if (!Segments.has_value()) {
+    return {};
+  }
+
+  auto BuildID = FindBuildID(fd, *Segments);
+  if (!BuildID.empty()) {
+    return BuildID;
+  }
+
+  FileKey Key{};
+  Key.Dev = Stat.st_dev;
+  Key.Ino = Stat.st_ino;
+  Key.MTimeSec = Stat.st_mtim.tv_sec;
+  Key.MTimeNSec = Stat.st_mtim.tv_nsec;
+  Key.Size = Stat.st_size;
+
+  {
+    std::lock_guard lk(ContentHashCacheMutex);
+    auto it = ContentHashCache.find(Key);
+    if (it != ContentHashCache.end()) {
+      return it->second;
+    }
+  }
+
+  auto Hash = HashExecutableSegments(fd, *Segments);
+
+  std::lock_guard lk(ContentHashCacheMutex);
+  ContentHashCache.insert_or_assign(Key, Hash);
+  return Hash;
+}
+}
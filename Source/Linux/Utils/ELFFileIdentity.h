@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <sys/stat.h>
+
+namespace ELFLoader {
+/**
+ * @brief Returns an identity for the code contained in an ELF file
+ *
+ * Uses the GNU build-id note if the file has one, otherwise an XXH3 of the file contents backing the executable
+ * segments. The fallback hash is computed once per device, inode and modification time.
+ *
+ * The same code reached through different paths gets the same identity and a rebuilt file gets a new one.
+ *
+ * @param fd File descriptor of the file, only read with pread
+ * @param Stat Result of fstat on fd
+ *
+ * @return Hex identity string, or empty if the file isn't an ELF
+ */
+std::string GetFileIdentity(int fd, struct stat64 const &Stat);
+}
@@ -1,18 +1,123 @@
 #include "ELFCodeLoader2.h"
 #include "Linux/Utils/ELFContainer.h"
 
+#include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/Context.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXHeaderUtils/Syscalls.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <fcntl.h>
+#include <filesystem>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <string_view>
 #include <sys/resource.h>
 #include <sys/sysinfo.h>
 #include <thread>
-#include <queue>
+#include <unistd.h>
+#include <unordered_set>
+#include <vector>
 
 namespace FEX::AOT {
+namespace {
+  /**
+   * @brief Entrypoints owned by a single worker
+   *
+   * The owner pushes and pops at the back, idle workers steal from the front.
+   * Compiling a block is orders of magnitude slower than taking the lock, so a plain mutex is enough here.
+   */
+  class WorkQueue {
+  public:
+    void Push(uint64_t Entry) {
+      std::lock_guard lk(Mutex);
+      Entries.push_back(Entry);
+    }
+
+    std::optional<uint64_t> Pop() {
+      std::lock_guard lk(Mutex);
+      if (Entries.empty()) {
+        return std::nullopt;
+      }
+      auto Entry = Entries.back();
+      Entries.pop_back();
+      return Entry;
+    }
+
+    std::optional<uint64_t> Steal() {
+      std::lock_guard lk(Mutex);
+      if (Entries.empty()) {
+        return std::nullopt;
+      }
+      auto Entry = Entries.front();
+      Entries.pop_front();
+      return Entry;
+    }
+
+  private:
+    std::mutex Mutex;
+    std::deque<uint64_t> Entries;
+  };
+
+  // Splits a file id in to the filename and flags, dropping the identity in between
+  bool SplitFileId(std::string_view FileId, std::string_view *Filename, std::string_view *Flags) {
+    auto FlagsSeparator = FileId.rfind('-');
+    if (FlagsSeparator == std::string_view::npos || FlagsSeparator == 0) {
+      return false;
+    }
+
+    auto IdentitySeparator = FileId.rfind('-', FlagsSeparator - 1);
+    if (IdentitySeparator == std::string_view::npos) {
+      return false;
+    }
+
+    *Filename = FileId.substr(0, IdentitySeparator);
+    *Flags = FileId.substr(FlagsSeparator + 1);
+    return true;
+  }
+}
+
+int OpenPreviousAOTIRCache(const std::filesystem::path &AOTIRDir, const std::string &fileid) {
+  std::string_view Filename, Flags;
+  if (!SplitFileId(fileid, &Filename, &Flags)) {
+    return -1;
+  }
+
+  std::error_code ec;
+  std::filesystem::path Newest;
+  std::filesystem::file_time_type NewestTime{};
+  for (const auto &Entry : std::filesystem::directory_iterator(AOTIRDir, ec)) {
+    if (Entry.path().extension() != ".aotir") {
+      continue;
+    }
+
+    const auto Stem = Entry.path().stem().string();
+    std::string_view EntryFilename, EntryFlags;
+    if (!SplitFileId(Stem, &EntryFilename, &EntryFlags) || EntryFilename != Filename || EntryFlags != Flags) {
+      continue;
+    }
+
+    const auto Time = Entry.last_write_time(ec);
+    if (!ec && (Newest.empty() || Time > NewestTime)) {
+      Newest = Entry.path();
+      NewestTime = Time;
+    }
+  }
+
+  if (Newest.empty()) {
+    return -1;
+  }
+
+  LogMan::Msg::IFmt("AOTIR: Reusing {} for {}", Newest.filename().string(), fileid);
+  return open(Newest.c_str(), O_RDONLY);
+}
+
 void AOTGenSection(FEXCore::Context::Context *CTX, ELFCodeLoader2::LoadedSection &Section) {
   // Make sure this section is executable and big enough
   if (!Section.Executable || Section.Size < 16)
@@ -77,26 +182,48 @@ void AOTGenSection(FEXCore::Context::Context *CTX, ELFCodeLoader2::LoadedSection
 
   uint64_t SectionMaxAddress = Section.Base + Section.Size;
 
-  std::set<uint64_t> Compiled;
-  std::atomic<int> counter = 0;
+  const size_t NumWorkers = std::max(get_nprocs_conf(), 1);
+
+  std::vector<WorkQueue> Queues(NumWorkers);
+
+  // Entrypoints that have been queued at some point, so nothing is compiled twice
+  std::mutex CompiledMutex;
+  std::unordered_set<uint64_t> Compiled;
 
-  std::queue<uint64_t> BranchTargets;
+  // Entrypoints that are queued or being compiled, generation is done once this hits zero
+  std::atomic<size_t> Pending = InitialBranchTargets.size();
+  // Entrypoints sitting in any of the queues
+  std::atomic<size_t> Queued = InitialBranchTargets.size();
+  std::atomic<size_t> CompiledCount = 0;
 
-  // Setup BranchTargets, Compiled sets from InitiaBranchTargets
+  // Idle workers sleep until there is something to steal or everything is done
+  std::mutex WorkMutex;
+  std::condition_variable WorkCV;
+  auto NotifyWorkers = [&WorkMutex, &WorkCV]() {
+    // Taking the lock orders this with a worker that is about to wait
+    { std::lock_guard lk(WorkMutex); }
+    WorkCV.notify_all();
+  };
 
-  Compiled.insert(InitialBranchTargets.begin(), InitialBranchTargets.end());
+  // Hand out the seed in contiguous chunks so each worker starts out walking nearby code
+  Compiled.reserve(InitialBranchTargets.size());
+  size_t TargetIndex{};
   for (auto BranchTarget: InitialBranchTargets) {
-    BranchTargets.push(BranchTarget);
+    Compiled.insert(BranchTarget);
+    Queues[TargetIndex * NumWorkers / InitialBranchTargets.size()].Push(BranchTarget);
+    ++TargetIndex;
   }
 
   InitialBranchTargets.clear();
 
+  std::mutex DoneMutex;
+  std::condition_variable DoneCV;
+  size_t ActiveWorkers = NumWorkers;
 
-  std::mutex QueueMutex;
   std::vector<std::thread> ThreadPool;
 
-  for (int i = 0; i < get_nprocs_conf(); i++) {
-    std::thread thd([&BranchTargets, CTX, &counter, &Compiled, &Section, &QueueMutex, SectionMaxAddress]() {
+  for (size_t i = 0; i < NumWorkers; i++) {
+    std::thread thd([&, i]() {
       // Set the priority of the thread so it doesn't overwhelm the system when running in the background
       setpriority(PRIO_PROCESS, FHU::Syscalls::gettid(), 19);
 
@@ -106,50 +233,82 @@ void AOTGenSection(FEXCore::Context::Context *CTX, ELFCodeLoader2::LoadedSection
       std::set<uint64_t> ExternalBranchesLocal;
       FEXCore::Context::ConfigureAOTGen(Thread, &ExternalBranchesLocal, SectionMaxAddress);
 
+      auto &LocalQueue = Queues[i];
 
       for (;;) {
-        uint64_t BranchTarget;
+        // Own work first, newest entry so we stay close to the code we just compiled
+        auto BranchTarget = LocalQueue.Pop();
 
-        // Get a entrypoint to process from the queue
-        QueueMutex.lock();
-        if (BranchTargets.empty()) {
-          QueueMutex.unlock();
-          break; // no entrypoint to process - exit
+        // Otherwise steal the oldest entry from someone else
+        for (size_t Victim = 1; !BranchTarget && Victim < NumWorkers; ++Victim) {
+          BranchTarget = Queues[(i + Victim) % NumWorkers].Steal();
         }
 
-        BranchTarget = BranchTargets.front();
-        BranchTargets.pop();
-        QueueMutex.unlock();
+        if (!BranchTarget) {
+          // Someone is still compiling and might produce more work
+          std::unique_lock lk(WorkMutex);
+          WorkCV.wait(lk, [&]() { return Queued.load() != 0 || Pending.load() == 0; });
 
-        // Compile entrypoint
-        counter++;
-        FEXCore::Context::CompileRIP(Thread, BranchTarget);
+          if (Queued.load() == 0) {
+            break; // Nothing queued and nothing being compiled that could queue more - exit
+          }
+          continue;
+        }
+
+        Queued--;
+
+        // Compile entrypoint, with AOTIRIncremental unchanged code reuses its existing IR
+        CompiledCount++;
+        FEXCore::Context::CompileRIP(Thread, *BranchTarget);
+
+        bool FoundBranches{};
 
         // Are there more branches?
         if (ExternalBranchesLocal.size() > 0) {
           // Add them to the "to process" list
-          QueueMutex.lock();
-          for(auto Destination: ExternalBranchesLocal) {
-              if (! (Destination >= Section.Base && Destination <= (Section.Base + Section.Size)) )
-                continue;
-              if (Compiled.contains(Destination))
-                continue;
-              Compiled.insert(Destination);
-            BranchTargets.push(Destination);
+          std::lock_guard lk(CompiledMutex);
+          for (auto Destination: ExternalBranchesLocal) {
+            if (! (Destination >= Section.Base && Destination <= (Section.Base + Section.Size)) )
+              continue;
+            if (!Compiled.insert(Destination).second)
+              continue;
+            Pending++;
+            LocalQueue.Push(Destination);
+            Queued++;
+            FoundBranches = true;
           }
-          QueueMutex.unlock();
           ExternalBranchesLocal.clear();
         }
+
+        // Only drop this entry once the branches it found are queued
+        if (--Pending == 0 || FoundBranches) {
+          NotifyWorkers();
+        }
       }
 
       // All entryproints processed, cleanup this thread
       FEXCore::Context::DestroyThread(CTX, Thread);
+
+      {
+        std::lock_guard lk(DoneMutex);
+        --ActiveWorkers;
+      }
+      DoneCV.notify_one();
     });
 
     // Add to the thread pool
     ThreadPool.push_back(std::move(thd));
   }
 
+  // Report progress until the workers are done
+  {
+    std::unique_lock lk(DoneMutex);
+    while (!DoneCV.wait_for(lk, std::chrono::seconds(1), [&ActiveWorkers]() { return ActiveWorkers == 0; })) {
+      LogMan::Msg::IFmt("AOTIR: {}: {} compiled, {} pending",
+        Section.Filename, CompiledCount.load(), Pending.load());
+    }
+  }
+
   // Make sure all threads are finished
   for (auto & Thread: ThreadPool) {
     Thread.join();
@@ -157,6 +316,6 @@ void AOTGenSection(FEXCore::Context::Context *CTX, ELFCodeLoader2::LoadedSection
 
   ThreadPool.clear();
 
-  LogMan::Msg::IFmt("\nAll Done: {}", counter.load());
+  LogMan::Msg::IFmt("\nAll Done: {} compiled", CompiledCount.load());
 }
 }
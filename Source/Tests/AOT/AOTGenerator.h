@@ -2,6 +2,18 @@
 
 #include "ELFCodeLoader2.h"
 
+#include <filesystem>
+#include <string>
+
 namespace FEX::AOT {
   void AOTGenSection(FEXCore::Context::Context *CTX, ELFCodeLoader2::LoadedSection &Section);
+
+  /**
+   * @brief Opens the newest cache in AOTIRDir that was generated for another version of the same file
+   *
+   * File ids are `<filename>-<identity>-<flags>`, a match has the same filename and flags.
+   *
+   * @return The file descriptor or -1 if there is no such cache
+   */
+  int OpenPreviousAOTIRCache(const std::filesystem::path &AOTIRDir, const std::string &fileid);
 }
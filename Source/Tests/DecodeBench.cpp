@@ -0,0 +1,336 @@
+/*
+$info$
+tags: Bin|DecodeBench
+desc: Measures x86 decode throughput of the frontend over the executable sections of ELF files
+$end_info$
+*/
+
+#include "Common/ArgumentLoader.h"
+#include "Tests/LinuxSyscalls/SignalDelegator.h"
+
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Debug/ContextDebug.h>
+#include <FEXCore/HLE/SyscallHandler.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <elf.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <shared_mutex>
+#include <stdio.h>
+#include <string>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <fmt/format.h>
+
+void MsgHandler(LogMan::DebugLevels Level, char const *Message)
+{
+  const char *CharLevel{nullptr};
+
+  switch (Level)
+  {
+  case LogMan::NONE:
+    CharLevel = "NONE";
+    break;
+  case LogMan::ASSERT:
+    CharLevel = "ASSERT";
+    break;
+  case LogMan::ERROR:
+    CharLevel = "ERROR";
+    break;
+  case LogMan::DEBUG:
+    // Every undecodable byte sequence logs, which would drown out the results
+    return;
+  case LogMan::INFO:
+    CharLevel = "Info";
+    break;
+  case LogMan::STDOUT:
+    CharLevel = "STDOUT";
+    break;
+  case LogMan::STDERR:
+    CharLevel = "STDERR";
+    break;
+  default:
+    CharLevel = "???";
+    break;
+  }
+
+  fmt::print("[{}] {}\n", CharLevel, Message);
+  fflush(stdout);
+}
+
+void AssertHandler(char const *Message)
+{
+  fmt::print("[ASSERT] {}\n", Message);
+  fflush(stdout);
+}
+
+class TextSectionLoader final {
+public:
+  struct Section {
+    std::string Name;
+    uint64_t Base;
+    uint64_t Size;
+  };
+
+  explicit TextSectionLoader(std::string const &Filename)
+    : Filename {Filename} {
+    std::ifstream fp(Filename, std::ios::binary);
+    if (!fp.is_open()) {
+      LogMan::Msg::EFmt("Couldn't open '{}'", Filename);
+      return;
+    }
+
+    Data.assign(std::istreambuf_iterator<char>(fp), std::istreambuf_iterator<char>());
+
+    if (Data.size() < EI_NIDENT || memcmp(Data.data(), ELFMAG, SELFMAG) != 0) {
+      LogMan::Msg::EFmt("'{}' isn't an ELF file", Filename);
+      return;
+    }
+
+    if (Data[EI_CLASS] == ELFCLASS64) {
+      Is64Bit = true;
+      Valid = LoadSections<Elf64_Ehdr, Elf64_Shdr>(EM_X86_64);
+    }
+    else if (Data[EI_CLASS] == ELFCLASS32) {
+      Is64Bit = false;
+      Valid = LoadSections<Elf32_Ehdr, Elf32_Shdr>(EM_386);
+    }
+    else {
+      LogMan::Msg::EFmt("'{}' has an unknown ELF class", Filename);
+    }
+  }
+
+  ~TextSectionLoader() {
+    for (auto const &Section : Sections) {
+      FEXCore::Allocator::munmap(reinterpret_cast<void*>(Section.Base), MappingSize(Section.Size));
+    }
+  }
+
+  bool IsValid() const { return Valid; }
+  bool Is64BitMode() const { return Is64Bit; }
+  std::string const &GetFilename() const { return Filename; }
+  std::vector<Section> const &GetSections() const { return Sections; }
+
+private:
+  // Blocks running off the end of a section stop on these
+  constexpr static size_t PADDING_SIZE = 64;
+  constexpr static uint8_t RET = 0xC3;
+
+  static uint64_t MappingSize(uint64_t Size) {
+    const uint64_t PageSize = sysconf(_SC_PAGESIZE);
+    return (Size + PADDING_SIZE + PageSize - 1) & ~(PageSize - 1);
+  }
+
+  template<typename EhdrType, typename ShdrType>
+  bool LoadSections(uint16_t Machine) {
+    EhdrType Header;
+    if (Data.size() < sizeof(Header)) {
+      LogMan::Msg::EFmt("'{}' is truncated", Filename);
+      return false;
+    }
+    memcpy(&Header, Data.data(), sizeof(Header));
+
+    if (Header.e_machine != Machine) {
+      LogMan::Msg::EFmt("'{}' isn't an x86 ELF", Filename);
+      return false;
+    }
+
+    if (Header.e_shentsize != sizeof(ShdrType) || Header.e_shoff + uint64_t(Header.e_shnum) * sizeof(ShdrType) > Data.size()) {
+      LogMan::Msg::EFmt("'{}' has no usable section headers", Filename);
+      return false;
+    }
+
+    std::vector<ShdrType> SectionHeaders(Header.e_shnum);
+    memcpy(SectionHeaders.data(), &Data[Header.e_shoff], Header.e_shnum * sizeof(ShdrType));
+
+    auto GetName = [&](uint32_t Offset) -> std::string {
+      if (Header.e_shstrndx >= SectionHeaders.size()) {
+        return {};
+      }
+      auto const &StringTable = SectionHeaders[Header.e_shstrndx];
+      if (Offset >= StringTable.sh_size || StringTable.sh_offset + StringTable.sh_size > Data.size()) {
+        return {};
+      }
+      auto Begin = reinterpret_cast<char const*>(&Data[StringTable.sh_offset + Offset]);
+      return std::string(Begin, strnlen(Begin, StringTable.sh_size - Offset));
+    };
+
+    for (auto const &SectionHeader : SectionHeaders) {
+      if (SectionHeader.sh_type != SHT_PROGBITS || !(SectionHeader.sh_flags & SHF_EXECINSTR) || SectionHeader.sh_size == 0) {
+        continue;
+      }
+
+      if (SectionHeader.sh_offset + SectionHeader.sh_size > Data.size()) {
+        LogMan::Msg::EFmt("'{}' is truncated", Filename);
+        return false;
+      }
+
+      // Decoding only reads the code, where it lives doesn't matter
+      const uint64_t Size = SectionHeader.sh_size;
+      void *Ptr = FEXCore::Allocator::mmap(nullptr, MappingSize(Size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (Ptr == MAP_FAILED) {
+        LogMan::Msg::EFmt("Couldn't map a section of '{}'", Filename);
+        return false;
+      }
+
+      auto Code = reinterpret_cast<uint8_t*>(Ptr);
+      memcpy(Code, &Data[SectionHeader.sh_offset], Size);
+      memset(Code + Size, RET, PADDING_SIZE);
+
+      Sections.emplace_back(Section {
+        .Name = GetName(SectionHeader.sh_name),
+        .Base = reinterpret_cast<uint64_t>(Code),
+        .Size = Size,
+      });
+    }
+
+    return true;
+  }
+
+  std::string Filename;
+  bool Valid{};
+  bool Is64Bit{};
+  std::vector<uint8_t> Data;
+  std::vector<Section> Sections;
+};
+
+class DummySyscallHandler: public FEXCore::HLE::SyscallHandler {
+  public:
+
+  uint64_t HandleSyscall(FEXCore::Core::CpuStateFrame *Frame, FEXCore::HLE::SyscallArguments *Args) override {
+    LOGMAN_MSG_A_FMT("Syscalls not implemented");
+    return 0;
+  }
+
+  FEXCore::HLE::SyscallABI GetSyscallABI(uint64_t Syscall) override {
+    LOGMAN_MSG_A_FMT("Syscalls not implemented");
+    return {0, false, 0 };
+  }
+
+  // These are no-ops implementations of the SyscallHandler API
+  std::shared_mutex StubMutex;
+  FEXCore::HLE::AOTIRCacheEntryLookupResult LookupAOTIRCacheEntry(uint64_t GuestAddr) override {
+    return {0, 0, FHU::ScopedSignalMaskWithSharedLock {StubMutex}};
+  }
+};
+
+namespace {
+  struct BenchResult {
+    FEXCore::Context::Debug::DecodeRangeStats Stats{};
+    uint64_t TimeNS{};
+  };
+
+  void PrintResult(std::string_view Name, BenchResult const &Result, uint64_t Iterations) {
+    const double Seconds = Result.TimeNS / 1'000'000'000.0;
+    const auto &S = Result.Stats;
+    fmt::print("{:<40} {:>10} {:>10} {:>8} {:>10.2f} {:>10.2f} {:>8.2f}\n",
+      Name, S.Bytes, S.Instructions, S.InvalidInstructions,
+      Seconds ? S.Bytes * Iterations / Seconds / (1024.0 * 1024.0) : 0.0,
+      Seconds ? S.Instructions * Iterations / Seconds / 1'000'000.0 : 0.0,
+      S.Instructions ? double(Result.TimeNS) / double(S.Instructions * Iterations) : 0.0);
+  }
+}
+
+int main(int argc, char **argv, char **const envp)
+{
+  LogMan::Throw::InstallHandler(AssertHandler);
+  LogMan::Msg::InstallHandler(MsgHandler);
+
+  FEXCore::Config::Initialize();
+  FEXCore::Config::AddLayer(std::make_unique<FEX::ArgLoader::ArgLoader>(argc, argv));
+  FEXCore::Config::AddLayer(FEXCore::Config::CreateEnvironmentLayer(envp));
+  FEXCore::Config::Load();
+
+  auto Args = FEX::ArgLoader::Get();
+
+  if (Args.size() < 2) {
+    fmt::print("usage: DecodeBench <iterations> <elf> [elf...]\n");
+    fmt::print("  eg. DecodeBench 10 <rootfs>/lib/x86_64-linux-gnu/libc.so.6 <rootfs>/lib/x86_64-linux-gnu/libstdc++.so.6\n");
+    return -1;
+  }
+
+  const uint64_t Iterations = std::max(std::stoull(Args[0]), 1ULL);
+
+  std::vector<std::unique_ptr<TextSectionLoader>> Files;
+  for (size_t i = 1; i < Args.size(); ++i) {
+    auto Loader = std::make_unique<TextSectionLoader>(Args[i]);
+    if (!Loader->IsValid()) {
+      return -1;
+    }
+
+    // A context only decodes one guest mode
+    if (!Files.empty() && Loader->Is64BitMode() != Files.front()->Is64BitMode()) {
+      LogMan::Msg::EFmt("'{}' doesn't have the same bitness as '{}'", Args[i], Files.front()->GetFilename());
+      return -1;
+    }
+    Files.emplace_back(std::move(Loader));
+  }
+
+  const bool Is64BitMode = Files.front()->Is64BitMode();
+  FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_IS64BIT_MODE, Is64BitMode ? "1" : "0");
+  // Every iteration needs to decode again
+  FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_DECODECACHESIZE, "0");
+
+  FEXCore::Context::InitializeStaticTables(Is64BitMode ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
+  auto CTX = FEXCore::Context::CreateNewContext();
+  FEXCore::Context::InitializeContext(CTX);
+
+  std::unique_ptr<FEX::HLE::SignalDelegator> SignalDelegation = std::make_unique<FEX::HLE::SignalDelegator>();
+  std::unique_ptr<DummySyscallHandler> SyscallHandler = std::make_unique<DummySyscallHandler>();
+
+  FEXCore::Context::SetSignalDelegator(CTX, SignalDelegation.get());
+  FEXCore::Context::SetSyscallHandler(CTX, SyscallHandler.get());
+
+  // Nothing is executed, the thread only provides the frontend
+  FEXCore::Context::InitCore(CTX, 0, 0);
+
+  fmt::print("{:<40} {:>10} {:>10} {:>8} {:>10} {:>10} {:>8}\n",
+    "Section", "Bytes", "Insts", "Invalid", "MiB/s", "MInsts/s", "ns/inst");
+
+  BenchResult Overall{};
+
+  for (auto const &File : Files) {
+    for (auto const &Section : File->GetSections()) {
+      BenchResult Result{};
+
+      // Warm up, so the first section doesn't pay for cold caches and page faults
+      FEXCore::Context::Debug::DecodeRange(CTX, Section.Base, Section.Size, &Result.Stats);
+
+      const auto Begin = std::chrono::steady_clock::now();
+      for (uint64_t i = 0; i < Iterations; ++i) {
+        FEXCore::Context::Debug::DecodeRange(CTX, Section.Base, Section.Size, &Result.Stats);
+      }
+      Result.TimeNS = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Begin).count();
+
+      const auto Name = fmt::format("{}:{}", std::filesystem::path(File->GetFilename()).filename().string(), Section.Name);
+      PrintResult(Name, Result, Iterations);
+
+      Overall.Stats.Blocks += Result.Stats.Blocks;
+      Overall.Stats.Instructions += Result.Stats.Instructions;
+      Overall.Stats.InvalidInstructions += Result.Stats.InvalidInstructions;
+      Overall.Stats.Bytes += Result.Stats.Bytes;
+      Overall.TimeNS += Result.TimeNS;
+    }
+  }
+
+  PrintResult("total", Overall, Iterations);
+
+  FEXCore::Context::DestroyContext(CTX);
+
+  // Sections are unmapped by the loaders, after the context stopped looking at them
+  Files.clear();
+
+  return 0;
+}
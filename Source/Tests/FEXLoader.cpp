@@ -8,6 +8,8 @@ $end_info$
 #include "AOT/AOTGenerator.h"
 #include "Common/ArgumentLoader.h"
 #include "Common/FEXServerClient.h"
+#include "Common/StartupSnapshot.h"
+#include "Common/StartupTrace.h"
 #include "ELFCodeLoader2.h"
 #include "VDSO_Emulation.h"
 #include "Tests/LinuxSyscalls/LinuxAllocator.h"
@@ -197,6 +199,7 @@ bool IsInterpreterInstalled() {
 }
 
 int main(int argc, char **argv, char **const envp) {
+  FEX::StartupTrace::Begin("Startup");
   const bool IsInterpreter = RanAsInterpreter(argv[0]);
 
   ExecutedWithFD = getauxval(AT_EXECFD) != 0;
@@ -204,11 +207,13 @@ int main(int argc, char **argv, char **const envp) {
   LogMan::Throw::InstallHandler(AssertHandler);
   LogMan::Msg::InstallHandler(MsgHandler);
 
+  FEX::StartupTrace::Begin("LoadConfig");
   auto Program = FEX::Config::LoadConfig(
     IsInterpreter,
     true,
     argc, argv, envp
   );
+  FEX::StartupTrace::End();
 
   if (Program.first.empty()) {
     // Early exit if we weren't passed an argument
@@ -219,7 +224,9 @@ int main(int argc, char **argv, char **const envp) {
   auto ParsedArgs = FEX::ArgLoader::GetParsedArgs();
 
   // Reload the meta layer
+  FEX::StartupTrace::Begin("ReloadMetaLayer");
   FEXCore::Config::ReloadMetaLayer();
+  FEX::StartupTrace::End();
   FEXCore::Config::Set(FEXCore::Config::CONFIG_IS_INTERPRETER, IsInterpreter ? "1" : "0");
   FEXCore::Config::Set(FEXCore::Config::CONFIG_INTERPRETER_INSTALLED, IsInterpreterInstalled() ? "1" : "0");
 
@@ -234,19 +241,23 @@ int main(int argc, char **argv, char **const envp) {
   }
 
   // Ensure FEXServer is setup before config options try to pull CONFIG_ROOTFS
+  FEX::StartupTrace::Begin("FEXServerClient::SetupClient");
   if (!FEXServerClient::SetupClient(argv[0])) {
     LogMan::Msg::EFmt("FEXServerClient: Failure to setup client");
     return -1;
   }
+  FEX::StartupTrace::End();
 
   FEX_CONFIG_OPT(SilentLog, SILENTLOG);
   FEX_CONFIG_OPT(AOTIRCapture, AOTIRCAPTURE);
   FEX_CONFIG_OPT(AOTIRGenerate, AOTIRGENERATE);
+  FEX_CONFIG_OPT(AOTIRIncremental, AOTIRINCREMENTAL);
   FEX_CONFIG_OPT(AOTIRLoad, AOTIRLOAD);
   FEX_CONFIG_OPT(OutputLog, OUTPUTLOG);
   FEX_CONFIG_OPT(LDPath, ROOTFS);
   FEX_CONFIG_OPT(Environment, ENV);
   FEX_CONFIG_OPT(HostEnvironment, HOSTENV);
+  FEX_CONFIG_OPT(StartupTrace, STARTUPTRACE);
   ::SilentLog = SilentLog();
 
   if (::SilentLog) {
@@ -286,8 +297,10 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Profiler::Init();
   FEXCore::Telemetry::Initialize();
 
+  FEX::StartupTrace::Begin("RootFSRedirect");
   RootFSRedirect(&Program.first, LDPath());
   InterpreterHandler(&Program.first, LDPath(), &Args);
+  FEX::StartupTrace::End();
 
   std::error_code ec{};
   if (!std::filesystem::exists(Program.first, ec)) {
@@ -310,7 +323,9 @@ int main(int argc, char **argv, char **const envp) {
     putenv(HostEnv.data());
   }
 
+  FEX::StartupTrace::Begin("ELFCodeLoader2");
   ELFCodeLoader2 Loader{Program.first, LDPath(), Args, ParsedArgs, envp, &Environment};
+  FEX::StartupTrace::End();
   //FEX::HarnessHelper::ELFCodeLoader Loader{Program.first, LDPath(), Args, ParsedArgs, envp, &Environment};
 
   if (!Loader.ELFWasLoaded()) {
@@ -336,6 +351,8 @@ int main(int argc, char **argv, char **const envp) {
   std::unique_ptr<FEX::HLE::MemAllocator> Allocator;
   std::vector<FEXCore::Allocator::MemoryRegion> Base48Bit;
 
+  FEX::StartupTrace::Begin("AllocatorSetup");
+
   if (Loader.Is64BitMode()) {
     // Destroy the 48th bit if it exists
     Base48Bit = FEXCore::Allocator::Steal48BitVA();
@@ -359,11 +376,17 @@ int main(int argc, char **argv, char **const envp) {
     }
   }
 
+  FEX::StartupTrace::End();
+
   // System allocator is now system allocator or FEX
+  FEX::StartupTrace::Begin("InitializeStaticTables");
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
+  FEX::StartupTrace::End();
 
+  FEX::StartupTrace::Begin("CreateContext");
   auto CTX = FEXCore::Context::CreateNewContext();
   FEXCore::Context::InitializeContext(CTX);
+  FEX::StartupTrace::End();
 
   auto SignalDelegation = std::make_unique<FEX::HLE::SignalDelegator>();
 
@@ -385,22 +408,28 @@ int main(int argc, char **argv, char **const envp) {
     return false;
   }, true);
 
+  FEX::StartupTrace::Begin("CreateSyscallHandler");
   auto SyscallHandler = Loader.Is64BitMode() ? FEX::HLE::x64::CreateHandler(CTX, SignalDelegation.get())
                                              : FEX::HLE::x32::CreateHandler(CTX, SignalDelegation.get(), std::move(Allocator));
+  FEX::StartupTrace::End();
 
   auto Mapper = std::bind_front(&FEX::HLE::SyscallHandler::GuestMmap, SyscallHandler.get());
   auto Unmapper = std::bind_front(&FEX::HLE::SyscallHandler::GuestMunmap, SyscallHandler.get());
 
   // Load VDSO in to memory prior to mapping our ELFs.
+  FEX::StartupTrace::Begin("LoadVDSOThunks");
   void* VDSOBase = FEX::VDSO::LoadVDSOThunks(Loader.Is64BitMode(), Mapper);
+  FEX::StartupTrace::End();
   Loader.SetVDSOBase(VDSOBase);
   Loader.CalculateHWCaps(CTX);
 
+  FEX::StartupTrace::Begin("MapMemory");
   if (!Loader.MapMemory(Mapper, Unmapper)) {
     // failed to map
     LogMan::Msg::EFmt("Failed to map %d-bit elf file.", Loader.Is64BitMode() ? 64 : 32);
     return -ENOEXEC;
   }
+  FEX::StartupTrace::End();
 
   SyscallHandler->SetCodeLoader(&Loader);
 
@@ -410,7 +439,9 @@ int main(int argc, char **argv, char **const envp) {
 
   FEXCore::Context::SetSignalDelegator(CTX, SignalDelegation.get());
   FEXCore::Context::SetSyscallHandler(CTX, SyscallHandler.get());
+  FEX::StartupTrace::Begin("InitCore");
   FEXCore::Context::InitCore(CTX, Loader.DefaultRIP(), Loader.GetStackPointer());
+  FEX::StartupTrace::End();
 
   // Pass in our VDSO thunks
   FEXCore::Context::AppendThunkDefinitions(CTX, FEX::VDSO::GetVDSOThunkDefinitions());
@@ -432,10 +463,16 @@ int main(int argc, char **argv, char **const envp) {
     LogMan::Msg::IFmt("Warning: AOTIR is experimental, and might lead to crashes. "
                       "Capture doesn't work with programs that fork.");
 
-    FEXCore::Context::SetAOTIRLoader(CTX, [](const std::string &fileid) -> int {
+    const bool Incremental = AOTIRGenerate() && AOTIRIncremental();
+    FEXCore::Context::SetAOTIRLoader(CTX, [Incremental](const std::string &fileid) -> int {
       auto filepath = std::filesystem::path(FEXCore::Config::GetDataDirectory()) / "aotir" / (fileid + ".aotir");
 
-      return open(filepath.c_str(), O_RDONLY);
+      int fd = open(filepath.c_str(), O_RDONLY);
+      if (fd == -1 && Incremental) {
+        // The file changed since the last generation, unchanged functions can still be taken from the old cache
+        fd = FEX::AOT::OpenPreviousAOTIRCache(filepath.parent_path(), fileid);
+      }
+      return fd;
     });
 
     FEXCore::Context::SetAOTIRWriter(CTX, [](const std::string& fileid) -> std::unique_ptr<std::ofstream> {
@@ -460,6 +497,11 @@ int main(int argc, char **argv, char **const envp) {
     });
   }
 
+  // Everything up to here is startup, the guest takes over from now on
+  FEX::StartupTrace::End();
+  FEX::StartupTrace::Write(StartupTrace());
+  FEX::StartupSnapshot::Save();
+
   if (AOTIRGenerate()) {
     for(auto &Section: Loader.Sections) {
       FEX::AOT::AOTGenSection(CTX, Section);
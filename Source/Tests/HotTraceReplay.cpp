@@ -0,0 +1,361 @@
+/*
+$info$
+tags: Bin|HotTraceReplay
+desc: Replays blocks captured with HotTraceCapture through the compiler and reports compile times
+$end_info$
+*/
+
+#include "Common/ArgumentLoader.h"
+#include "Tests/LinuxSyscalls/SignalDelegator.h"
+
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Debug/ContextDebug.h>
+#include <FEXCore/Debug/HotTrace.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/HLE/SyscallHandler.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <shared_mutex>
+#include <stdio.h>
+#include <string>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <fmt/format.h>
+
+void MsgHandler(LogMan::DebugLevels Level, char const *Message)
+{
+  const char *CharLevel{nullptr};
+
+  switch (Level)
+  {
+  case LogMan::NONE:
+    CharLevel = "NONE";
+    break;
+  case LogMan::ASSERT:
+    CharLevel = "ASSERT";
+    break;
+  case LogMan::ERROR:
+    CharLevel = "ERROR";
+    break;
+  case LogMan::DEBUG:
+    CharLevel = "DEBUG";
+    break;
+  case LogMan::INFO:
+    CharLevel = "Info";
+    break;
+  case LogMan::STDOUT:
+    CharLevel = "STDOUT";
+    break;
+  case LogMan::STDERR:
+    CharLevel = "STDERR";
+    break;
+  default:
+    CharLevel = "???";
+    break;
+  }
+
+  fmt::print("[{}] {}\n", CharLevel, Message);
+  fflush(stdout);
+}
+
+void AssertHandler(char const *Message)
+{
+  fmt::print("[ASSERT] {}\n", Message);
+  fflush(stdout);
+}
+
+class HotTraceLoader final {
+public:
+  struct Block {
+    FEXCore::HotTrace::BlockHeader Header;
+    std::string Filename;
+    uint8_t const *Code;
+    // Guest memory for the block couldn't be mapped at its original address
+    bool Unmappable;
+  };
+
+  explicit HotTraceLoader(std::string const &Filename) {
+    std::ifstream fp(Filename, std::ios::binary);
+    if (!fp.is_open()) {
+      LogMan::Msg::EFmt("Couldn't open hot trace '{}'", Filename);
+      return;
+    }
+
+    Data.assign(std::istreambuf_iterator<char>(fp), std::istreambuf_iterator<char>());
+
+    if (Data.size() < sizeof(Header)) {
+      LogMan::Msg::EFmt("Hot trace '{}' is truncated", Filename);
+      return;
+    }
+
+    memcpy(&Header, Data.data(), sizeof(Header));
+    if (Header.Cookie != FEXCore::HotTrace::COOKIE || Header.Version != FEXCore::HotTrace::VERSION) {
+      LogMan::Msg::EFmt("'{}' isn't a version {} hot trace", Filename, FEXCore::HotTrace::VERSION);
+      return;
+    }
+
+    size_t Offset = sizeof(Header);
+    for (uint32_t i = 0; i < Header.NumBlocks; ++i) {
+      Block NewBlock{};
+      if (Data.size() - Offset < sizeof(NewBlock.Header)) {
+        LogMan::Msg::EFmt("Hot trace '{}' is truncated", Filename);
+        return;
+      }
+      memcpy(&NewBlock.Header, &Data[Offset], sizeof(NewBlock.Header));
+      Offset += sizeof(NewBlock.Header);
+
+      if (Data.size() - Offset < uint64_t(NewBlock.Header.FilenameLength) + NewBlock.Header.CodeSize) {
+        LogMan::Msg::EFmt("Hot trace '{}' is truncated", Filename);
+        return;
+      }
+      NewBlock.Filename.assign(reinterpret_cast<char const*>(&Data[Offset]), NewBlock.Header.FilenameLength);
+      Offset += NewBlock.Header.FilenameLength;
+      NewBlock.Code = &Data[Offset];
+      Offset += NewBlock.Header.CodeSize;
+
+      Blocks.emplace_back(std::move(NewBlock));
+    }
+
+    Valid = true;
+  }
+
+  bool IsValid() const { return Valid; }
+
+  FEXCore::HotTrace::FileHeader const &GetHeader() const { return Header; }
+  std::vector<Block> &GetBlocks() { return Blocks; }
+
+  /**
+   * @brief Configures FEXCore the way the captured process was
+   *
+   * Caches are disabled so every compile goes through the whole pipeline.
+   */
+  void ApplyCompileState() const {
+    auto const &State = Header.State;
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_IS64BIT_MODE, State.Is64BitMode ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_MULTIBLOCK, State.Multiblock ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_TSOENABLED, State.TSOEnabled ? "1" : "0");
+    // The captured state is already the effective one
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_TSOAUTOMIGRATION, "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_PARANOIDTSO, State.ParanoidTSO ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_STACKTSOELISION, State.StackTSOElision ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_FRAMEPOINTERTSOELISION, State.FramePointerTSOElision ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_ABILOCALFLAGS, State.ABILocalFlags ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_ABINOPF, State.ABINoPF ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_X87REDUCEDPRECISION, State.x87ReducedPrecision ? "1" : "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_SMCCHECKS, std::to_string(State.SMCChecks));
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_MAXINST, std::to_string(State.MaxInstPerBlock));
+
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_AOTIRLOAD, "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_AOTIRCAPTURE, "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_AOTIRGENERATE, "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_CACHEOBJECTCODECOMPILATION, "0");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_GUESTPROFILE, "");
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_HOTTRACECAPTURE, "");
+  }
+
+  /**
+   * @brief Puts the captured guest code back at the addresses it was captured from
+   *
+   * Blocks overlapping with something this process already has mapped are marked as unmappable.
+   */
+  void MapCode() {
+    const uint64_t PageSize = sysconf(_SC_PAGESIZE);
+
+    for (auto &Block : Blocks) {
+      const uint64_t Begin = Block.Header.CodeStart & ~(PageSize - 1);
+      const uint64_t End = (Block.Header.CodeStart + Block.Header.CodeSize + PageSize - 1) & ~(PageSize - 1);
+
+      for (uint64_t Page = Begin; Page < End; Page += PageSize) {
+        if (MappedPages.contains(Page)) {
+          continue;
+        }
+
+        void *Ptr = FEXCore::Allocator::mmap(reinterpret_cast<void*>(Page), PageSize, PROT_READ | PROT_WRITE, MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (Ptr == MAP_FAILED || reinterpret_cast<uint64_t>(Ptr) != Page) {
+          if (Ptr != MAP_FAILED) {
+            // Kernel too old for MAP_FIXED_NOREPLACE and treated it as a hint
+            FEXCore::Allocator::munmap(Ptr, PageSize);
+          }
+          Block.Unmappable = true;
+          break;
+        }
+        MappedPages.emplace(Page);
+      }
+
+      if (!Block.Unmappable) {
+        memcpy(reinterpret_cast<void*>(Block.Header.CodeStart), Block.Code, Block.Header.CodeSize);
+      }
+    }
+  }
+
+private:
+  bool Valid{};
+  std::vector<uint8_t> Data;
+  FEXCore::HotTrace::FileHeader Header{};
+  std::vector<Block> Blocks;
+  std::set<uint64_t> MappedPages;
+};
+
+class DummySyscallHandler: public FEXCore::HLE::SyscallHandler {
+  public:
+
+  uint64_t HandleSyscall(FEXCore::Core::CpuStateFrame *Frame, FEXCore::HLE::SyscallArguments *Args) override {
+    LOGMAN_MSG_A_FMT("Syscalls not implemented");
+    return 0;
+  }
+
+  FEXCore::HLE::SyscallABI GetSyscallABI(uint64_t Syscall) override {
+    LOGMAN_MSG_A_FMT("Syscalls not implemented");
+    return {0, false, 0 };
+  }
+
+  // These are no-ops implementations of the SyscallHandler API
+  std::shared_mutex StubMutex;
+  FEXCore::HLE::AOTIRCacheEntryLookupResult LookupAOTIRCacheEntry(uint64_t GuestAddr) override {
+    return {0, 0, FHU::ScopedSignalMaskWithSharedLock {StubMutex}};
+  }
+};
+
+namespace {
+  struct ReplayResult {
+    FEXCore::Core::CompileStageStats Total{};
+    uint64_t Iterations{};
+  };
+
+  double ToMicroseconds(uint64_t NS, uint64_t Iterations) {
+    return Iterations ? double(NS) / double(Iterations) / 1000.0 : 0.0;
+  }
+}
+
+int main(int argc, char **argv, char **const envp)
+{
+  LogMan::Throw::InstallHandler(AssertHandler);
+  LogMan::Msg::InstallHandler(MsgHandler);
+
+  FEXCore::Config::Initialize();
+  FEXCore::Config::AddLayer(std::make_unique<FEX::ArgLoader::ArgLoader>(argc, argv));
+  FEXCore::Config::AddLayer(FEXCore::Config::CreateEnvironmentLayer(envp));
+  FEXCore::Config::Load();
+
+  auto Args = FEX::ArgLoader::Get();
+
+  if (Args.empty()) {
+    fmt::print("usage: HotTraceReplay <hot trace> [iterations]\n");
+    return -1;
+  }
+
+  const uint64_t Iterations = Args.size() > 1 ? std::max(std::stoull(Args[1]), 1ULL) : 10;
+
+  HotTraceLoader Loader(Args[0]);
+  if (!Loader.IsValid()) {
+    return -1;
+  }
+
+  auto &Header = Loader.GetHeader();
+  auto &Blocks = Loader.GetBlocks();
+  if (Blocks.empty()) {
+    LogMan::Msg::EFmt("Hot trace has no blocks");
+    return -1;
+  }
+
+  Loader.ApplyCompileState();
+  Loader.MapCode();
+
+  FEXCore::Context::InitializeStaticTables(Header.State.Is64BitMode ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
+  auto CTX = FEXCore::Context::CreateNewContext();
+  FEXCore::Context::InitializeContext(CTX);
+
+  std::unique_ptr<FEX::HLE::SignalDelegator> SignalDelegation = std::make_unique<FEX::HLE::SignalDelegator>();
+  std::unique_ptr<DummySyscallHandler> SyscallHandler = std::make_unique<DummySyscallHandler>();
+
+  FEXCore::Context::SetSignalDelegator(CTX, SignalDelegation.get());
+  FEXCore::Context::SetSyscallHandler(CTX, SyscallHandler.get());
+
+  // Nothing is executed, the thread only provides the compiler
+  FEXCore::Context::InitCore(CTX, Blocks.front().Header.GuestRIP, 0);
+
+  fmt::print("{:>18} {:>8} {:>6} {:>6} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}  {}\n",
+    "RIP", "Samples", "Insts", "Nodes", "Code", "Decode us", "Dispatch", "Passes", "Backend", "Total", "Location");
+
+  ReplayResult Overall{};
+  uint64_t Failed{};
+
+  for (auto &Block : Blocks) {
+    const auto RIP = Block.Header.GuestRIP;
+    if (Block.Unmappable) {
+      LogMan::Msg::EFmt("Couldn't map the guest code of 0x{:x}, skipping", RIP);
+      ++Failed;
+      continue;
+    }
+
+    // Warm up, so the first block doesn't pay for every cold cache in the compiler
+    FEXCore::Core::CompileStageStats Stats{};
+    if (!FEXCore::Context::Debug::CompileRIPWithStats(CTX, RIP, &Stats)) {
+      LogMan::Msg::EFmt("Couldn't compile 0x{:x}, skipping", RIP);
+      ++Failed;
+      continue;
+    }
+
+    ReplayResult Result{};
+    for (uint64_t i = 0; i < Iterations; ++i) {
+      FEXCore::Context::Debug::CompileRIPWithStats(CTX, RIP, &Stats);
+      Result.Total.DecodeNS += Stats.DecodeNS;
+      Result.Total.DispatchNS += Stats.DispatchNS;
+      Result.Total.PassesNS += Stats.PassesNS;
+      Result.Total.BackendNS += Stats.BackendNS;
+      ++Result.Iterations;
+    }
+
+    // Sizes are the same every iteration
+    Result.Total.GuestInstructions = Stats.GuestInstructions;
+    Result.Total.IRNodes = Stats.IRNodes;
+    Result.Total.HostCodeSize = Stats.HostCodeSize;
+
+    const auto Location = Block.Filename.empty() ? std::string("[unknown]") :
+      fmt::format("{}+0x{:x}", std::filesystem::path(Block.Filename).filename().string(), Block.Header.FileOffset);
+    const auto &T = Result.Total;
+    fmt::print("{:>#18x} {:>8} {:>6} {:>6} {:>8} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}  {}\n",
+      RIP, Block.Header.Samples, T.GuestInstructions, T.IRNodes, T.HostCodeSize,
+      ToMicroseconds(T.DecodeNS, Result.Iterations),
+      ToMicroseconds(T.DispatchNS, Result.Iterations),
+      ToMicroseconds(T.PassesNS, Result.Iterations),
+      ToMicroseconds(T.BackendNS, Result.Iterations),
+      ToMicroseconds(T.DecodeNS + T.DispatchNS + T.PassesNS + T.BackendNS, Result.Iterations),
+      Location);
+
+    Overall.Total.DecodeNS += T.DecodeNS;
+    Overall.Total.DispatchNS += T.DispatchNS;
+    Overall.Total.PassesNS += T.PassesNS;
+    Overall.Total.BackendNS += T.BackendNS;
+    Overall.Total.GuestInstructions += T.GuestInstructions;
+    Overall.Total.IRNodes += T.IRNodes;
+    Overall.Total.HostCodeSize += T.HostCodeSize;
+    ++Overall.Iterations;
+  }
+
+  // Totals are the sum of the per block means
+  const auto &T = Overall.Total;
+  const auto PerBlock = [&](uint64_t NS) { return ToMicroseconds(NS, Iterations); };
+  fmt::print("{:>18} {:>8} {:>6} {:>6} {:>8} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}  {} blocks, {} failed, {} iterations\n",
+    "total", Header.TotalSamples, T.GuestInstructions, T.IRNodes, T.HostCodeSize,
+    PerBlock(T.DecodeNS), PerBlock(T.DispatchNS), PerBlock(T.PassesNS), PerBlock(T.BackendNS),
+    PerBlock(T.DecodeNS + T.DispatchNS + T.PassesNS + T.BackendNS),
+    Overall.Iterations, Failed, Iterations);
+
+  FEXCore::Context::DestroyContext(CTX);
+
+  return Failed ? -1 : 0;
+}
@@ -23,6 +23,8 @@ $end_info$
 #include <ostream>
 #include <sstream>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <system_error>
 #include <unistd.h>
 #include <utility>
@@ -621,20 +623,20 @@ namespace FEX::EmulatedFile {
 
   EmulatedFDManager::EmulatedFDManager(FEXCore::Context::Context *ctx)
     : CTX {ctx} {
-    FDReadCreators["/proc/cpuinfo"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      // Only allow a single thread to initialize the cpu_info.
-      // Jit in-case multiple threads try to initialize at once.
-      // Check if deferred cpuinfo initialization has occured.
-      std::call_once(cpu_info_initialized, [&]() { cpu_info = GenerateCPUInfo(ctx, ThreadsConfig()); });
-
-      int FD = GenTmpFD();
-      write(FD, (void*)&cpu_info.at(0), cpu_info.size());
-      lseek(FD, 0, SEEK_SET);
-      return FD;
-    };
+    struct stat Stat{};
+    if (stat("/proc", &Stat) == 0) {
+      ProcFSDevice = Stat.st_dev;
+    }
+
+    if (stat("/sys", &Stat) == 0) {
+      SysFSDevice = Stat.st_dev;
+    }
 
-    FDReadCreators["/proc/sys/kernel/osrelease"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    AddStaticFile({"/proc/cpuinfo"}, [this]() {
+      return GenerateCPUInfo(CTX, ThreadsConfig());
+    });
+
+    AddStaticFile({"/proc/sys/kernel/osrelease"}, []() {
       uint32_t GuestVersion = FEX::HLE::_SyscallHandler->GetGuestKernelVersion();
       char Tmp[64]{};
       snprintf(Tmp, sizeof(Tmp), "%d.%d.%d\n",
@@ -642,13 +644,10 @@ namespace FEX::EmulatedFile {
         FEX::HLE::SyscallHandler::KernelMinor(GuestVersion),
         FEX::HLE::SyscallHandler::KernelPatch(GuestVersion));
       // + 1 to ensure null at the end
-      write(FD, Tmp, strlen(Tmp) + 1);
-      lseek(FD, 0, SEEK_SET);
-      return FD;
-    };
+      return std::string(Tmp, strlen(Tmp) + 1);
+    });
 
-    FDReadCreators["/proc/version"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    AddStaticFile({"/proc/version"}, []() {
       // UTS version NEEDS to be in a format that can pass to `date -d`
       // Format of this is Linux version <Release> (<Compile By>@<Compile Host>) (<Linux Compiler>) #<version> {SMP, PREEMPT, PREEMPT_RT} <UTS version>\n"
       const char kernel_version[] = "Linux version %d.%d.%d (FEX@FEX) (clang) #" GIT_DESCRIBE_STRING " SMP " __DATE__ " " __TIME__ "\n";
@@ -659,46 +658,31 @@ namespace FEX::EmulatedFile {
         FEX::HLE::SyscallHandler::KernelMinor(GuestVersion),
         FEX::HLE::SyscallHandler::KernelPatch(GuestVersion));
       // + 1 to ensure null at the end
-      write(FD, Tmp, strlen(Tmp) + 1);
-      lseek(FD, 0, SEEK_SET);
-      return FD;
-    };
-
-    auto NumCPUCores = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
-      write(FD, (void*)&cpus_online.at(0), cpus_online.size());
-      lseek(FD, 0, SEEK_SET);
-      return FD;
-    };
-
-    FDReadCreators["/sys/devices/system/cpu/online"] = NumCPUCores;
-    FDReadCreators["/sys/devices/system/cpu/present"] = NumCPUCores;
+      return std::string(Tmp, strlen(Tmp) + 1);
+    });
 
-    string procAuxv = string("/proc/") + std::to_string(getpid()) + string("/auxv");
+    AddStaticFile({"/sys/devices/system/cpu/online", "/sys/devices/system/cpu/present"}, [this]() {
+      return cpus_online;
+    });
 
-    FDReadCreators[procAuxv] = &EmulatedFDManager::ProcAuxv;
-    FDReadCreators["/proc/self/auxv"] = &EmulatedFDManager::ProcAuxv;
+    // auxv lives in guest memory, always read it fresh.
+    AddDynamicFile("/proc/" + std::to_string(::getpid()) + "/auxv", &EmulatedFDManager::ProcAuxv);
+    AddDynamicFile("/proc/self/auxv", &EmulatedFDManager::ProcAuxv);
 
-    auto cmdline_handler = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    AddStaticFile({"/proc/self/cmdline", "/proc/" + std::to_string(::getpid()) + "/cmdline"}, []() {
       auto CodeLoader = FEX::HLE::_SyscallHandler->GetCodeLoader();
       auto Args = CodeLoader->GetApplicationArguments();
-      char NullChar{};
+      std::string cmdline{};
       // cmdline is an array of null terminated arguments
       for (size_t i = 0; i < Args->size(); ++i) {
         auto &Arg = Args->at(i);
-        write(FD, Arg.c_str(), Arg.size());
+        cmdline += Arg;
         // Finish off with a null terminator
-        write(FD, &NullChar, sizeof(uint8_t));
+        cmdline += '\0';
       }
 
-      // One additional null terminator to finish the list
-      lseek(FD, 0, SEEK_SET);
-      return FD;
-    };
-
-    FDReadCreators["/proc/self/cmdline"] = cmdline_handler;
-    FDReadCreators["/proc/" + std::to_string(::getpid()) + "/cmdline"] = cmdline_handler;
+      return cmdline;
+    });
 
     cpus_online = "0";
     uint64_t CPUCores = ThreadsConfig();
@@ -708,17 +692,110 @@ namespace FEX::EmulatedFile {
   }
 
   EmulatedFDManager::~EmulatedFDManager() {
+    for (auto &File : StaticFiles) {
+      if (File->FD != -1) {
+        close(File->FD);
+      }
+    }
+  }
+
+  void EmulatedFDManager::AddStaticFile(std::vector<std::string> Paths, std::function<std::string()> Generate) {
+    auto &File = StaticFiles.emplace_back(std::make_unique<StaticFile>());
+    File->Generate = std::move(Generate);
+
+    for (auto &Path : Paths) {
+      FDReadCreators.emplace_back(FDReadCreator {
+        .Path = std::move(Path),
+        .Static = File.get(),
+      });
+    }
+  }
+
+  void EmulatedFDManager::AddDynamicFile(std::string Path, FDReadStringFunc Func) {
+    FDReadCreators.emplace_back(FDReadCreator {
+      .Path = std::move(Path),
+      .Dynamic = std::move(Func),
+    });
+  }
+
+  const EmulatedFDManager::FDReadCreator *EmulatedFDManager::FindCreator(std::string_view Path) const {
+    for (auto &Creator : FDReadCreators) {
+      if (Creator.Path == Path) {
+        return &Creator;
+      }
+    }
+
+    return nullptr;
+  }
+
+  int32_t EmulatedFDManager::OpenStaticFile(StaticFile *File, int32_t flags) {
+    std::call_once(File->Initialized, [File]() {
+      auto Data = File->Generate();
+
+      int FD = memfd_create("FEXEmulatedFile", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+      if (FD == -1) {
+        return;
+      }
+
+      struct stat Buffer{};
+      if (write(FD, Data.data(), Data.size()) != static_cast<ssize_t>(Data.size()) ||
+          fcntl(FD, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == -1 ||
+          fstat(FD, &Buffer) == -1) {
+        close(FD);
+        return;
+      }
+
+      File->Device = Buffer.st_dev;
+      File->Inode = Buffer.st_ino;
+      File->FD = FD;
+    });
+
+    if (File->FD != -1) {
+      // Reopening through procfs instead of dup gives the guest its own file offset.
+      char FDPath[32];
+      snprintf(FDPath, sizeof(FDPath), "/proc/self/fd/%d", File->FD);
+      int FD = open(FDPath, O_RDONLY | (flags & O_CLOEXEC));
+      if (FD != -1) {
+        // The guest is free to close FDs it doesn't own, make sure the number wasn't reused for something else.
+        struct stat Buffer{};
+        if (fstat(FD, &Buffer) == 0 &&
+            Buffer.st_dev == File->Device &&
+            Buffer.st_ino == File->Inode) {
+          return FD;
+        }
+        close(FD);
+      }
+    }
+
+    // Fall back to rendering in to a temporary file
+    auto Data = File->Generate();
+    int FD = GenTmpFD();
+    write(FD, Data.data(), Data.size());
+    lseek(FD, 0, SEEK_SET);
+    return FD;
   }
 
   int32_t EmulatedFDManager::OpenAt(int dirfs, const char *pathname, int flags, uint32_t mode) {
     std::string Path{};
-    if (((pathname && pathname[0] != '/') || // If pathname exists then it must not be absolute
-        !pathname) &&
-        dirfs != AT_FDCWD) {
-      // Passed in a dirfd that isn't magic FDCWD
-      // We need to get the path from the fd now
-      Path = FEX::get_fdpath(dirfs).value_or("");
+    if (!pathname || pathname[0] != '/') {
+      // Relative paths need the directory they are relative to, so we know if they could end up in procfs or sysfs
+      std::optional<std::string> Directory{};
+      if (dirfs != AT_FDCWD) {
+        // Passed in a dirfd that isn't magic FDCWD
+        // We need to get the path from the fd now
+        Directory = FEX::get_fdpath(dirfs);
+      }
+      else if (pathname && pathname[0] != '\0') {
+        char CWD[PATH_MAX];
+        if (getcwd(CWD, sizeof(CWD))) {
+          Directory = CWD;
+        }
+      }
+      else {
+        return -1;
+      }
 
+      Path = Directory.value_or("");
       if (pathname) {
         if (!Path.empty()) {
           // If the path returned empty then we don't need a separator
@@ -726,33 +803,50 @@ namespace FEX::EmulatedFile {
         }
         Path += pathname;
       }
-    }
-    else {
-      if (!pathname || strlen(pathname) == 0) {
+
+      if (Path.empty()) {
         return -1;
       }
-      else if (pathname) {
+    }
+
+    std::string_view PathView = Path.empty() ? std::string_view(pathname) : std::string_view(Path);
+
+    // Fast path for exact matches
+    const FDReadCreator *Creator = FindCreator(PathView);
+
+    if (!Creator) {
+      // Slow path to resolve symlinks like /proc/self and redundant path components
+      if (Path.empty()) {
         Path = pathname;
       }
-    }
 
-    std::error_code ec;
-    bool exists = access(Path.c_str(), F_OK) == 0;
-    if (ec) {
-      return -1;
-    }
-    string cpath = exists ? std::filesystem::canonical(Path, ec)
-      : std::filesystem::path(Path).lexically_normal(); // *Note: this doesn't transform to absolute
+      // Every emulated file lives in procfs or sysfs. The string can't tell, `//proc`, `/./proc` and symlinks all end up there,
+      // so check where the host resolves it to before paying for canonicalizing it.
+      struct stat Stat{};
+      bool exists = stat(Path.c_str(), &Stat) == 0;
+      if (exists && Stat.st_dev != ProcFSDevice && Stat.st_dev != SysFSDevice) {
+        return -1;
+      }
 
-    if (ec) {
-      return -1;
+      std::error_code ec;
+      string cpath = exists ? std::filesystem::canonical(Path, ec)
+        : std::filesystem::path(Path).lexically_normal(); // *Note: this doesn't transform to absolute
+
+      if (ec) {
+        return -1;
+      }
+
+      Creator = FindCreator(cpath);
+      if (!Creator) {
+        return -1;
+      }
     }
-    auto Creator = FDReadCreators.find(cpath);
-    if (Creator == FDReadCreators.end()) {
-      return -1;
+
+    if (Creator->Static) {
+      return OpenStaticFile(Creator->Static, flags);
     }
 
-    return Creator->second(CTX, dirfs, Path.c_str(), flags, mode);
+    return Creator->Dynamic(CTX, dirfs, Path.empty() ? pathname : Path.c_str(), flags, mode);
   }
 
   int32_t EmulatedFDManager::ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode)
@@ -9,9 +9,12 @@ $end_info$
 
 #include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <sys/types.h>
+#include <vector>
 
 namespace FEXCore::Context {
   struct Context;
@@ -27,10 +30,35 @@ namespace FEX::EmulatedFile {
     private:
       FEXCore::Context::Context *CTX;
       std::string cpus_online{};
-      std::once_flag cpu_info_initialized{};
-      std::string cpu_info{};
+      // Host devices of procfs and sysfs, a path resolving anywhere else can't be an emulated file
+      dev_t ProcFSDevice{};
+      dev_t SysFSDevice{};
       using FDReadStringFunc = std::function<int32_t(FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode)>;
-      std::unordered_map<std::string, FDReadStringFunc> FDReadCreators;
+
+      // Files whose contents never change over the lifetime of the process.
+      // Rendered once on first open in to a sealed memfd, every open gets a fresh read-only description of it.
+      struct StaticFile {
+        std::function<std::string()> Generate;
+        std::once_flag Initialized{};
+        int FD {-1};
+        dev_t Device{};
+        ino_t Inode{};
+      };
+
+      struct FDReadCreator {
+        std::string Path;
+        FDReadStringFunc Dynamic;
+        StaticFile *Static{};
+      };
+
+      // Small enough that a linear search of string_views beats hashing a freshly allocated std::string.
+      std::vector<FDReadCreator> FDReadCreators;
+      std::vector<std::unique_ptr<StaticFile>> StaticFiles;
+
+      void AddStaticFile(std::vector<std::string> Paths, std::function<std::string()> Generate);
+      void AddDynamicFile(std::string Path, FDReadStringFunc Func);
+      const FDReadCreator *FindCreator(std::string_view Path) const;
+      static int32_t OpenStaticFile(StaticFile *File, int32_t flags);
 
       static int32_t ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode);
       FEX_CONFIG_OPT(ThreadsConfig, THREADS);
@@ -6,6 +6,8 @@ $end_info$
 */
 
 #include "Common/FDUtils.h"
+#include "Common/StartupSnapshot.h"
+#include "Common/StartupTrace.h"
 
 #include "FEXCore/Config/Config.h"
 #include "Tests/LinuxSyscalls/FileManagement.h"
@@ -24,8 +26,10 @@ $end_info$
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <stdio.h>
 #include <string.h>
+#include <sys/inotify.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
 #include <syscall.h>
@@ -62,6 +66,17 @@ namespace FEXCore::Context {
 namespace FEX::HLE {
   struct open_how;
 
+#ifndef RESOLVE_IN_ROOT
+#define RESOLVE_IN_ROOT 0x10
+#endif
+
+// Maximum number of entries in each of the path resolution caches before they get flushed.
+constexpr size_t MAX_PATH_CACHE_ENTRIES = 4096;
+
+// Any of these events in a watched directory can change the result of a path resolution.
+constexpr uint32_t PATH_CACHE_WATCH_MASK =
+  IN_ATTRIB | IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF;
+
 static bool LoadFile(std::vector<char> &Data, const std::string &Filename) {
   std::fstream File(Filename, std::ios::in);
 
@@ -215,48 +230,12 @@ static void LoadThunkDatabase(std::unordered_map<std::string, ThunkDBObject>& Th
   }
 }
 
-FileManager::FileManager(FEXCore::Context::Context *ctx)
-  : EmuFD {ctx} {
-
-  auto ThunkConfigFile = ThunkConfig();
-
-  // We try to load ThunksDB from:
-  // - FEX global config
-  // - FEX user config
-  // - Defined ThunksConfig option
-  // - Steam AppConfig Global
-  // - AppConfig Global
-  // - Steam AppConfig Local
-  // - AppConfig Local
-  // This doesn't support the classic thunks interface.
-
-  auto AppName = AppConfigName();
-  std::vector<std::string> ConfigPaths {
-    FEXCore::Config::GetConfigFileLocation(true),
-    FEXCore::Config::GetConfigFileLocation(false),
-    ThunkConfigFile,
-  };
-
-  auto SteamID = getenv("SteamAppId");
-  if (SteamID) {
-    // If a SteamID exists then let's search for Steam application configs as well.
-    // We want to key off both the SteamAppId number /and/ the executable since we may not want to thunk all binaries.
-    auto SteamAppName = fmt::format("Steam_{}_{}", SteamID, AppName);
-
-    // Steam application configs interleaved with non-steam for priority sorting.
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(SteamAppName, true));
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, true));
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(SteamAppName, false));
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, false));
-  }
-  else {
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, true));
-    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, false));
-  }
+using ThunkOverlayMap = std::map<std::string, std::string, std::less<>>;
 
+static void LoadThunkOverlays(ThunkOverlayMap& ThunkOverlays, std::vector<std::string> const &ConfigPaths, std::filesystem::path const &ThunkGuestPath, bool Is64BitMode) {
   std::unordered_map<std::string, ThunkDBObject> ThunkDB;
-  LoadThunkDatabase(ThunkDB, Is64BitMode(), true);
-  LoadThunkDatabase(ThunkDB, Is64BitMode(), false);
+  LoadThunkDatabase(ThunkDB, Is64BitMode, true);
+  LoadThunkDatabase(ThunkDB, Is64BitMode, false);
 
   for (const auto &Path : ConfigPaths) {
     std::vector<char> FileData;
@@ -288,7 +267,6 @@ FileManager::FileManager(FEXCore::Context::Context *ctx)
   }
 
   // Now that we loaded the thunks object, walk through and ensure dependencies are enabled as well
-  auto ThunkGuestPath = std::filesystem::path { Is64BitMode() ? ThunkGuestLibs() : ThunkGuestLibs32() };
   for (auto const &DBObject : ThunkDB) {
     if (!DBObject.second.Enabled) {
       continue;
@@ -297,7 +275,7 @@ FileManager::FileManager(FEXCore::Context::Context *ctx)
     // Recursively add paths for this thunk library and its dependencies to ThunkOverlays.
     // Using a local struct for this is slightly less ugly than using self-capturing lambdas
     struct {
-      decltype(FileManager::ThunkOverlays)& ThunkOverlays;
+      ThunkOverlayMap& ThunkOverlays;
       decltype(ThunkDB)& ThunkDB;
       const std::filesystem::path& ThunkGuestPath;
       bool Is64BitMode;
@@ -332,11 +310,85 @@ FileManager::FileManager(FEXCore::Context::Context *ctx)
           InsertDependencies(DBDepend.Depends);
         }
       };
-    } DBObjectHandler { ThunkOverlays, ThunkDB, ThunkGuestPath, Is64BitMode() };
+    } DBObjectHandler { ThunkOverlays, ThunkDB, ThunkGuestPath, Is64BitMode };
 
     DBObjectHandler.SetupOverlay(DBObject.second);
     DBObjectHandler.InsertDependencies(DBObject.second.Depends);
   }
+}
+
+FileManager::FileManager(FEXCore::Context::Context *ctx)
+  : EmuFD {ctx} {
+
+  auto ThunkConfigFile = ThunkConfig();
+
+  // We try to load ThunksDB from:
+  // - FEX global config
+  // - FEX user config
+  // - Defined ThunksConfig option
+  // - Steam AppConfig Global
+  // - AppConfig Global
+  // - Steam AppConfig Local
+  // - AppConfig Local
+  // This doesn't support the classic thunks interface.
+
+  auto AppName = AppConfigName();
+  std::vector<std::string> ConfigPaths {
+    FEXCore::Config::GetConfigFileLocation(true),
+    FEXCore::Config::GetConfigFileLocation(false),
+    ThunkConfigFile,
+  };
+
+  auto SteamID = getenv("SteamAppId");
+  if (SteamID) {
+    // If a SteamID exists then let's search for Steam application configs as well.
+    // We want to key off both the SteamAppId number /and/ the executable since we may not want to thunk all binaries.
+    auto SteamAppName = fmt::format("Steam_{}_{}", SteamID, AppName);
+
+    // Steam application configs interleaved with non-steam for priority sorting.
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(SteamAppName, true));
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, true));
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(SteamAppName, false));
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, false));
+  }
+  else {
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, true));
+    ConfigPaths.emplace_back(FEXCore::Config::GetApplicationConfig(AppName, false));
+  }
+
+  auto ThunkGuestPath = std::filesystem::path { Is64BitMode() ? ThunkGuestLibs() : ThunkGuestLibs32() };
+
+  // Everything the overlays are built from besides the home directory
+  std::vector<std::string> ThunkInputs {
+    FEXCore::Config::GetConfigDirectory(true) + "ThunksDB.json",
+    FEXCore::Config::GetConfigDirectory(false) + "ThunksDB.json",
+    ThunkGuestPath.string(),
+  };
+  ThunkInputs.insert(ThunkInputs.end(), ConfigPaths.begin(), ConfigPaths.end());
+  const auto SnapshotKey = fmt::format("ThunkOverlays:{}:{}", Is64BitMode() ? 64 : 32, FEXCore::Paths::GetHomeDirectory());
+
+  if (auto Cached = FEX::StartupSnapshot::Get(SnapshotKey, ThunkInputs); Cached && Cached->size() % 2 == 0) {
+    for (size_t i = 0; i < Cached->size(); i += 2) {
+      ThunkOverlays.emplace(std::move(Cached->at(i)), std::move(Cached->at(i + 1)));
+    }
+  }
+  else {
+    FEX::StartupTrace::ScopedPhase Phase{"LoadThunkDatabase"};
+
+    std::vector<FEX::StartupSnapshot::FileStamp> ThunkStamps;
+    for (auto const &Input : ThunkInputs) {
+      ThunkStamps.emplace_back(FEX::StartupSnapshot::Stamp(Input));
+    }
+
+    LoadThunkOverlays(ThunkOverlays, ConfigPaths, ThunkGuestPath, Is64BitMode());
+
+    std::vector<std::string> Values;
+    for (const auto& [Overlay, ThunkPath] : ThunkOverlays) {
+      Values.emplace_back(Overlay);
+      Values.emplace_back(ThunkPath);
+    }
+    FEX::StartupSnapshot::Put(SnapshotKey, std::move(ThunkStamps), std::move(Values));
+  }
 
   if (false) {
     // Useful for debugging
@@ -349,29 +401,268 @@ FileManager::FileManager(FEXCore::Context::Context *ctx)
   }
 
   UpdatePID(::getpid());
+
+  SetupPathCache();
 }
 
 FileManager::~FileManager() {
+  ClosePathCache();
 }
 
-std::string FileManager::GetEmulatedPath(const char *pathname, bool FollowSymlink) {
-  if (!pathname || // If no pathname
-      pathname[0] != '/' || // If relative
-      strcmp(pathname, "/") == 0) { // If we are getting root
-    return {};
+void FileManager::SetupPathCache() {
+  auto RootFSPath = LDPath();
+  if (RootFSPath.empty()) {
+    return;
   }
 
-  auto thunkOverlay = ThunkOverlays.find(pathname);
-  if (thunkOverlay != ThunkOverlays.end()) {
-    return thunkOverlay->second;
+  RootFSFD = ::open(RootFSPath.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+  if (RootFSFD == -1) {
+    return;
   }
 
-  auto RootFSPath = LDPath();
-  if (RootFSPath.empty()) { // If RootFS doesn't exist
-    return {};
+  // openat2 only exists on kernel 5.6+
+  FEX::HLE::open_how how {
+    .flags = O_PATH | O_DIRECTORY | O_CLOEXEC,
+    .resolve = RESOLVE_IN_ROOT,
+  };
+  int TestFD = ::syscall(SYSCALL_DEF(openat2), RootFSFD, ".", &how, sizeof(how));
+  if (TestFD == -1) {
+    // Without openat2 the host kernel resolves intermediate symlinks, possibly outside of the rootfs.
+    // The watches can't follow that, so the cache stays disabled.
+    return;
+  }
+  SupportsOpenat2 = true;
+  close(TestFD);
+
+  PathCacheINotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+}
+
+void FileManager::ClosePathCache(bool CloseFDs) {
+  if (CloseFDs) {
+    if (PathCacheINotifyFD != -1) {
+      close(PathCacheINotifyFD);
+    }
+
+    if (RootFSFD != -1) {
+      close(RootFSFD);
+    }
+  }
+
+  PathCacheINotifyFD = -1;
+  RootFSFD = -1;
+  SupportsOpenat2 = false;
+  PathCache.clear();
+  PathCacheNoFollow.clear();
+  PathCacheWatches.clear();
+  ++PathCacheMapGeneration;
+}
+
+void FileManager::ResetPathCacheAfterFork(bool SharedFDTable) {
+  // Only one thread exists in the child, no need to lock.
+  // With a shared FD table the parent keeps using its FDs, the child leaves them alone and opens its own.
+  ClosePathCache(!SharedFDTable);
+  SetupPathCache();
+}
+
+void FileManager::CheckInternalFDClosed(int first, int last) {
+  auto InRange = [first, last](int FD) {
+    return FD != -1 && FD >= first && FD <= last;
+  };
+
+  FHU::ScopedSignalMaskWithMutex lk(PathCacheLock);
+  if (!InRange(RootFSFD) && !InRange(PathCacheINotifyFD)) {
+    return;
+  }
+
+  // The guest is closing FDs it doesn't know about, stop using them before the numbers get reused.
+  if (InRange(RootFSFD)) {
+    RootFSFD = -1;
+    SupportsOpenat2 = false;
+  }
+
+  if (InRange(PathCacheINotifyFD)) {
+    // The watches went away with the FD
+    PathCacheINotifyFD = -1;
+    PathCacheWatches.clear();
+  }
+
+  FlushPathCache();
+}
+
+void FileManager::FlushPathCache() {
+  PathCache.clear();
+  PathCacheNoFollow.clear();
+
+  // Nothing depends on the watched directories anymore
+  if (PathCacheINotifyFD != -1) {
+    for (auto &[Dir, Watch] : PathCacheWatches) {
+      inotify_rm_watch(PathCacheINotifyFD, Watch);
+    }
+  }
+  PathCacheWatches.clear();
+
+  ++PathCacheMapGeneration;
+}
+
+bool FileManager::PathCacheValid() {
+  if (PathCacheINotifyFD == -1) {
+    return false;
+  }
+
+  // Drain all pending events, any change at all flushes the cache.
+  alignas(struct inotify_event) char Events[4096];
+  bool Changed = false;
+  ssize_t Result{};
+  while ((Result = ::read(PathCacheINotifyFD, Events, sizeof(Events))) > 0) {
+    for (ssize_t Offset = 0; Offset < Result;) {
+      auto Event = reinterpret_cast<const struct inotify_event*>(&Events[Offset]);
+      // Removing a watch queues IN_IGNORED for it, that on its own doesn't change any resolution
+      if (!(Event->mask & IN_IGNORED)) {
+        Changed = true;
+      }
+      Offset += sizeof(struct inotify_event) + Event->len;
+    }
+  }
+
+  if (Result == -1 && errno != EAGAIN) {
+    return false;
+  }
+
+  if (Changed) {
+    FlushPathCache();
+  }
+
+  return true;
+}
+
+bool FileManager::WatchRootFSDirectory(const std::string &Dir) {
+  if (PathCacheWatches.contains(Dir)) {
+    return true;
+  }
+
+  // Dir was walked by us and doesn't contain any symlinks
+  auto Path = LDPath() + "/" + Dir;
+  int Watch = inotify_add_watch(PathCacheINotifyFD, Path.c_str(), PATH_CACHE_WATCH_MASK | IN_ONLYDIR | IN_DONT_FOLLOW);
+  if (Watch == -1) {
+    // Can fail if we run out of inotify watches, then the entry just doesn't get cached.
+    return false;
+  }
+
+  PathCacheWatches.emplace(Dir, Watch);
+  return true;
+}
+
+bool FileManager::WatchRootFSPath(std::string_view RelativePath, bool FollowSymlink) {
+  // Walk the path like openat2(RESOLVE_IN_ROOT) does and watch every directory it passes through, including the ones
+  // that symlinks lead to. Renaming any of the components, swapping a symlink, or creating or removing the entry
+  // then shows up as an event and flushes the cache.
+  // Each directory gets watched before looking inside of it, so changes racing with the walk aren't missed either.
+  const auto &RootFSPath = LDPath();
+
+  // Current directory relative to the rootfs, without leading or trailing slashes
+  std::string Dir;
+  std::string Remaining {RelativePath};
+  size_t Position{};
+  uint32_t SymlinkHops{};
+
+  while (true) {
+    Position = Remaining.find_first_not_of('/', Position);
+    if (Position == std::string::npos) {
+      return true;
+    }
+
+    auto End = std::min(Remaining.find('/', Position), Remaining.size());
+    std::string Component = Remaining.substr(Position, End - Position);
+    Position = End;
+    const bool LastComponent = Remaining.find_first_not_of('/', Position) == std::string::npos;
+
+    if (Component == ".") {
+      continue;
+    }
+
+    if (Component == "..") {
+      // Can't walk out of the rootfs
+      auto Separator = Dir.find_last_of('/');
+      Dir.resize(Separator == std::string::npos ? 0 : Separator);
+      continue;
+    }
+
+    if (!WatchRootFSDirectory(Dir)) {
+      return false;
+    }
+
+    const auto Path = RootFSPath + "/" + Dir + "/" + Component;
+    struct stat Buffer{};
+    if (lstat(Path.c_str(), &Buffer) == -1) {
+      // Creating the missing entry shows up in the watched directory
+      return errno == ENOENT || errno == ENOTDIR;
+    }
+
+    if (S_ISLNK(Buffer.st_mode) && (!LastComponent || FollowSymlink)) {
+      // Same limit as the kernel
+      if (++SymlinkHops > 40) {
+        return false;
+      }
+
+      char Target[PATH_MAX];
+      auto TargetSize = readlink(Path.c_str(), Target, sizeof(Target));
+      if (TargetSize <= 0 || TargetSize == sizeof(Target)) {
+        return false;
+      }
+
+      // Absolute targets restart at the root of the rootfs, relative ones continue next to the symlink
+      if (Target[0] == '/') {
+        Dir.clear();
+      }
+      Remaining = std::string(Target, TargetSize) + Remaining.substr(Position);
+      Position = 0;
+      continue;
+    }
+
+    if (S_ISDIR(Buffer.st_mode)) {
+      Dir = Dir.empty() ? Component : Dir + "/" + Component;
+      continue;
+    }
+
+    // Either the end of the path or the resolution fails with ENOTDIR, which only changes in the watched directory
+    return true;
+  }
+}
+
+FileManager::CachedPath FileManager::ResolveRootFSPathImpl(const char *RelativePath, bool FollowSymlink, int RootFD, bool UseOpenat2, bool &Cacheable) {
+  const auto &RootFSPath = LDPath();
+  std::string Path = RootFSPath + "/" + RelativePath;
+  Cacheable = false;
+
+  if (UseOpenat2) {
+    // Let the kernel walk the path with the rootfs as `/`, which follows absolute symlinks inside of the rootfs.
+    FEX::HLE::open_how how {
+      .flags = static_cast<uint64_t>(O_PATH | O_CLOEXEC | (FollowSymlink ? 0 : O_NOFOLLOW)),
+      .resolve = RESOLVE_IN_ROOT,
+    };
+
+    int FD = ::syscall(SYSCALL_DEF(openat2), RootFD, RelativePath, &how, sizeof(how));
+    if (FD == -1) {
+      if (errno != ENOENT && errno != ENOTDIR) {
+        // Permission errors and such are left for the real syscall to report.
+        return {Path, true};
+      }
+
+      Cacheable = true;
+      return {Path, false};
+    }
+
+    auto ResolvedPath = FEX::get_fdpath(FD);
+    close(FD);
+
+    if (ResolvedPath) {
+      Cacheable = true;
+      return {std::move(*ResolvedPath), true};
+    }
+
+    return {Path, true};
   }
 
-  std::string Path = RootFSPath + pathname;
   if (FollowSymlink) {
     char Filename[PATH_MAX];
     while(FEX::HLE::IsSymlink(Path)) {
@@ -381,11 +672,108 @@ std::string FileManager::GetEmulatedPath(const char *pathname, bool FollowSymlin
         Path += std::string_view(Filename, SymlinkSize);
       }
       else {
-        break;
+        // Relative and dangling symlinks are left for the kernel to resolve.
+        return {Path, true};
+      }
+    }
+  }
+
+  struct stat Buffer{};
+  if (lstat(Path.c_str(), &Buffer) == 0) {
+    return {Path, true};
+  }
+
+  return {Path, errno != ENOENT && errno != ENOTDIR};
+}
+
+FileManager::CachedPath FileManager::ResolveRootFSPath(const char *pathname, bool FollowSymlink) {
+  // Skip all leading slashes, openat2 would treat the path as absolute anyway but the inotify watches want a relative path.
+  const char *RelativePath = pathname;
+  while (*RelativePath == '/') {
+    ++RelativePath;
+  }
+
+  if (*RelativePath == '\0') {
+    return {LDPath() + pathname, true};
+  }
+
+  auto &Cache = FollowSymlink ? PathCache : PathCacheNoFollow;
+  uint64_t Generation{};
+  bool Watched{};
+  int RootFD{};
+  bool UseOpenat2{};
+
+  {
+    // Misses walk the path with the lock held, hits are the common case.
+    FHU::ScopedSignalMaskWithMutex lk(PathCacheLock);
+    if (PathCacheValid()) {
+      auto it = Cache.find(pathname);
+      if (it != Cache.end()) {
+        return it->second;
+      }
+
+      // Watch before resolving so a change racing with the resolution still flushes the result.
+      Generation = PathCacheMapGeneration;
+      Watched = WatchRootFSPath(RelativePath, FollowSymlink);
+    }
+
+    RootFD = RootFSFD;
+    UseOpenat2 = SupportsOpenat2;
+  }
+
+  bool Cacheable{};
+  auto Result = ResolveRootFSPathImpl(RelativePath, FollowSymlink, RootFD, UseOpenat2, Cacheable);
+
+  if (Watched && Cacheable) {
+    FHU::ScopedSignalMaskWithMutex lk(PathCacheLock);
+    // If the cache was flushed while resolving then the result might already be stale.
+    if (Generation == PathCacheMapGeneration) {
+      if (Cache.size() >= MAX_PATH_CACHE_ENTRIES) {
+        // Also drops the watches this entry relies on, so it can't be added.
+        FlushPathCache();
+      }
+      else {
+        Cache.emplace(pathname, Result);
       }
     }
   }
-  return Path;
+
+  return Result;
+}
+
+std::optional<FileManager::CachedPath> FileManager::GetEmulatedPathEntry(const char *pathname, bool FollowSymlink) {
+  if (!pathname || // If no pathname
+      pathname[0] != '/' || // If relative
+      strcmp(pathname, "/") == 0) { // If we are getting root
+    return std::nullopt;
+  }
+
+  auto thunkOverlay = ThunkOverlays.find(pathname);
+  if (thunkOverlay != ThunkOverlays.end()) {
+    return CachedPath{thunkOverlay->second, true};
+  }
+
+  if (LDPath().empty()) { // If RootFS doesn't exist
+    return std::nullopt;
+  }
+
+  return ResolveRootFSPath(pathname, FollowSymlink);
+}
+
+std::string FileManager::GetEmulatedPath(const char *pathname, bool FollowSymlink) {
+  auto Entry = GetEmulatedPathEntry(pathname, FollowSymlink);
+  if (!Entry) {
+    return {};
+  }
+  return std::move(Entry->Path);
+}
+
+std::string FileManager::GetEmulatedLookupPath(const char *pathname, bool FollowSymlink) {
+  auto Entry = GetEmulatedPathEntry(pathname, FollowSymlink);
+  if (!Entry || !Entry->Exists) {
+    return {};
+  }
+  return std::move(Entry->Path);
 }
 
 
@@ -413,7 +801,7 @@ uint64_t FileManager::Open(const char *pathname, [[maybe_unused]] int flags, [[m
 
   fd = EmuFD.OpenAt(AT_FDCWD, SelfPath, flags, mode);
   if (fd == -1) {
-    auto Path = GetEmulatedPath(SelfPath, true);
+    auto Path = (flags & O_CREAT) ? GetEmulatedPath(SelfPath, true) : GetEmulatedLookupPath(SelfPath, true);
     if (!Path.empty()) {
       fd = ::open(Path.c_str(), flags, mode);
     }
@@ -432,6 +820,8 @@ uint64_t FileManager::Open(const char *pathname, [[maybe_unused]] int flags, [[m
 }
 
 uint64_t FileManager::Close(int fd) {
+  CheckInternalFDClosed(fd, fd);
+
   {
     FHU::ScopedSignalMaskWithMutex lk(FDLock);
     FDToNameMap.erase(fd);
@@ -445,6 +835,8 @@ uint64_t FileManager::CloseRange(unsigned int first, unsigned int last, unsigned
 #endif
 
   if (!(flags & CLOSE_RANGE_CLOEXEC)) {
+    CheckInternalFDClosed(first, std::min<unsigned int>(last, std::numeric_limits<int>::max()));
+
     // If the flag was set then it doesn't actually close the FDs
     // Just sets the flag on a range
     FHU::ScopedSignalMaskWithMutex lk(FDLock);
@@ -461,7 +853,7 @@ uint64_t FileManager::Stat(const char *pathname, void *buf) {
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
   // Stat follows symlinks
-  auto Path = GetEmulatedPath(SelfPath, true);
+  auto Path = GetEmulatedLookupPath(SelfPath, true);
   if (!Path.empty()) {
     uint64_t Result = ::stat(Path.c_str(), reinterpret_cast<struct stat*>(buf));
     if (Result != -1)
@@ -475,7 +867,7 @@ uint64_t FileManager::Lstat(const char *pathname, void *buf) {
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
   // lstat does not follow symlinks
-  auto Path = GetEmulatedPath(SelfPath, false);
+  auto Path = GetEmulatedLookupPath(SelfPath, false);
   if (!Path.empty()) {
     uint64_t Result = ::lstat(Path.c_str(), reinterpret_cast<struct stat*>(buf));
     if (Result != -1)
@@ -490,7 +882,7 @@ uint64_t FileManager::Access(const char *pathname, [[maybe_unused]] int mode) {
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
   // Access follows symlinks
-  auto Path = GetEmulatedPath(SelfPath, true);
+  auto Path = GetEmulatedLookupPath(SelfPath, true);
   if (!Path.empty()) {
     uint64_t Result = ::access(Path.c_str(), mode);
     if (Result != -1)
@@ -504,7 +896,7 @@ uint64_t FileManager::FAccessat(int dirfd, const char *pathname, int mode) {
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath);
+  auto Path = GetEmulatedLookupPath(SelfPath);
   if (!Path.empty()) {
     uint64_t Result = ::syscall(SYS_faccessat, dirfd, Path.c_str(), mode);
     if (Result != -1)
@@ -518,7 +910,7 @@ uint64_t FileManager::FAccessat2(int dirfd, const char *pathname, int mode, int
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath, (flags & AT_SYMLINK_NOFOLLOW) == 0);
+  auto Path = GetEmulatedLookupPath(SelfPath, (flags & AT_SYMLINK_NOFOLLOW) == 0);
   if (!Path.empty()) {
     uint64_t Result = ::syscall(SYSCALL_DEF(faccessat2), dirfd, Path.c_str(), mode, flags);
     if (Result != -1)
@@ -542,7 +934,7 @@ uint64_t FileManager::Readlink(const char *pathname, char *buf, size_t bufsiz) {
     return std::min(bufsiz, App.size());
   }
 
-  auto Path = GetEmulatedPath(pathname);
+  auto Path = GetEmulatedLookupPath(pathname);
   if (!Path.empty()) {
     uint64_t Result = ::readlink(Path.c_str(), buf, bufsiz);
     if (Result != -1)
@@ -563,7 +955,7 @@ uint64_t FileManager::Chmod(const char *pathname, mode_t mode) {
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath);
+  auto Path = GetEmulatedLookupPath(SelfPath);
   if (!Path.empty()) {
     uint64_t Result = ::chmod(Path.c_str(), mode);
     if (Result != -1)
@@ -615,7 +1007,7 @@ uint64_t FileManager::Readlinkat(int dirfd, const char *pathname, char *buf, siz
     return std::min(bufsiz, App.size());
   }
 
-  Path = GetEmulatedPath(pathname);
+  Path = GetEmulatedLookupPath(pathname);
   if (!Path.empty()) {
     uint64_t Result = ::readlinkat(dirfd, Path.c_str(), buf, bufsiz);
     if (Result != -1)
@@ -640,7 +1032,7 @@ uint64_t FileManager::Openat([[maybe_unused]] int dirfs, const char *pathname, i
 
   fd = EmuFD.OpenAt(dirfs, SelfPath, flags, mode);
   if (fd == -1) {
-    auto Path = GetEmulatedPath(SelfPath, true);
+    auto Path = (flags & O_CREAT) ? GetEmulatedPath(SelfPath, true) : GetEmulatedLookupPath(SelfPath, true);
     if (!Path.empty()) {
       fd = ::openat(dirfs, Path.c_str(), flags, mode);
     }
@@ -665,7 +1057,7 @@ uint64_t FileManager::Openat2(int dirfs, const char *pathname, FEX::HLE::open_ho
 
   fd = EmuFD.OpenAt(dirfs, SelfPath, how->flags, how->mode);
   if (fd == -1) {
-    auto Path = GetEmulatedPath(SelfPath, true);
+    auto Path = (how->flags & O_CREAT) ? GetEmulatedPath(SelfPath, true) : GetEmulatedLookupPath(SelfPath, true);
     if (!Path.empty()) {
       fd = ::syscall(SYSCALL_DEF(openat2), dirfs, Path.c_str(), how, usize);
     }
@@ -687,7 +1079,7 @@ uint64_t FileManager::Statx(int dirfd, const char *pathname, int flags, uint32_t
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath, (flags & AT_SYMLINK_NOFOLLOW) == 0);
+  auto Path = GetEmulatedLookupPath(SelfPath, (flags & AT_SYMLINK_NOFOLLOW) == 0);
   if (!Path.empty()) {
     uint64_t Result = FHU::Syscalls::statx(dirfd, Path.c_str(), flags, mask, statxbuf);
     if (Result != -1)
@@ -710,7 +1102,7 @@ uint64_t FileManager::Mknod(const char *pathname, mode_t mode, dev_t dev) {
 }
 
 uint64_t FileManager::Statfs(const char *path, void *buf) {
-  auto Path = GetEmulatedPath(path);
+  auto Path = GetEmulatedLookupPath(path);
   if (!Path.empty()) {
     uint64_t Result = ::statfs(Path.c_str(), reinterpret_cast<struct statfs*>(buf));
     if (Result != -1)
@@ -723,7 +1115,7 @@ uint64_t FileManager::NewFSStatAt(int dirfd, const char *pathname, struct stat *
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath, (flag & AT_SYMLINK_NOFOLLOW) == 0);
+  auto Path = GetEmulatedLookupPath(SelfPath, (flag & AT_SYMLINK_NOFOLLOW) == 0);
   if (!Path.empty()) {
     uint64_t Result = ::fstatat(dirfd, Path.c_str(), buf, flag);
     if (Result != -1) {
@@ -737,7 +1129,7 @@ uint64_t FileManager::NewFSStatAt64(int dirfd, const char *pathname, struct stat
   auto NewPath = GetSelf(pathname);
   const char *SelfPath = NewPath ? NewPath->c_str() : nullptr;
 
-  auto Path = GetEmulatedPath(SelfPath, (flag & AT_SYMLINK_NOFOLLOW) == 0);
+  auto Path = GetEmulatedLookupPath(SelfPath, (flag & AT_SYMLINK_NOFOLLOW) == 0);
   if (!Path.empty()) {
     uint64_t Result = ::fstatat64(dirfd, Path.c_str(), buf, flag);
     if (Result != -1) {
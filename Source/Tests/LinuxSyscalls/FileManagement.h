@@ -7,6 +7,7 @@ $end_info$
 #pragma once
 #include <FEXCore/Config/Config.h>
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -14,6 +15,7 @@ $end_info$
 #include <optional>
 #include <stddef.h>
 #include <string>
+#include <string_view>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
@@ -79,11 +81,51 @@ public:
 
   std::string GetEmulatedPath(const char *pathname, bool FollowSymlink = false);
 
+  // Same as GetEmulatedPath but returns an empty path if the path is known not to exist in the rootfs.
+  // Only usable for syscalls that can't create the path.
+  std::string GetEmulatedLookupPath(const char *pathname, bool FollowSymlink = false);
+
   std::mutex *GetFDLock() { return &FDLock; }
+  std::mutex *GetPathCacheLock() { return &PathCacheLock; }
+
+  // The child of a fork shares the inotify file description with the parent, it needs its own.
+  // SharedFDTable is set when the child shares the FD table with the parent, the parent's FDs are left open then.
+  void ResetPathCacheAfterFork(bool SharedFDTable = false);
 
 private:
+  struct CachedPath {
+    std::string Path;
+    bool Exists;
+  };
+
+  std::optional<CachedPath> GetEmulatedPathEntry(const char *pathname, bool FollowSymlink);
+  CachedPath ResolveRootFSPath(const char *pathname, bool FollowSymlink);
+  CachedPath ResolveRootFSPathImpl(const char *RelativePath, bool FollowSymlink, int RootFD, bool UseOpenat2, bool &Cacheable);
+  bool WatchRootFSPath(std::string_view RelativePath, bool FollowSymlink);
+  bool WatchRootFSDirectory(const std::string &Dir);
+  bool PathCacheValid();
+  void FlushPathCache();
+  void SetupPathCache();
+  void ClosePathCache(bool CloseFDs = true);
+  void CheckInternalFDClosed(int first, int last);
+
   FEX::EmulatedFile::EmulatedFDManager EmuFD;
 
+  // O_PATH fd of the rootfs, used for resolving paths in the rootfs with openat2(RESOLVE_IN_ROOT).
+  int RootFSFD {-1};
+  bool SupportsOpenat2 {};
+
+  // Guest path -> rootfs path cache, holding positive and negative entries.
+  // Invalidated whenever inotify reports a change to a directory that a cached entry depends on.
+  // Everything below, RootFSFD and SupportsOpenat2 are protected by PathCacheLock.
+  int PathCacheINotifyFD {-1};
+  uint64_t PathCacheMapGeneration {};
+  std::mutex PathCacheLock;
+  std::unordered_map<std::string, CachedPath> PathCache;
+  std::unordered_map<std::string, CachedPath> PathCacheNoFollow;
+  // Rootfs relative directory -> inotify watch, every directory walked while resolving a cached entry
+  std::unordered_map<std::string, int> PathCacheWatches;
+
   std::mutex FDLock;
   std::map<uint32_t, std::string> FDToNameMap;
   std::map<std::string, std::string, std::less<>> ThunkOverlays;
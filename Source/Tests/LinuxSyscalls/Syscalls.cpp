@@ -557,12 +557,25 @@ uint64_t CloneHandler(FEXCore::Core::CpuStateFrame *Frame, FEX::HLE::clone3_args
     if (!AnyFlagsSet(flags, CLONE_THREAD)) {
       // Has an unsupported flag
       // Fall to a handler that can handle this case
+      // A child without CLONE_VM gets a copy of the path cache, which must not be mid-update.
+      // The child resets it and unlocks its copy in HandleNewClone.
+      const bool CopiesMemory = !(flags & CLONE_VM);
+      if (CopiesMemory) {
+        FEX::HLE::_SyscallHandler->FM.GetPathCacheLock()->lock();
+      }
+
+      uint64_t Result{};
       if (args->Type == TYPE_CLONE2) {
-        return Clone2Handler(Frame, args);
+        Result = Clone2Handler(Frame, args);
       }
       else {
-        return Clone3Handler(Frame, args);
+        Result = Clone3Handler(Frame, args);
+      }
+
+      if (CopiesMemory) {
+        FEX::HLE::_SyscallHandler->FM.GetPathCacheLock()->unlock();
       }
+      return Result;
     }
     else {
       LogMan::Msg::IFmt("Unsupported flag with CLONE_THREAD. This breaks TLS, falling down classic thread path");
@@ -794,6 +807,7 @@ uint64_t UnimplementedSyscallSafe(FEXCore::Core::CpuStateFrame *Frame, uint64_t
 
 void SyscallHandler::LockBeforeFork() {
   FM.GetFDLock()->lock();
+  FM.GetPathCacheLock()->lock();
 
   // XXX shared_mutex has issues with locking and forks
   // VMATracking.Mutex.lock();
@@ -806,7 +820,8 @@ void SyscallHandler::UnlockAfterFork() {
 
   // XXX shared_mutex has issues with locking and forks
   // VMATracking.Mutex.unlock();
-  
+
+  FM.GetPathCacheLock()->unlock();
   FM.GetFDLock()->unlock(); 
 }
 
@@ -1119,4 +1134,67 @@ std::unique_ptr<FEXCore::HLE::SourcecodeMap> SyscallHandler::GenerateMap(const s
   
 }
 
+std::unique_ptr<FEXCore::HLE::SourcecodeMap> SyscallHandler::GenerateSymbolMap(const std::string_view& GuestBinaryFile) {
+  const std::string Filename {GuestBinaryFile};
+
+  {
+    // Don't bother the ELF loaders with PE files and friends, they would log errors for them
+    char Magic[SELFMAG]{};
+    std::ifstream Stream(Filename, std::ios::binary);
+    if (!Stream.read(Magic, sizeof(Magic)) || memcmp(Magic, ELFMAG, SELFMAG) != 0) {
+      return {};
+    }
+  }
+
+  ELFParser GuestELF;
+  if (!GuestELF.ReadElf(Filename)) {
+    return {};
+  }
+
+  ELFLoader::ELFContainer Container {Filename, "", true};
+  if (!Container.WasLoaded()) {
+    return {};
+  }
+
+  auto rv = std::make_unique<FEXCore::HLE::SourcecodeMap>();
+
+  Container.AddSymbols([&](ELFLoader::ELFSymbol *Sym) {
+    if (Sym->Type != STT_FUNC && Sym->Type != STT_GNU_IFUNC) {
+      return;
+    }
+
+    auto FileOffset = GuestELF.VAToFile(Sym->Address);
+    if (!FileOffset) {
+      return;
+    }
+
+    rv->SortedSymbolMappings.push_back({static_cast<uintptr_t>(FileOffset), static_cast<uintptr_t>(FileOffset + Sym->Size), Sym->Name});
+  });
+
+  // Prefer the sized symbol when aliases share an address
+  std::sort(rv->SortedSymbolMappings.begin(), rv->SortedSymbolMappings.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.FileGuestBegin < rhs.FileGuestBegin ||
+           (lhs.FileGuestBegin == rhs.FileGuestBegin && lhs.FileGuestEnd > rhs.FileGuestEnd);
+  });
+
+  auto Last = std::unique(rv->SortedSymbolMappings.begin(), rv->SortedSymbolMappings.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.FileGuestBegin == rhs.FileGuestBegin;
+  });
+  rv->SortedSymbolMappings.erase(Last, rv->SortedSymbolMappings.end());
+
+  // Lookups need non-overlapping ranges. Unsized symbols extend to the next symbol.
+  for (size_t i = 0; i < rv->SortedSymbolMappings.size(); ++i) {
+    auto &Mapping = rv->SortedSymbolMappings[i];
+    const bool HasNext = i + 1 < rv->SortedSymbolMappings.size();
+    const auto NextBegin = HasNext ? rv->SortedSymbolMappings[i + 1].FileGuestBegin : ~0ULL;
+
+    if (Mapping.FileGuestEnd == Mapping.FileGuestBegin || Mapping.FileGuestEnd > NextBegin) {
+      Mapping.FileGuestEnd = HasNext ? NextBegin : Mapping.FileGuestBegin + 1;
+    }
+  }
+
+  LogMan::Msg::DFmt("GenerateSymbolMap: {} functions in '{}'", rv->SortedSymbolMappings.size(), GuestBinaryFile);
+  return rv;
+}
+
 }
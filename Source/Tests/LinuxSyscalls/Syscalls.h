@@ -166,6 +166,9 @@ public:
   FEX_CONFIG_OPT(ThreadsConfig, THREADS);
   FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
   FEX_CONFIG_OPT(SMCChecks, SMCCHECKS);
+  FEX_CONFIG_OPT(AOTIRCapture, AOTIRCAPTURE);
+  FEX_CONFIG_OPT(AOTIRGenerate, AOTIRGENERATE);
+  FEX_CONFIG_OPT(AOTIRLoad, AOTIRLOAD);
 
   uint32_t GetHostKernelVersion() const { return HostKernelVersion; }
   uint32_t GetGuestKernelVersion() const { return GuestKernelVersion; }
@@ -247,6 +250,7 @@ private:
   std::unique_ptr<FEX::HLE::MemAllocator> Alloc32Handler{};
 
   std::unique_ptr<FEXCore::HLE::SourcecodeMap> GenerateMap(const std::string_view& GuestBinaryFile, const std::string_view& GuestBinaryFileId) override;
+  std::unique_ptr<FEXCore::HLE::SourcecodeMap> GenerateSymbolMap(const std::string_view& GuestBinaryFile) override;
   
   ///// VMA (Virtual Memory Area) tracking /////
 
@@ -140,6 +140,13 @@ namespace FEX::HLE {
       // Frame->Thread is /ONLY/ safe to access when CLONE_THREAD flag is not set
       FEXCore::Context::CleanupAfterFork(CTX, Frame->Thread);
 
+      if (!(flags & CLONE_VM)) {
+        // CloneHandler locked the path cache before the host clone, this is our own copy of it now.
+        // With CLONE_FILES the FDs are still the parent's, those are left alone.
+        FEX::HLE::_SyscallHandler->FM.ResetPathCacheAfterFork(flags & CLONE_FILES);
+        FEX::HLE::_SyscallHandler->FM.GetPathCacheLock()->unlock();
+      }
+
       Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RAX] = 0;
       Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RBX] = 0;
       Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RBP] = 0;
@@ -206,6 +213,7 @@ namespace FEX::HLE {
       Thread->ThreadManager.TID = FHU::Syscalls::gettid();
       Thread->ThreadManager.PID = ::getpid();
       FEX::HLE::_SyscallHandler->FM.UpdatePID(Thread->ThreadManager.PID);
+      FEX::HLE::_SyscallHandler->FM.ResetPathCacheAfterFork();
       Thread->ThreadManager.clear_child_tid = nullptr;
 
       // Clear all the other threads that are being tracked
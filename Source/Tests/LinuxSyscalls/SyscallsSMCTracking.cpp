@@ -9,9 +9,12 @@ $end_info$
 #include "Common/FDUtils.h"
 
 #include <filesystem>
+#include <optional>
+#include <string>
 #include <sys/shm.h>
 #include <sys/mman.h>
 
+#include "Linux/Utils/ELFFileIdentity.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 
 #include <FEXHeaderUtils/TypeDefines.h>
@@ -187,6 +190,29 @@ void SyscallHandler::TrackMmap(uintptr_t Base, uintptr_t Size, int Prot, int Fla
     MarkMemoryShared(CTX);
   }
 
+  // Executable file mappings are handed to the code object cache once the VMA lock is dropped
+  std::optional<std::string> CodeFilename;
+
+  struct stat64 buf{};
+  // Only AOTIR keys its cache entries on the file identity, which can hash the whole file.
+  // Compute it before taking the VMA lock and only for files that aren't tracked yet.
+  std::string FileIdentity;
+  if (!(Flags & MAP_ANONYMOUS)) {
+    fstat64(fd, &buf);
+
+    if (AOTIRLoad() || AOTIRCapture() || AOTIRGenerate()) {
+      bool Tracked{};
+      {
+        FHU::ScopedSignalMaskWithSharedLock lk(_SyscallHandler->VMATracking.Mutex);
+        Tracked = VMATracking.MappedResources.contains(MRID {buf.st_dev, buf.st_ino});
+      }
+
+      if (!Tracked) {
+        FileIdentity = ELFLoader::GetFileIdentity(fd, buf);
+      }
+    }
+  }
+
   {
     FHU::ScopedSignalMaskWithUniqueLock lk(_SyscallHandler->VMATracking.Mutex);
 
@@ -195,18 +221,20 @@ void SyscallHandler::TrackMmap(uintptr_t Base, uintptr_t Size, int Prot, int Fla
     MappedResource *Resource = nullptr;
 
     if (!(Flags & MAP_ANONYMOUS)) {
-      struct stat64 buf;
-      fstat64(fd, &buf);
       MRID mrid {buf.st_dev, buf.st_ino};
 
       auto filename = FEX::get_fdpath(fd);
 
+      if (filename.has_value() && (Prot & PROT_EXEC)) {
+        CodeFilename = filename;
+      }
+
       if (filename.has_value()) {
         auto [Iter, Inserted] = VMATracking.MappedResources.emplace(mrid, MappedResource {nullptr, nullptr, 0});
         Resource = &Iter->second;
 
         if (Inserted) {
-          Resource->AOTIRCacheEntry = FEXCore::Context::LoadAOTIRCacheEntry(CTX, filename.value());
+          Resource->AOTIRCacheEntry = FEXCore::Context::LoadAOTIRCacheEntry(CTX, filename.value(), FileIdentity);
           Resource->Iterator = Iter;
         }
       }
@@ -224,6 +252,15 @@ void SyscallHandler::TrackMmap(uintptr_t Base, uintptr_t Size, int Prot, int Fla
     VMATracking.SetUnsafe(CTX, Resource, Base, Offset, Size, VMAFlags::fromFlags(Flags), VMAProt::fromProt(Prot));
   }
 
+  if (Flags & MAP_FIXED) {
+    // Whatever code regions this replaced are gone
+    FEXCore::Context::RemoveNamedRegion(CTX, Base, Size);
+  }
+
+  if (CodeFilename.has_value()) {
+    FEXCore::Context::AddNamedRegion(CTX, Base, Size, Offset, CodeFilename.value());
+  }
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, (uintptr_t)Base, Size);
   }
@@ -238,6 +275,8 @@ void SyscallHandler::TrackMunmap(uintptr_t Base, uintptr_t Size) {
     VMATracking.ClearUnsafe(CTX, Base, Size);
   }
 
+  FEXCore::Context::RemoveNamedRegion(CTX, Base, Size);
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, (uintptr_t)Base, Size);
   }
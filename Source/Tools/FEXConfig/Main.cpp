@@ -478,6 +478,13 @@ namespace {
         ConfigChanged = true;
       }
 
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_AOTIRINCREMENTAL);
+      bool AOTIncremental = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Incremental generate", &AOTIncremental)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_AOTIRINCREMENTAL, AOTIncremental ? "1" : "0");
+        ConfigChanged = true;
+      }
+
       Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_AOTIRCAPTURE);
       bool AOTCapture = Value.has_value() && **Value == "1";
       if (ImGui::Checkbox("Capture", &AOTCapture)) {
@@ -572,6 +579,20 @@ namespace {
         ConfigChanged = true;
       }
 
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_STACKTSOELISION);
+      bool StackTSOElision = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Stack TSO Elision", &StackTSOElision)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_STACKTSOELISION, StackTSOElision ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_FRAMEPOINTERTSOELISION);
+      bool FramePointerTSOElision = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Frame Pointer TSO Elision", &FramePointerTSOElision)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_FRAMEPOINTERTSOELISION, FramePointerTSOElision ? "1" : "0");
+        ConfigChanged = true;
+      }
+
       Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_X87REDUCEDPRECISION);
       bool X87ReducedPrecision = Value.has_value() && **Value == "1";
       if (ImGui::Checkbox("X87 Reduced Precision", &X87ReducedPrecision)) {
@@ -0,0 +1,193 @@
+#include <catch2/catch.hpp>
+#include "Interface/IR/AOTIRCodec.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IREmitter.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/IR/RegisterAllocationData.h>
+#include <FEXCore/Utils/ThreadPoolAllocator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace {
+  // Function with two blocks, the second block at guest offset 0x10
+  constexpr char FunctionIR[] = R"(
+(%ssa1) IRHeader %ssa2, #2
+  (%ssa2) CodeBlock %Begin1, %End1, %ssa1
+    (%Begin1 i0) BeginBlock %ssa2
+    (%Guest1 i0) GuestOpcode #0x0
+    %Value1 i64 = Constant #0x1234
+    (%Store1 i64) StoreContext #8, GPR, %Value1 i64, #0x8
+    (%Jump1 i0) Jump %ssa3
+    (%End1 i0) EndBlock %ssa2
+  (%ssa3) CodeBlock %Begin2, %End2, %ssa1
+    (%Begin2 i0) BeginBlock %ssa3
+    (%Guest2 i0) GuestOpcode #0x10
+    %Value2 i64 = Constant #0x5678
+    %Sum i64 = Add %Value2 i64, %Value2 i64
+    (%Store2 i64) StoreContext #8, GPR, %Sum i64, #0x10
+    %NewRIP i64 = EntrypointOffset #0x18, #8
+    (%Exit i0) ExitFunction %NewRIP i64
+    (%End2 i0) EndBlock %ssa3
+)";
+
+  // Entry starting at the second block of FunctionIR
+  constexpr char TailIR[] = R"(
+(%ssa1) IRHeader %ssa2, #1
+  (%ssa2) CodeBlock %Begin2, %End2, %ssa1
+    (%Begin2 i0) BeginBlock %ssa2
+    (%Guest2 i0) GuestOpcode #0x0
+    %Value2 i64 = Constant #0x5678
+    %Sum i64 = Add %Value2 i64, %Value2 i64
+    (%Store2 i64) StoreContext #8, GPR, %Sum i64, #0x10
+    %NewRIP i64 = EntrypointOffset #0x8, #8
+    (%Exit i0) ExitFunction %NewRIP i64
+    (%End2 i0) EndBlock %ssa2
+)";
+
+  struct ParsedEntry {
+    std::unique_ptr<FEXCore::IR::IREmitter> Emitter;
+    std::unique_ptr<FEXCore::IR::IRListView> IR;
+    FEXCore::IR::RegisterAllocationData::UniquePtr RA;
+  };
+
+  ParsedEntry Parse(FEXCore::Utils::IntrusivePooledAllocator &Allocator, char const *Text) {
+    ParsedEntry Result;
+    std::istringstream Stream(Text);
+    Result.Emitter = FEXCore::IR::Parse(Allocator, &Stream);
+    REQUIRE(Result.Emitter);
+    Result.IR.reset(Result.Emitter->CreateIRCopy());
+
+    // Arbitrary registers with runs in between, the exact values don't matter
+    Result.RA = FEXCore::IR::RegisterAllocationData::Create(Result.IR->GetSSACount());
+    Result.RA->SpillSlotCount = 3;
+    for (uint32_t i = 0; i < Result.RA->MapCount; ++i) {
+      Result.RA->Map[i] = FEXCore::IR::PhysicalRegister(FEXCore::IR::GPRClass, (i / 3) % 8);
+    }
+    return Result;
+  }
+
+  struct SerializedPool {
+    explicit SerializedPool(FEXCore::IR::AOTIRPoolBuilder const &Pool) {
+      std::ostringstream Stream;
+      Pool.Serialize(Stream);
+      Data = Stream.str();
+
+      const auto TableSize = (Pool.Count() + 1) * sizeof(uint32_t);
+      View = {
+        .Offsets = reinterpret_cast<uint32_t const*>(Data.data()),
+        .Count = Pool.Count(),
+        .Data = reinterpret_cast<uint8_t const*>(Data.data() + TableSize),
+        .DataSize = Data.size() - TableSize,
+      };
+    }
+
+    std::string Data;
+    FEXCore::IR::AOTIRPoolView View;
+  };
+
+  void CheckRoundTrip(ParsedEntry const &Entry, std::string const &Encoded, FEXCore::IR::AOTIRPoolView const &Pool) {
+    auto Begin = reinterpret_cast<uint8_t const*>(Encoded.data());
+
+    FEXCore::IR::IRListView *DecodedIR{};
+    FEXCore::IR::RegisterAllocationData::UniquePtr DecodedRA;
+    REQUIRE(FEXCore::IR::DecodeAOTIREntry(Begin, Begin + Encoded.size(), Pool, &DecodedIR, &DecodedRA));
+    std::unique_ptr<FEXCore::IR::IRListView> IR {DecodedIR};
+
+    // Node IDs and data offsets are preserved, so the decoded lists match byte for byte
+    REQUIRE(IR->GetDataSize() == Entry.IR->GetDataSize());
+    REQUIRE(IR->GetListSize() == Entry.IR->GetListSize());
+    CHECK(memcmp(reinterpret_cast<void const*>(IR->GetData()), reinterpret_cast<void const*>(Entry.IR->GetData()), IR->GetDataSize()) == 0);
+    CHECK(memcmp(reinterpret_cast<void const*>(IR->GetListData()), reinterpret_cast<void const*>(Entry.IR->GetListData()), IR->GetListSize()) == 0);
+
+    REQUIRE(DecodedRA->MapCount == Entry.RA->MapCount);
+    CHECK(DecodedRA->SpillSlotCount == Entry.RA->SpillSlotCount);
+    CHECK(memcmp(&DecodedRA->Map[0], &Entry.RA->Map[0], DecodedRA->MapCount) == 0);
+
+    std::stringstream Original, Decoded;
+    FEXCore::IR::Dump(&Original, Entry.IR.get(), Entry.RA.get());
+    FEXCore::IR::Dump(&Decoded, IR.get(), DecodedRA.get());
+    CHECK(Decoded.str() == Original.str());
+  }
+}
+
+TEST_CASE("AOTIRCodec - Round trip") {
+  FEXCore::Utils::PooledAllocatorMalloc Allocator;
+  auto Function = Parse(Allocator, FunctionIR);
+  auto Tail = Parse(Allocator, TailIR);
+
+  FEXCore::IR::AOTIRPoolBuilder Pool;
+  std::string FunctionEncoded, TailEncoded;
+  FEXCore::IR::EncodeAOTIREntry(FunctionEncoded, Function.IR.get(), Function.RA.get(), &Pool);
+  FEXCore::IR::EncodeAOTIREntry(TailEncoded, Tail.IR.get(), Tail.RA.get(), &Pool);
+
+  SerializedPool Serialized(Pool);
+  CheckRoundTrip(Function, FunctionEncoded, Serialized.View);
+  CheckRoundTrip(Tail, TailEncoded, Serialized.View);
+}
+
+TEST_CASE("AOTIRCodec - Identical entries") {
+  FEXCore::Utils::PooledAllocatorMalloc Allocator;
+  auto First = Parse(Allocator, FunctionIR);
+  auto Second = Parse(Allocator, FunctionIR);
+
+  FEXCore::IR::AOTIRPoolBuilder Pool;
+  std::string FirstEncoded, SecondEncoded;
+  FEXCore::IR::EncodeAOTIREntry(FirstEncoded, First.IR.get(), First.RA.get(), &Pool);
+  const auto PoolCount = Pool.Count();
+  FEXCore::IR::EncodeAOTIREntry(SecondEncoded, Second.IR.get(), Second.RA.get(), &Pool);
+
+  // Same IR encodes to the same bytes, which is what lets AOTIR store the entry once
+  CHECK(FirstEncoded == SecondEncoded);
+  CHECK(Pool.Count() == PoolCount);
+}
+
+TEST_CASE("AOTIRCodec - Shared block bodies") {
+  FEXCore::Utils::PooledAllocatorMalloc Allocator;
+  auto Function = Parse(Allocator, FunctionIR);
+  auto Tail = Parse(Allocator, TailIR);
+
+  // What the tail adds to a pool on its own
+  FEXCore::IR::AOTIRPoolBuilder TailPool;
+  std::string Encoded;
+  FEXCore::IR::EncodeAOTIREntry(Encoded, Tail.IR.get(), Tail.RA.get(), &TailPool);
+
+  // The tail's block is the function's second block at a different entry offset and node position,
+  // only the header and block list of the tail are new
+  FEXCore::IR::AOTIRPoolBuilder Pool;
+  Encoded.clear();
+  FEXCore::IR::EncodeAOTIREntry(Encoded, Function.IR.get(), Function.RA.get(), &Pool);
+  const auto PoolCount = Pool.Count();
+  std::string TailEncoded;
+  FEXCore::IR::EncodeAOTIREntry(TailEncoded, Tail.IR.get(), Tail.RA.get(), &Pool);
+
+  const auto Added = Pool.Count() - PoolCount;
+  CHECK(Added < TailPool.Count());
+  // Tail block body, its ops and the EntrypointOffset shape are all shared
+  CHECK(Added <= 2);
+
+  SerializedPool Serialized(Pool);
+  CheckRoundTrip(Tail, TailEncoded, Serialized.View);
+}
+
+TEST_CASE("AOTIRCodec - Corrupt data") {
+  FEXCore::Utils::PooledAllocatorMalloc Allocator;
+  auto Function = Parse(Allocator, FunctionIR);
+
+  FEXCore::IR::AOTIRPoolBuilder Pool;
+  std::string Encoded;
+  FEXCore::IR::EncodeAOTIREntry(Encoded, Function.IR.get(), Function.RA.get(), &Pool);
+  SerializedPool Serialized(Pool);
+
+  // Every truncation has to be caught without reading past the end
+  auto Begin = reinterpret_cast<uint8_t const*>(Encoded.data());
+  for (size_t Size = 0; Size < Encoded.size(); ++Size) {
+    FEXCore::IR::IRListView *IR{};
+    FEXCore::IR::RegisterAllocationData::UniquePtr RA;
+    CHECK_FALSE(FEXCore::IR::DecodeAOTIREntry(Begin, Begin + Size, Serialized.View, &IR, &RA));
+  }
+}
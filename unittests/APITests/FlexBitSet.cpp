@@ -0,0 +1,219 @@
+#include <catch2/catch.hpp>
+#include "Utils/Allocator/FlexBitSet.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+  constexpr size_t NumElements = 64 * 1024;
+
+  struct BitSetStorage {
+    BitSetStorage(size_t Elements)
+      : Backing(Elements / 64 + 1) {}
+
+    FEXCore::FlexBitSet<uint64_t> *Get() {
+      return reinterpret_cast<FEXCore::FlexBitSet<uint64_t>*>(Backing.data());
+    }
+
+    void Fill(uint64_t Value) {
+      std::fill(Backing.begin(), Backing.end(), Value);
+    }
+
+    std::vector<uint64_t> Backing;
+  };
+
+  // Summary of a BitSetStorage, one bit per backing element.
+  struct SummaryStorage {
+    SummaryStorage(size_t Elements)
+      : Backing(FEXCore::FlexBitSet<uint64_t>::SummarySize(Elements) / sizeof(uint64_t) + 1) {}
+
+    FEXCore::FlexBitSet<uint64_t> *Get() {
+      return reinterpret_cast<FEXCore::FlexBitSet<uint64_t>*>(Backing.data());
+    }
+
+    std::vector<uint64_t> Backing;
+  };
+
+  void CheckSummary(BitSetStorage &Storage, FEXCore::FlexBitSet<uint64_t> *Full, size_t Elements) {
+    for (size_t i = 0; i < Elements / 64; ++i) {
+      REQUIRE(Full->Get(i) == (Storage.Backing[i] == ~0ULL));
+    }
+  }
+
+  // Fills the set with random allocations, leaving holes of random sizes.
+  void FillRandom(FEXCore::FlexBitSet<uint64_t> *Set, std::mt19937_64 &Rand, size_t Elements) {
+    std::uniform_int_distribution<size_t> Length(1, 200);
+    size_t Current{};
+    bool Used = true;
+    while (Current < Elements) {
+      size_t Count = std::min(Length(Rand), Elements - Current);
+      if (Used) {
+        Set->SetRange(Current, Count);
+      }
+      Current += Count;
+      Used = !Used;
+    }
+  }
+
+  // Reference implementations, testing a single element at a time.
+  size_t ReferenceForward(FEXCore::FlexBitSet<uint64_t> *Set, size_t Begin, size_t Count, size_t Elements) {
+    for (size_t Start = Begin; Count < Elements && Start < (Elements - Count); ++Start) {
+      size_t i = 0;
+      for (; i < Count && !Set->Get(Start + i); ++i);
+      if (i == Count) {
+        return Start;
+      }
+    }
+    return ~0ULL;
+  }
+
+  size_t ReferenceBackward(FEXCore::FlexBitSet<uint64_t> *Set, size_t Begin, size_t Count, size_t Minimum) {
+    for (size_t End = Begin; End >= (Minimum + Count); --End) {
+      size_t i = 0;
+      for (; i < Count && !Set->Get(End - Count + i); ++i);
+      if (i == Count) {
+        return End - Count;
+      }
+    }
+    return ~0ULL;
+  }
+}
+
+TEST_CASE("FlexBitSet - Ranges") {
+  BitSetStorage Storage(NumElements);
+  auto Set = Storage.Get();
+  Storage.Fill(0);
+
+  Set->SetRange(3, 130);
+  REQUIRE(Set->Get(2) == false);
+  for (size_t i = 3; i < 133; ++i) {
+    REQUIRE(Set->Get(i) == true);
+  }
+  REQUIRE(Set->Get(133) == false);
+
+  REQUIRE(Set->TestAndClearRange(0, 10) == 7);
+  REQUIRE(Set->TestAndClearRange(0, 10) == 0);
+  REQUIRE(Set->TestAndClearRange(64, 200) == 69);
+  REQUIRE(Set->TestAndClearRange(0, 200) == 54);
+}
+
+TEST_CASE("FlexBitSet - Scan") {
+  BitSetStorage Storage(NumElements);
+  auto Set = Storage.Get();
+  std::mt19937_64 Rand(0x4645582D456D75);
+  std::uniform_int_distribution<size_t> Position(0, NumElements - 1);
+  std::uniform_int_distribution<size_t> Count(1, 150);
+
+  for (size_t Iteration = 0; Iteration < 16; ++Iteration) {
+    Storage.Fill(0);
+    FillRandom(Set, Rand, NumElements);
+
+    for (size_t i = 0; i < 256; ++i) {
+      size_t Begin = Position(Rand);
+      size_t Elements = Count(Rand);
+
+      REQUIRE(Set->ForwardScanForRange<true>(Begin, Elements, NumElements).FoundElement ==
+              ReferenceForward(Set, Begin, Elements, NumElements));
+
+      size_t Minimum = Position(Rand) % (Begin + 1);
+      REQUIRE(Set->BackwardScanForRange<true>(Begin, Elements, Minimum).FoundElement ==
+              ReferenceBackward(Set, Begin, Elements, Minimum));
+    }
+  }
+}
+
+TEST_CASE("FlexBitSet - Scan throughput") {
+  // Worst case for the allocator, a nearly full region with only single page holes.
+  BitSetStorage Storage(NumElements);
+  auto Set = Storage.Get();
+  Storage.Fill(~0ULL);
+  for (size_t i = 0; i < NumElements; i += 97) {
+    Set->Clear(i);
+  }
+
+  constexpr size_t Iterations = 1000;
+  auto Now = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < Iterations; ++i) {
+    auto Forward = Set->ForwardScanForRange<true>(0, 2, NumElements);
+    auto Backward = Set->BackwardScanForRange<true>(NumElements - 1, 2, 0);
+    REQUIRE(Forward.FoundElement == ~0ULL);
+    REQUIRE(Forward.FoundHole == true);
+    REQUIRE(Backward.FoundElement == ~0ULL);
+    REQUIRE(Backward.FoundHole == true);
+  }
+  auto End = std::chrono::high_resolution_clock::now();
+
+  WARN("Scanned " << (Iterations * NumElements * 2) << " pages in "
+       << std::chrono::duration_cast<std::chrono::microseconds>(End - Now).count() << "us");
+}
+
+TEST_CASE("FlexBitSet - Summary") {
+  BitSetStorage Storage(NumElements);
+  SummaryStorage Summary(NumElements);
+  auto Set = Storage.Get();
+  auto Full = Summary.Get();
+  std::mt19937_64 Rand(0x53756D6D617279);
+  std::uniform_int_distribution<size_t> Position(0, NumElements - 1);
+  std::uniform_int_distribution<size_t> Length(1, 3000);
+  std::uniform_int_distribution<size_t> Count(1, 150);
+
+  Storage.Fill(0);
+  for (size_t Iteration = 0; Iteration < 2000; ++Iteration) {
+    // Mostly sets so the set fills up with full elements and a few holes
+    size_t Begin = Position(Rand);
+    size_t Elements = std::min(Length(Rand), NumElements - Begin);
+    if (Rand() % 4) {
+      Set->SetRange(Begin, Elements, Full);
+    }
+    else {
+      Set->TestAndClearRange(Begin, Elements % 200 + 1, Full);
+    }
+
+    if (Iteration % 50 == 0) {
+      CheckSummary(Storage, Full, NumElements);
+    }
+
+    Begin = Position(Rand);
+    Elements = Count(Rand);
+    REQUIRE(Set->ForwardScanForRange<true>(Begin, Elements, NumElements, Full).FoundElement ==
+            ReferenceForward(Set, Begin, Elements, NumElements));
+
+    size_t Minimum = Position(Rand) % (Begin + 1);
+    REQUIRE(Set->BackwardScanForRange<true>(Begin, Elements, Minimum, Full).FoundElement ==
+            ReferenceBackward(Set, Begin, Elements, Minimum));
+  }
+  CheckSummary(Storage, Full, NumElements);
+}
+
+TEST_CASE("FlexBitSet - Summary scan throughput") {
+  // Nearly full region with holes that are too small, spread far enough apart that most elements are full.
+  BitSetStorage Storage(NumElements);
+  SummaryStorage Summary(NumElements);
+  auto Set = Storage.Get();
+  auto Full = Summary.Get();
+  Storage.Fill(0);
+  Set->SetRange(0, NumElements, Full);
+  for (size_t i = 0; i < NumElements; i += 4096) {
+    Set->TestAndClearRange(i, 1, Full);
+  }
+
+  auto Time = [&](FEXCore::FlexBitSet<uint64_t> const *Summary) {
+    constexpr size_t Iterations = 10000;
+    auto Now = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < Iterations; ++i) {
+      auto Forward = Set->ForwardScanForRange<true>(0, 2, NumElements, Summary);
+      auto Backward = Set->BackwardScanForRange<true>(NumElements - 1, 2, 0, Summary);
+      REQUIRE(Forward.FoundElement == ~0ULL);
+      REQUIRE(Backward.FoundElement == ~0ULL);
+    }
+    auto End = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(End - Now).count();
+  };
+
+  const auto Flat = Time(nullptr);
+  const auto Summarized = Time(Full);
+  WARN("Sparse holes, flat scan " << Flat << "us, with summary " << Summarized << "us");
+}
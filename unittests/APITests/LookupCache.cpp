@@ -0,0 +1,193 @@
+#include <catch2/catch.hpp>
+#include "Interface/Core/LookupCache.h"
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+  using FEXCore::LookupCache;
+
+  struct PageStorage {
+    explicit PageStorage(uint32_t NumEntries)
+      : Backing(sizeof(LookupCache::L2Page) / sizeof(uint64_t) + NumEntries) {
+      auto Page = Get();
+      Page->GuestPage = 0x10000;
+      Page->CodeBase = 0;
+      Page->Mask = NumEntries - 1;
+      Page->Count = 0;
+    }
+
+    LookupCache::L2Page *Get() {
+      return reinterpret_cast<LookupCache::L2Page*>(Backing.data());
+    }
+
+    // Zero filled like the real page memory
+    std::vector<uint64_t> Backing;
+  };
+
+  // First Count page offsets whose home is Slot
+  std::vector<uint64_t> HomedAt(uint32_t Slot, uint32_t Mask, size_t Count) {
+    std::vector<uint64_t> Result;
+    for (uint64_t Candidate = 0; Candidate < 0x1000 && Result.size() < Count; ++Candidate) {
+      if ((LookupCache::L2Hash(Candidate) & Mask) == Slot) {
+        Result.emplace_back(Candidate);
+      }
+    }
+    return Result;
+  }
+
+  void Insert(LookupCache::L2Page *Page, uint64_t Offset, int32_t HostCodeOffset) {
+    LookupCache::InsertL2Entry(Page, Offset + 1, HostCodeOffset);
+  }
+
+  bool Erase(LookupCache::L2Page *Page, uint64_t Offset) {
+    auto Entry = LookupCache::FindL2Entry(Page, Offset);
+    if (!Entry) {
+      return false;
+    }
+    LookupCache::EraseL2Entry(Page, Entry);
+    return true;
+  }
+
+  void CheckContents(LookupCache::L2Page *Page, std::map<uint64_t, int32_t> const &Expected) {
+    REQUIRE(Page->Count == Expected.size());
+    for (uint64_t Offset = 0; Offset < 0x1000; ++Offset) {
+      auto Entry = LookupCache::FindL2Entry(Page, Offset);
+      auto it = Expected.find(Offset);
+      if (it == Expected.end()) {
+        CHECK(Entry == nullptr);
+      }
+      else {
+        REQUIRE(Entry != nullptr);
+        CHECK(Entry->HostCodeOffset == it->second);
+      }
+    }
+  }
+}
+
+TEST_CASE("LookupCache - L2 insert and probe") {
+  PageStorage Storage(16);
+  auto Page = Storage.Get();
+
+  CHECK(LookupCache::FindL2Entry(Page, 0) == nullptr);
+
+  std::map<uint64_t, int32_t> Expected;
+  for (uint64_t Offset : {0x0ULL, 0x10ULL, 0x123ULL, 0xFFFULL}) {
+    Insert(Page, Offset, -static_cast<int32_t>(Offset) * 4);
+    Expected[Offset] = -static_cast<int32_t>(Offset) * 4;
+  }
+
+  CheckContents(Page, Expected);
+}
+
+TEST_CASE("LookupCache - L2 erase") {
+  PageStorage Storage(16);
+  auto Page = Storage.Get();
+
+  std::map<uint64_t, int32_t> Expected;
+  for (uint64_t Offset : {0x1ULL, 0x40ULL, 0x800ULL}) {
+    Insert(Page, Offset, Offset);
+    Expected[Offset] = Offset;
+  }
+
+  CHECK(Erase(Page, 0x40));
+  Expected.erase(0x40);
+  CheckContents(Page, Expected);
+
+  // Erasing again or erasing something that was never there doesn't touch the table
+  CHECK_FALSE(Erase(Page, 0x40));
+  CHECK_FALSE(Erase(Page, 0x41));
+  CheckContents(Page, Expected);
+
+  // Slots can be reused
+  Insert(Page, 0x40, 7);
+  Expected[0x40] = 7;
+  CheckContents(Page, Expected);
+}
+
+TEST_CASE("LookupCache - L2 collision chains") {
+  constexpr uint32_t NumEntries = 16;
+  constexpr uint32_t Mask = NumEntries - 1;
+  PageStorage Storage(NumEntries);
+  auto Page = Storage.Get();
+
+  // A run of colliding keys, followed by one homed in the slot the run spills in to
+  constexpr uint32_t Home = 5;
+  auto Chain = HomedAt(Home, Mask, 4);
+  auto Neighbour = HomedAt(Home + 1, Mask, 1);
+  REQUIRE(Chain.size() == 4);
+  REQUIRE(Neighbour.size() == 1);
+
+  std::map<uint64_t, int32_t> Expected;
+  for (size_t i = 0; i < Chain.size(); ++i) {
+    Insert(Page, Chain[i], i + 1);
+    Expected[Chain[i]] = i + 1;
+  }
+  Insert(Page, Neighbour[0], 100);
+  Expected[Neighbour[0]] = 100;
+  CheckContents(Page, Expected);
+
+  // Erasing from the head, middle and tail of the chain has to keep everything behind it reachable
+  for (size_t i : {0, 2, 3}) {
+    CHECK(Erase(Page, Chain[i]));
+    Expected.erase(Chain[i]);
+    CheckContents(Page, Expected);
+  }
+
+  // Nothing is left behind once the chain is gone
+  CHECK(Erase(Page, Chain[1]));
+  CHECK(Erase(Page, Neighbour[0]));
+  Expected.clear();
+  CheckContents(Page, Expected);
+  for (uint32_t i = 0; i < NumEntries; ++i) {
+    CHECK(Page->Entries()[i].Key == 0);
+  }
+}
+
+TEST_CASE("LookupCache - L2 wrap around") {
+  constexpr uint32_t NumEntries = 8;
+  PageStorage Storage(NumEntries);
+  auto Page = Storage.Get();
+
+  // Keys homed in the last slot spill over to the start of the table
+  auto Chain = HomedAt(NumEntries - 1, NumEntries - 1, 3);
+  REQUIRE(Chain.size() == 3);
+
+  std::map<uint64_t, int32_t> Expected;
+  for (auto Offset : Chain) {
+    Insert(Page, Offset, Offset);
+    Expected[Offset] = Offset;
+  }
+  CheckContents(Page, Expected);
+
+  CHECK(Erase(Page, Chain[0]));
+  Expected.erase(Chain[0]);
+  CheckContents(Page, Expected);
+}
+
+TEST_CASE("LookupCache - L2 random") {
+  constexpr uint32_t NumEntries = 64;
+  PageStorage Storage(NumEntries);
+  auto Page = Storage.Get();
+
+  std::mt19937_64 Rand(0x4C32);
+  std::uniform_int_distribution<uint64_t> Offsets(0, 0xFFF);
+  std::map<uint64_t, int32_t> Expected;
+
+  for (size_t Iteration = 0; Iteration < 20000; ++Iteration) {
+    const auto Offset = Offsets(Rand);
+    if (Expected.contains(Offset)) {
+      CHECK(Erase(Page, Offset));
+      Expected.erase(Offset);
+    }
+    // Stay below the 3/4 load factor CacheBlockMapping grows at
+    else if ((Expected.size() + 1) * 4 <= NumEntries * 3) {
+      Insert(Page, Offset, Iteration);
+      Expected[Offset] = Iteration;
+    }
+  }
+
+  CheckContents(Page, Expected);
+}
@@ -0,0 +1,59 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x6162636465666768",
+    "RBX": "0x5152535455565758",
+    "RCX": "0x5152535455565758",
+    "RSI": "0x61626364",
+    "XMM0": ["0x4142434445464748", "0x5152535455565758"],
+    "XMM1": ["0x6162636465666768", "0x7172737475767778"],
+    "XMM2": ["0x5152535455565758", "0"],
+    "XMM3": ["0x61626364", "0"],
+    "XMM4": ["0x4142434445464748", "0x5152535455565758"],
+    "XMM5": ["0x6162636465666768", "0x7172737475767778"],
+    "XMM6": ["0x5556575865666768", "0x7172737451525354"]
+  },
+  "Env": { "FEX_TSOAUTOMIGRATION" : "0" }
+}
+%endif
+
+; Runs of back to back vector TSO accesses get their barriers coalesced.
+; Make sure every access in a run still observes the ones before it.
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 1], rax
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [rdx + 8 * 3], rax
+
+; Run of loads
+movups xmm0, [rdx]
+movups xmm1, [rdx + 16]
+movsd xmm2, [rdx + 8]
+movss xmm3, [rdx + 20]
+
+; Run of stores
+movups [rdx + 32], xmm1
+movups [rdx + 48], xmm0
+movsd [rdx + 64], xmm2
+movss [rdx + 72], xmm3
+
+; store -> load -> store -> load to the same and overlapping addresses
+movups [rdx + 80], xmm0
+movups xmm4, [rdx + 80]
+movups [rdx + 80], xmm1
+movups xmm5, [rdx + 80]
+movsd [rdx + 84], xmm2
+movups xmm6, [rdx + 80]
+
+; Read back the stores
+mov rax, [rdx + 32]
+mov rbx, [rdx + 56]
+mov rcx, [rdx + 64]
+mov esi, [rdx + 72]
+
+hlt
@@ -0,0 +1,41 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x3333333333333333",
+    "RBX": "0x2222222244444444",
+    "XMM0": ["0x2222222222222222", "0x4444444444444444"],
+    "XMM1": ["0x2222222222222222", "0x3333333333333333"],
+    "XMM2": ["0", "0"],
+    "XMM3": ["0", "0x2222222222222222"],
+    "XMM4": ["0x2222222200000000", "0x4444444422222222"]
+  },
+  "Env": { "FEX_TSOAUTOMIGRATION" : "0" }
+}
+%endif
+
+; Vector TSO accesses with ALU ops and GPR TSO accesses between them.
+; The GPR store splits the run and must land between the vector store and load around it.
+mov rdx, 0xe0000000
+
+mov rax, 0x1111111111111111
+mov [rdx], rax
+mov rax, 0x2222222222222222
+mov [rdx + 8], rax
+
+movups xmm0, [rdx]
+paddq xmm0, xmm0
+movups [rdx + 16], xmm0
+mov rax, 0x3333333333333333
+mov [rdx + 24], rax
+movups xmm1, [rdx + 16]
+
+pxor xmm2, xmm2
+movups [rdx + 32], xmm2
+movups [rdx + 48], xmm1
+movups xmm3, [rdx + 40]
+movups [rdx + 36], xmm0
+movups xmm4, [rdx + 32]
+
+mov rbx, [rdx + 48]
+
+hlt
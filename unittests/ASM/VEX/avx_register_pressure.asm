@@ -0,0 +1,165 @@
+%ifdef CONFIG
+{
+  "HostFeatures": ["AVX"],
+  "RegData": {
+    "XMM0": ["0x0E2CD0E0A720DCE2", "0x4367C02BE4983418", "0x6563BDC247F224E3", "0xED414B7DF65D5636"],
+    "XMM1": ["0xAAFA02137207ECED", "0xC562DC7209B644B2", "0x9F45A68347133E4C", "0x8B43E58DD8A55D89"],
+    "XMM2": ["0x6FFAAFB106455D7A", "0x18C6ADA989E3C914", "0x84EFA07C58E7E94D", "0xBAE7E344CA3073BA"],
+    "XMM3": ["0x6CDD4AE1DD2BFEF4", "0xE97AE8EAFB5D659E", "0xCAD3777EBE5D3DBE", "0xE53FAF4C5DDEDDA9"],
+    "XMM4": ["0x24620380A241B490", "0xA00020140508A140", "0x0562254001421019", "0x18B320A081016082"],
+    "XMM5": ["0x771152702BA53D3B", "0x0B51EEE30551B119", "0x0000000000000000", "0x0000000000000000"],
+    "XMM6": ["0x29E9DC3380EE258E", "0x8BA7284B1A7A72D5", "0xB3D6653349A148D8", "0xF1231A639BE92DCB"],
+    "XMM7": ["0xD8C1E4671E7B5CD7", "0xA127CFD28FCB0975", "0x88D5466656054A52", "0xB76826DD6A26FC1E"],
+    "XMM8": ["0xD005F66DDA2ACE78", "0x9569D9B8D070FE08", "0x101728E2405AA81C", "0x47A907B4D6BC9B84"],
+    "XMM9": ["0x5FD85503B92B1CB4", "0xD6B410CA6E4D3FB5", "0x891F9E7A086BB024", "0xCEB60B6DBFEBDD5F"],
+    "XMM10": ["0x2C5BE5C9FE24F0B4", "0x41054E57944938FE", "0x15BDF5202060498B", "0x53983E22A00DB547"],
+    "XMM11": ["0x5DC95B23952BFEB2", "0xAB0471820B7B5F9B", "0xB84F74DF788A3B3A", "0x84FF3056591CD7DA"],
+    "XMM12": ["0x18234965327E4001", "0x1BF1C1978433CC5D", "0x0535D0A1E1136B61", "0x1FCC00E28031BB6B"],
+    "XMM13": ["0xB96975F90F45C6A5", "0xBB679F87DE4E12E0", "0x60627E5A56FD06D3", "0x3F42A39F9F51CC14"],
+    "XMM14": ["0x0C97AE90A0208ECE", "0x7C41572393202304", "0x0000000000000000", "0x0000000000000000"],
+    "XMM15": ["0x668F9CB68B7B08EA", "0xF7CDB1DBFA9C06E2", "0x1338B68B5EE2A10D", "0x16932408EE622370"]
+  }
+}
+%endif
+
+lea rdx, [rel .data]
+
+; Load all sixteen registers, more 256-bit values than a 128-bit host has register pairs for
+vmovdqu ymm0, [rdx + 32 * 0]
+vmovdqu ymm1, [rdx + 32 * 1]
+vmovdqu ymm2, [rdx + 32 * 2]
+vmovdqu ymm3, [rdx + 32 * 3]
+vmovdqu ymm4, [rdx + 32 * 4]
+vmovdqu ymm5, [rdx + 32 * 5]
+vmovdqu ymm6, [rdx + 32 * 6]
+vmovdqu ymm7, [rdx + 32 * 7]
+vmovdqu ymm8, [rdx + 32 * 8]
+vmovdqu ymm9, [rdx + 32 * 9]
+vmovdqu ymm10, [rdx + 32 * 10]
+vmovdqu ymm11, [rdx + 32 * 11]
+vmovdqu ymm12, [rdx + 32 * 12]
+vmovdqu ymm13, [rdx + 32 * 13]
+vmovdqu ymm14, [rdx + 32 * 14]
+vmovdqu ymm15, [rdx + 32 * 15]
+
+; Lane independent ops that each get split in to two 128-bit ops on 128-bit hosts
+vpaddd ymm0, ymm0, ymm15
+vpsubq ymm1, ymm1, ymm14
+vpxor ymm2, ymm2, ymm13
+vpor ymm3, ymm3, ymm12
+vpand ymm4, ymm4, ymm11
+vpaddw ymm5, ymm5, ymm10
+vpaddq ymm6, ymm6, ymm9
+vpsubd ymm7, ymm7, ymm8
+vpaddd ymm8, ymm8, ymm0
+vpxor ymm9, ymm9, ymm1
+vpsubw ymm10, ymm10, ymm2
+vpaddq ymm11, ymm11, ymm3
+vpor ymm12, ymm12, ymm4
+vpsubq ymm13, ymm13, ymm5
+vpaddb ymm14, ymm14, ymm6
+vpxor ymm15, ymm15, ymm7
+
+; Round trip through memory
+vmovdqu [rdx + 32 * 16], ymm3
+vmovdqu [rdx + 32 * 17], ymm12
+vpaddd ymm3, ymm12, [rdx + 32 * 16]
+vpxor ymm12, ymm3, [rdx + 32 * 17]
+
+; 128-bit ops clear the upper half
+vpaddd xmm5, xmm5, xmm14
+vpxor xmm14, xmm14, [rdx + 32 * 17]
+
+hlt
+
+align 32
+.data:
+dq 0x4FDE580F122088A5
+dq 0xEC7D42226F412481
+dq 0xC975CCD53F0A3984
+dq 0x4B4648A8721876C8
+
+dq 0xFA7AD3F5418EF89A
+dq 0xC8863285DC8A5DA4
+dq 0x185E5EA58F78AF9B
+dq 0xDDA2D23EBE8964D1
+
+dq 0xD7EBB4E4ED308EDF
+dq 0x2F29BDA57EB2F026
+dq 0x85C77BB777F216AD
+dq 0xEAC97D8920C1CDE3
+
+dq 0xB74F465DC8C615DB
+dq 0xB6E6B62511CABB59
+dq 0xBA68CC085D06E09A
+dq 0x684B77142ACF34A7
+
+dq 0xB4734F80BA69F49C
+dq 0xA38325F7753BE145
+dq 0x07EF6D7B81421B99
+dq 0x1CBFA8A88741F186
+
+dq 0x62520FE2D7C7BED2
+dq 0x22BC7485FAD72440
+dq 0x061AC7D45ED1C635
+dq 0x026CD9C8E162C944
+
+dq 0x34C78522B5C13535
+dq 0x77D05B92B27EF7CE
+dq 0x9D7C2C39FA28BA70
+dq 0xAB2D2B83349AACF5
+
+dq 0x9A9B09F451854E6D
+dq 0xF329E95F7BA3D365
+dq 0x3388B1864E6DCD8B
+dq 0x11CFE3144A86416C
+
+dq 0xC1D9258D3309F196
+dq 0x5202198DEBD8C9F0
+dq 0xAAB36B20F8688339
+dq 0x5A67BC37E05F454E
+
+dq 0xF5225710CB2CF059
+dq 0x13D6CCB867FB7B07
+dq 0x165A38F94F788E68
+dq 0x45F5EEE0674E80D6
+
+dq 0x9C55957A04694E2E
+dq 0x59CBFC001E2C0212
+dq 0x9AAC959C794732D8
+dq 0x0E7F21666A3D2901
+
+dq 0x65EA13C5A755BEB3
+dq 0xB414B2148F8CA3C0
+dq 0xBD62A540197B545B
+dq 0x9AB330B7D92D60F3
+
+dq 0x50DC03046D143AF5
+dq 0xD28B29697A6E09C3
+dq 0xCA84839F5F0E46D7
+dq 0xE2428F8E5DEF66C2
+
+dq 0xB8111B55EB75D3A5
+dq 0x37EF100CF7513932
+dq 0x0128DBCB2F15FFE0
+dq 0x502E9ECDEAF1BE59
+
+dq 0x4F80D1E1CF870BAD
+dq 0x03235613D2D418F2
+dq 0x7918B8224865714F
+dq 0x525EECB0E5E40748
+
+dq 0xBE4E78D19500543D
+dq 0x56EA7E0975570F97
+dq 0x9BEDF0ED08E7EB5F
+dq 0xA1FB02D58444DF6E
+
+; Scratch
+dq 0
+dq 0
+dq 0
+dq 0
+dq 0
+dq 0
+dq 0
+dq 0
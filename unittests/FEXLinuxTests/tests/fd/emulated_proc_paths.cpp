@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+// Every spelling of an emulated file must reach the emulated contents, not the host file
+static std::string ReadAll(int fd) {
+  REQUIRE(fd != -1);
+  std::string Data{};
+  char Buffer[4096];
+  ssize_t Read{};
+  while ((Read = read(fd, Buffer, sizeof(Buffer))) > 0) {
+    Data.append(Buffer, Read);
+  }
+  close(fd);
+  return Data;
+}
+
+static std::string ReadPath(const char *Path) {
+  return ReadAll(open(Path, O_RDONLY));
+}
+
+TEST_CASE("Emulated files: non-canonical paths") {
+  const auto Expected = ReadPath("/proc/cpuinfo");
+  REQUIRE(!Expected.empty());
+
+  CHECK(ReadPath("//proc/cpuinfo") == Expected);
+  CHECK(ReadPath("/./proc/cpuinfo") == Expected);
+  CHECK(ReadPath("/proc//cpuinfo") == Expected);
+  CHECK(ReadPath("/proc/./cpuinfo") == Expected);
+  CHECK(ReadPath("/proc/self/../cpuinfo") == Expected);
+}
+
+TEST_CASE("Emulated files: dirfd relative") {
+  const auto Expected = ReadPath("/proc/cpuinfo");
+
+  int ProcFD = open("/proc", O_RDONLY | O_DIRECTORY);
+  REQUIRE(ProcFD != -1);
+  CHECK(ReadAll(openat(ProcFD, "cpuinfo", O_RDONLY)) == Expected);
+  close(ProcFD);
+
+  int RootFD = open("/", O_RDONLY | O_DIRECTORY);
+  REQUIRE(RootFD != -1);
+  CHECK(ReadAll(openat(RootFD, "proc/cpuinfo", O_RDONLY)) == Expected);
+  close(RootFD);
+}
+
+TEST_CASE("Emulated files: symlinks in to procfs") {
+  const auto Expected = ReadPath("/proc/cpuinfo");
+
+  char Dir[] = "/tmp/fex_emulated_XXXXXX";
+  REQUIRE(mkdtemp(Dir) != nullptr);
+  const std::string FileLink = std::string(Dir) + "/cpuinfo";
+  const std::string DirLink = std::string(Dir) + "/proc";
+
+  REQUIRE(symlink("/proc/cpuinfo", FileLink.c_str()) == 0);
+  REQUIRE(symlink("/proc", DirLink.c_str()) == 0);
+
+  CHECK(ReadPath(FileLink.c_str()) == Expected);
+  CHECK(ReadPath((DirLink + "/cpuinfo").c_str()) == Expected);
+
+  unlink(FileLink.c_str());
+  unlink(DirLink.c_str());
+  rmdir(Dir);
+}
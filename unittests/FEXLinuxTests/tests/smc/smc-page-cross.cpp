@@ -0,0 +1,52 @@
+/*
+  tests for smc changes to instructions that cross a page boundary
+
+  only the page holding the tail of the instruction changes, code starting on
+  the previous page must still see the new instruction
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+
+#include <catch2/catch.hpp>
+
+// mov eax, imm32 with the first two bytes of the imm on the first page; ret
+static char *emit(char *page, uint32_t imm) {
+  auto inst = page + 4096 - 3;
+  inst[0] = 0xB8;
+  memcpy(&inst[1], &imm, sizeof(imm));
+  inst[5] = 0xC3;
+  return inst;
+}
+
+TEST_CASE("SMC: page crossing write") {
+  auto code = (char *)mmap(0, 4096 * 2, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, 0, 0);
+  REQUIRE(code != MAP_FAILED);
+
+  auto fn = (uint32_t (*)())emit(code, 0xDDCCBBAA);
+  CHECK(fn() == 0xDDCCBBAA);
+
+  // patch the imm bytes on the second page only
+  code[4096 + 0] = 0x11;
+  code[4096 + 1] = 0x22;
+  CHECK(fn() == 0x2211BBAA);
+
+  munmap(code, 4096 * 2);
+}
+
+TEST_CASE("SMC: page crossing remap") {
+  auto code = (char *)mmap(0, 4096 * 2, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, 0, 0);
+  REQUIRE(code != MAP_FAILED);
+
+  auto fn = (uint32_t (*)())emit(code, 0xDDCCBBAA);
+  CHECK(fn() == 0xDDCCBBAA);
+
+  // replace the second page, the new page is zero filled
+  auto second = (char *)mmap(code + 4096, 4096, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_FIXED | MAP_PRIVATE | MAP_ANON, 0, 0);
+  REQUIRE(second == code + 4096);
+  second[2] = 0xC3;
+  CHECK(fn() == 0x0000BBAA);
+
+  munmap(code, 4096 * 2);
+}
@@ -0,0 +1,95 @@
+/*
+  tests threads that are created and exit in quick succession
+
+  each thread runs code that an earlier thread ran a different version of,
+  a thread reusing the state of an exited thread must not see the old code
+
+  also reports the latency of create + join, CLONE_EXIT_ITERATIONS sets the number of threads
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include <atomic>
+
+#include <catch2/catch.hpp>
+
+static char *code;
+
+static void *run_code(void *arg) {
+  auto fn = (int (*)())code;
+  *(int *)arg = fn();
+  return 0;
+}
+
+static void *empty_thread(void *) {
+  return 0;
+}
+
+static int iterations() {
+  auto env = getenv("CLONE_EXIT_ITERATIONS");
+  int count = env ? atoi(env) : 0;
+  return count > 0 ? count : 1000;
+}
+
+static uint64_t now_ns() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1'000'000'000ULL + ts.tv_nsec;
+}
+
+TEST_CASE("Threads: Exited thread code doesn't leak in to new threads") {
+  code = (char *)mmap(0, 4096, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, 0, 0);
+  REQUIRE(code != MAP_FAILED);
+
+  int failures = 0;
+  for (int i = 0; i < 64; i++) {
+    // mov eax, i; ret
+    code[0] = 0xB8;
+    memcpy(&code[1], &i, sizeof(i));
+    code[5] = 0xC3;
+
+    int result = -1;
+    pthread_t tid;
+    pthread_create(&tid, 0, &run_code, &result);
+    pthread_join(tid, 0);
+
+    failures += result != i;
+  }
+
+  munmap(code, 4096);
+  CHECK(failures == 0);
+}
+
+TEST_CASE("Threads: Create and exit latency") {
+  const int count = iterations();
+
+  // One thread at a time, every thread can reuse the state of the one before it
+  auto start = now_ns();
+  for (int i = 0; i < count; i++) {
+    pthread_t tid;
+    REQUIRE(pthread_create(&tid, 0, &empty_thread, 0) == 0);
+    pthread_join(tid, 0);
+  }
+  auto sequential = now_ns() - start;
+
+  // Bursts of threads that are alive at the same time
+  constexpr int burst = 16;
+  start = now_ns();
+  for (int i = 0; i < count; i += burst) {
+    pthread_t tid[burst];
+    for (int j = 0; j < burst; j++) {
+      REQUIRE(pthread_create(&tid[j], 0, &empty_thread, 0) == 0);
+    }
+    for (int j = 0; j < burst; j++) {
+      pthread_join(tid[j], 0);
+    }
+  }
+  auto bursts = now_ns() - start;
+
+  printf("Sequential create+join: %llu ns per thread\n", (unsigned long long)(sequential / count));
+  printf("Burst of %d create+join: %llu ns per thread\n", burst, (unsigned long long)(bursts / ((count + burst - 1) / burst * burst)));
+}
@@ -0,0 +1,148 @@
+/*
+  litmus tests for x86-TSO ordering of back to back vector accesses
+
+  vector TSO accesses are fenced explicitly on hosts without rcpc and runs of them
+  get their barriers coalesced, each pair below is a run the pass rewrites
+
+  message passing: data then flag are stored, a reader seeing the flag must see the data
+  load buffering: neither thread's load may see the other thread's later store
+*/
+#include <cstdint>
+#include <pthread.h>
+#include <sched.h>
+
+#include <atomic>
+
+#include <catch2/catch.hpp>
+
+struct alignas(16) Vec {
+  uint32_t v[4];
+};
+
+// movdqu stores of the same value to both locations, in order
+static void store_pair(Vec *first, Vec *second, Vec const *value) {
+  asm volatile(
+    "movdqu (%[value]), %%xmm0\n"
+    "movdqu %%xmm0, (%[first])\n"
+    "movdqu %%xmm0, (%[second])\n"
+    :
+    : [first] "r"(first), [second] "r"(second), [value] "r"(value)
+    : "xmm0", "memory");
+}
+
+// movdqu loads of both locations, in order
+static void load_pair(Vec const *first, Vec const *second, Vec *first_out, Vec *second_out) {
+  asm volatile(
+    "movdqu (%[first]), %%xmm0\n"
+    "movdqu (%[second]), %%xmm1\n"
+    "movdqu %%xmm0, (%[first_out])\n"
+    "movdqu %%xmm1, (%[second_out])\n"
+    :
+    : [first] "r"(first), [second] "r"(second), [first_out] "r"(first_out), [second_out] "r"(second_out)
+    : "xmm0", "xmm1", "memory");
+}
+
+// movdqu load of one location followed by a movdqu store to another
+static void load_store(Vec const *load, Vec *store, Vec const *value, Vec *load_out) {
+  asm volatile(
+    "movdqu (%[load]), %%xmm0\n"
+    "movdqu (%[value]), %%xmm1\n"
+    "movdqu %%xmm1, (%[store])\n"
+    "movdqu %%xmm0, (%[load_out])\n"
+    :
+    : [load] "r"(load), [store] "r"(store), [value] "r"(value), [load_out] "r"(load_out)
+    : "xmm0", "xmm1", "memory");
+}
+
+static Vec splat(uint32_t value) {
+  return Vec {{value, value, value, value}};
+}
+
+constexpr uint32_t MP_ITERATIONS = 200000;
+
+static Vec mp_data, mp_flag;
+
+static void *mp_writer(void *) {
+  for (uint32_t i = 1; i <= MP_ITERATIONS; i++) {
+    auto value = splat(i);
+    store_pair(&mp_data, &mp_flag, &value);
+  }
+  return 0;
+}
+
+TEST_CASE("TSO: message passing through vector stores") {
+  mp_data = splat(0);
+  mp_flag = splat(0);
+
+  pthread_t tid;
+  REQUIRE(pthread_create(&tid, 0, &mp_writer, 0) == 0);
+
+  uint32_t violations = 0;
+  Vec flag, data;
+  do {
+    load_pair(&mp_flag, &mp_data, &flag, &data);
+    // data is stored first, so it can't be older than the flag
+    violations += data.v[0] < flag.v[0] || data.v[3] < flag.v[3];
+  } while (flag.v[0] != MP_ITERATIONS);
+
+  pthread_join(tid, 0);
+  CHECK(violations == 0);
+}
+
+constexpr uint32_t LB_ITERATIONS = 20000;
+
+static Vec lb_x, lb_y;
+static Vec lb_r0, lb_r1;
+
+// two thread barrier so both threads run each iteration at the same time
+static std::atomic<uint32_t> lb_arrived{0};
+static std::atomic<uint32_t> lb_generation{0};
+
+static void lb_sync() {
+  const auto generation = lb_generation.load();
+  if (lb_arrived.fetch_add(1) == 1) {
+    lb_arrived.store(0);
+    lb_generation.store(generation + 1);
+  }
+  else {
+    while (lb_generation.load() == generation) {
+      sched_yield();
+    }
+  }
+}
+
+static void *lb_thread(void *) {
+  const auto one = splat(1);
+  for (uint32_t i = 0; i < LB_ITERATIONS; i++) {
+    lb_sync();
+    load_store(&lb_y, &lb_x, &one, &lb_r1);
+    lb_sync();
+    // wait for the main thread to check and reset
+    lb_sync();
+  }
+  return 0;
+}
+
+TEST_CASE("TSO: load buffering through vector accesses") {
+  lb_x = splat(0);
+  lb_y = splat(0);
+
+  pthread_t tid;
+  REQUIRE(pthread_create(&tid, 0, &lb_thread, 0) == 0);
+
+  const auto one = splat(1);
+  uint32_t violations = 0;
+  for (uint32_t i = 0; i < LB_ITERATIONS; i++) {
+    lb_sync();
+    load_store(&lb_x, &lb_y, &one, &lb_r0);
+    lb_sync();
+    // a load is never ordered after a later store, so at most one thread sees the other's store
+    violations += lb_r0.v[0] == 1 && lb_r1.v[0] == 1;
+    lb_x = splat(0);
+    lb_y = splat(0);
+    lb_sync();
+  }
+
+  pthread_join(tid, 0);
+  CHECK(violations == 0);
+}